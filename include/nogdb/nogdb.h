@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <initializer_list>
 #include <map>
 #include <memory>
 #include <set>
@@ -148,8 +149,72 @@ public:
         const std::string& propertyName,
         bool isUnique = false);
 
+    // an index of a TEXT property with a case-folding collation keeps its values folded to lower case,
+    // so that it is unique regardless of case and answers equal, beginWith and range conditions with
+    // ignoreCase (a unicode case-folding index only for conditions whose values are all ascii)
+    const IndexDescriptor addIndex(const std::string& className,
+        const std::string& propertyName,
+        bool isUnique,
+        IndexCollation collation);
+
+    // a partial index only keeps the records which satisfy its predicate, a condition or a conjunction
+    // of conditions without OR, NOT or comparison functions, so that a unique partial index only
+    // constrains those records and a query can only be answered by it if the query has every condition
+    // of the predicate (with the same comparator and values) among its top-level conjuncts
+    const IndexDescriptor addIndex(const std::string& className,
+        const std::string& propertyName,
+        bool isUnique,
+        const Condition& predicate);
+
+    const IndexDescriptor addIndex(const std::string& className,
+        const std::string& propertyName,
+        bool isUnique,
+        const MultiCondition& predicate);
+
+    // a composite index keys records by the values of all properties in the given order
+    // and keeps the values of the included properties in its entries so that queries which only
+    // project key or included properties can be answered without fetching the records
+    // (the included values of an entry in a non-unique index are limited to about 500 bytes)
+    const IndexDescriptor addIndex(const std::string& className,
+        const std::vector<std::string>& propertyNames,
+        bool isUnique = false,
+        const std::vector<std::string>& includedPropertyNames = std::vector<std::string> {});
+
+    const IndexDescriptor addIndex(const std::string& className,
+        std::initializer_list<std::string> propertyNames,
+        bool isUnique = false,
+        std::initializer_list<std::string> includedPropertyNames = {})
+    {
+        return addIndex(className,
+            std::vector<std::string>(propertyNames),
+            isUnique,
+            std::vector<std::string>(includedPropertyNames));
+    }
+
     void dropIndex(const std::string& className, const std::string& propertyName);
 
+    void dropIndex(const std::string& className, const std::vector<std::string>& propertyNames);
+
+    void dropIndex(const std::string& className, std::initializer_list<std::string> propertyNames)
+    {
+        dropIndex(className, std::vector<std::string>(propertyNames));
+    }
+
+    // a text index keeps each record under every trigram (three-byte substring) of its value of a TEXT
+    // property, so that contain, beginWith, endWith and like conditions with a literal part of three
+    // or more bytes look up their candidates by intersecting the records of the trigrams of that part
+    const IndexDescriptor addTextIndex(const std::string& className, const std::string& propertyName);
+
+    void dropTextIndex(const std::string& className, const std::string& propertyName);
+
+    // a polymorphic index on a base class keeps the records of the class and of all its subclasses under
+    // their values of a numeric or TEXT property of the class, each one with its full record id, so that
+    // a find with findSubClassOf looks its condition up with one range scan instead of one per subclass
+    // (texts of a polymorphic index are limited to about 500 bytes)
+    const IndexDescriptor addPolymorphicIndex(const std::string& className, const std::string& propertyName);
+
+    void dropPolymorphicIndex(const std::string& className, const std::string& propertyName);
+
     const DBInfo getDBInfo() const;
 
     const std::vector<ClassDescriptor> getClasses() const;
@@ -168,10 +233,37 @@ public:
 
     const IndexDescriptor getIndex(const std::string& className, const std::string& propertyName) const;
 
+    const IndexDescriptor getIndex(const std::string& className, const std::vector<std::string>& propertyNames) const;
+
+    const IndexDescriptor getIndex(const std::string& className, std::initializer_list<std::string> propertyNames) const
+    {
+        return getIndex(className, std::vector<std::string>(propertyNames));
+    }
+
+    const IndexDescriptor getTextIndex(const std::string& className, const std::string& propertyName) const;
+
+    const IndexDescriptor getPolymorphicIndex(const std::string& className, const std::string& propertyName) const;
+
+    const ClassStatistics analyze(const std::string& className);
+
+    const ClassStatistics getStatistics(const std::string& className) const;
+
     Record fetchRecord(const RecordDescriptor& recordDescriptor) const;
 
     const RecordDescriptor addVertex(const std::string& className, const Record& record = Record {});
 
+    // replace the properties of the vertex which has the value of the record for a property with a unique index
+    // as update does, or add the record as a new vertex if there is none
+    const RecordDescriptor upsertVertex(const std::string& className,
+        const std::string& uniquePropertyName,
+        const Record& record);
+
+    // return the vertex which has the value of the record for a property with a unique index, or add the record
+    // as a new vertex if there is none
+    const RecordDescriptor getOrCreateVertex(const std::string& className,
+        const std::string& uniquePropertyName,
+        const Record& record);
+
     const RecordDescriptor addEdge(const std::string& className,
         const RecordDescriptor& srcVertexRecordDescriptor,
         const RecordDescriptor& dstVertexRecordDescriptor,
@@ -225,6 +317,25 @@ private:
     friend struct schema::SchemaUtils;
     friend struct datarecord::DataRecordUtils;
     friend struct index::IndexUtils;
+    friend struct statistics::StatisticsUtils;
+
+    // a read-only transaction which reads the databases that the owner has shared for it
+    explicit Transaction(const Transaction* owner);
+
+    const RecordDescriptor insertVertex(const adapter::schema::ClassAccessInfo& classInfo,
+        const std::map<std::string, adapter::schema::PropertyAccessInfo>& propertyNameMapInfo,
+        const Record& record);
+
+    void updateRecord(const adapter::schema::ClassAccessInfo& classInfo,
+        const std::map<std::string, adapter::schema::PropertyAccessInfo>& propertyNameMapInfo,
+        const RecordDescriptor& recordDescriptor,
+        const Record& record);
+
+    const IndexDescriptor createIndex(const std::string& className,
+        const std::string& propertyName,
+        bool isUnique,
+        const std::vector<const Condition*>& predicate,
+        IndexCollation collation = IndexCollation::BINARY);
 
     class Adapter {
     public:
@@ -246,11 +357,23 @@ private:
 
         adapter::schema::IndexAccess* dbIndex() const { return _index; }
 
+        adapter::schema::CompositeIndexAccess* dbCompositeIndex() const { return _compositeIndex; }
+
+        adapter::schema::TextIndexAccess* dbTextIndex() const { return _textIndex; }
+
+        adapter::schema::PolymorphicIndexAccess* dbPolymorphicIndex() const { return _polymorphicIndex; }
+
+        adapter::metadata::StatisticsAccess* dbStatistics() const { return _statistics; }
+
     private:
         adapter::metadata::DBInfoAccess* _dbInfo;
         adapter::schema::ClassAccess* _class;
         adapter::schema::PropertyAccess* _property;
         adapter::schema::IndexAccess* _index;
+        adapter::schema::CompositeIndexAccess* _compositeIndex;
+        adapter::schema::TextIndexAccess* _textIndex;
+        adapter::schema::PolymorphicIndexAccess* _polymorphicIndex;
+        adapter::metadata::StatisticsAccess* _statistics;
     };
 
     TxnMode _txnMode;
@@ -39,6 +39,7 @@
 #define NOGDB_GRAPH_NOEXST_DST 0x103
 #define NOGDB_GRAPH_DUP_EDGE 0x200
 #define NOGDB_GRAPH_NOEXST_EDGE 0x201
+#define NOGDB_GRAPH_NEGATIVE_WEIGHT 0x300
 #define NOGDB_GRAPH_UNKNOWN_ERR 0x9ff
 
 #define NOGDB_INTERNAL_NULL_TXN 0xa00
@@ -246,6 +247,8 @@ public:
             return "NOGDB_GRAPH_DUP_EDGE: A duplicated edge in a graph";
         case NOGDB_GRAPH_NOEXST_EDGE:
             return "NOGDB_GRAPH_NOEXST_EDGE: An edge doesn't exist";
+        case NOGDB_GRAPH_NEGATIVE_WEIGHT:
+            return "NOGDB_GRAPH_NEGATIVE_WEIGHT: An edge has a negative or NaN weight for a weighted shortest path";
         case NOGDB_GRAPH_UNKNOWN_ERR:
         default:
             return "NOGDB_GRAPH_UNKNOWN_ERR: Unknown";
@@ -56,7 +56,8 @@ struct SQL {
             CLASS_DESCRIPTOR,
             PROPERTY_DESCRIPTOR,
             RECORD_DESCRIPTORS,
-            RESULT_SET
+            RESULT_SET,
+            QUERY_PLAN
         };
 
         inline Type type() const
@@ -107,6 +108,12 @@ struct SQL {
         {
         }
 
+        Result(QueryPlan* queryPlan)
+            : t(QUERY_PLAN)
+            , value(queryPlan)
+        {
+        }
+
         Type t;
         std::shared_ptr<void> value;
     };
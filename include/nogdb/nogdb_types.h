@@ -25,6 +25,8 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <initializer_list>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
@@ -55,13 +57,25 @@ namespace compare {
 namespace adapter {
     namespace metadata {
         class DBInfoAccess;
+
+        class StatisticsAccess;
     }
     namespace schema {
+        struct ClassAccessInfo;
+
+        struct PropertyAccessInfo;
+
         class ClassAccess;
 
         class PropertyAccess;
 
         class IndexAccess;
+
+        class CompositeIndexAccess;
+
+        class TextIndexAccess;
+
+        class PolymorphicIndexAccess;
     }
 }
 
@@ -79,6 +93,12 @@ namespace relation {
 
 namespace index {
     struct IndexUtils;
+
+    class IndexCursor;
+}
+
+namespace statistics {
+    struct StatisticsUtils;
 }
 
 namespace validate {
@@ -125,6 +145,14 @@ enum class TxnMode {
     READ_WRITE
 };
 
+// how the TEXT keys of a single-property index are compared: byte by byte, or with their letters folded
+// to lower case so that the index answers case-insensitive conditions instead of case-sensitive ones
+enum class IndexCollation {
+    BINARY,
+    ASCII_CASE_FOLD,
+    UNICODE_CASE_FOLD
+};
+
 typedef uint16_t ClassId;
 typedef uint16_t PropertyId;
 typedef uint32_t PositionId;
@@ -627,6 +655,7 @@ private:
     friend class algorithm::GraphTraversal;
     friend class sql_parser::Record;
     friend class ResultSetCursor;
+    friend struct index::IndexUtils;
 
     Record(PropertyToBytesMap properties);
 
@@ -702,18 +731,126 @@ private:
 struct IndexDescriptor {
     IndexDescriptor() = default;
 
-    IndexDescriptor(const IndexId& _id, const ClassId& _classId, const PropertyId& _propertyId, bool _isUnique)
+    IndexDescriptor(const IndexId& _id,
+        const ClassId& _classId,
+        const PropertyId& _propertyId,
+        bool _isUnique,
+        IndexCollation _collation = IndexCollation::BINARY)
         : id { _id }
         , classId { _classId }
         , propertyId { _propertyId }
+        , propertyIds { _propertyId }
+        , unique { _isUnique }
+        , collation { _collation }
+    {
+    }
+
+    IndexDescriptor(const IndexId& _id,
+        const ClassId& _classId,
+        const std::vector<PropertyId>& _propertyIds,
+        bool _isUnique,
+        const std::vector<PropertyId>& _includedPropertyIds = std::vector<PropertyId> {})
+        : id { _id }
+        , classId { _classId }
+        , propertyId { _propertyIds.empty() ? PropertyId { 0 } : _propertyIds.front() }
+        , propertyIds { _propertyIds }
+        , includedPropertyIds { _includedPropertyIds }
         , unique { _isUnique }
     {
     }
 
     IndexId id { 0 };
     ClassId classId { 0 };
+    // the first (or only) indexed property
     PropertyId propertyId { 0 };
+    // all indexed properties in key order
+    std::vector<PropertyId> propertyIds {};
+    // the non-key properties whose values are stored in the index entries
+    std::vector<PropertyId> includedPropertyIds {};
     bool unique { true };
+    IndexCollation collation { IndexCollation::BINARY };
+};
+
+struct HistogramBucket {
+    HistogramBucket() = default;
+
+    HistogramBucket(const Bytes& _lowerBound, const Bytes& _upperBound, uint64_t _count, uint64_t _distinctCount)
+        : lowerBound { _lowerBound }
+        , upperBound { _upperBound }
+        , count { _count }
+        , distinctCount { _distinctCount }
+    {
+    }
+
+    Bytes lowerBound {};
+    Bytes upperBound {};
+    uint64_t count { 0 };
+    uint64_t distinctCount { 0 };
+};
+
+struct PropertyStatistics {
+    PropertyStatistics() = default;
+
+    PropertyId propertyId { 0 };
+    std::string propertyName { "" };
+    PropertyType type { PropertyType::UNDEFINED };
+    IndexId indexId { 0 };
+    // number of records in the class at the time the property was analyzed
+    uint64_t rowCount { 0 };
+    uint64_t nullCount { 0 };
+    uint64_t distinctCount { 0 };
+    std::vector<std::pair<Bytes, uint64_t>> mostCommonValues {};
+    // equi-depth histogram over all non-null values in ascending order
+    std::vector<HistogramBucket> histogram {};
+};
+
+struct ClassStatistics {
+    ClassStatistics() = default;
+
+    ClassId classId { 0 };
+    std::string className { "" };
+    // current number of records in the class
+    uint64_t rowCount { 0 };
+    std::vector<PropertyStatistics> properties {};
+};
+
+struct PlanStage {
+    PlanStage() = default;
+
+    PlanStage(const std::string& _operation, const std::string& _className)
+        : operation { _operation }
+        , className { _className }
+    {
+    }
+
+    // access path or step, e.g. INDEX_SCAN, INDEX_INTERSECT, POLYMORPHIC_INDEX_SCAN, FETCH, FILTER, COLUMN_SCAN,
+    // FULL_SCAN, FUNCTION_SCAN, TRAVERSE, SHORTEST_PATH or SELECT
+    std::string operation { "" };
+    std::string className { "" };
+    std::vector<IndexId> indexIds {};
+    std::string detail { "" };
+    // 0 if the stage has no estimate
+    uint64_t estimatedRows { 0 };
+    uint64_t actualRows { 0 };
+    // index entries (or adjacency entries for graph operations) read by the stage
+    uint64_t indexEntries { 0 };
+    // records (or vertices for graph operations) visited by the stage
+    uint64_t rowsScanned { 0 };
+    // records fetched from the data storage and parsed by the stage
+    uint64_t recordsDecoded { 0 };
+    // in milliseconds
+    double elapsedTime { 0.0 };
+};
+
+struct QueryPlan {
+    QueryPlan() = default;
+
+    std::string toString() const;
+
+    std::vector<PlanStage> stages {};
+    uint64_t actualRows { 0 };
+    // in milliseconds
+    double elapsedTime { 0.0 };
 };
 
 struct PropertyDescriptor {
@@ -808,26 +945,37 @@ public:
 
 private:
     friend struct datarecord::DataRecordUtils;
+    friend struct index::IndexUtils;
+    friend class compare::RecordCompare;
 
     const Transaction* txn;
-    std::vector<RecordDescriptor> metadata {};
+    // descriptors read so far; an index cursor, if any, produces the rest on demand
+    mutable std::vector<RecordDescriptor> metadata {};
+    mutable std::unique_ptr<index::IndexCursor> indexCursor {};
     long long currentIndex;
     Result result;
 
+    // read descriptors from the index cursor until the one at the index is available
+    bool fetch(size_t index) const;
+
     ResultSetCursor& addMetadata(const RecordDescriptor& recordDescriptor)
     {
+        fetch(SIZE_MAX);
         metadata.emplace_back(recordDescriptor);
         return *this;
     }
 
     ResultSetCursor& addMetadata(const std::vector<RecordDescriptor>& recordDescriptors)
     {
+        fetch(SIZE_MAX);
         metadata.insert(metadata.cend(), recordDescriptors.cbegin(), recordDescriptors.cend());
         return *this;
     }
 
     ResultSetCursor& addMetadata(const ResultSetCursor& resultSetCursor)
     {
+        fetch(SIZE_MAX);
+        resultSetCursor.fetch(SIZE_MAX);
         metadata.insert(metadata.cend(), resultSetCursor.metadata.cbegin(), resultSetCursor.metadata.cend());
         return *this;
     }
@@ -1382,6 +1530,17 @@ public:
 
     virtual FindOperationBuilder& indexed(bool onlyIndex = true);
 
+    /**
+     * Only return the given properties of the records. A covering index which answers the condition
+     * and keeps all of these properties returns them without the records being fetched.
+     */
+    virtual FindOperationBuilder& select(const std::vector<std::string>& propertyNames);
+
+    FindOperationBuilder& select(std::initializer_list<std::string> propertyNames)
+    {
+        return select(std::vector<std::string>(propertyNames));
+    }
+
     //    virtual FindOperationBuilder& limit(unsigned int size);
     //
     //    virtual FindOperationBuilder& limit(unsigned int from, unsigned int to);
@@ -1416,16 +1575,27 @@ public:
 
     unsigned long count() const;
 
+    /**
+     * Run the search as get() does and return its plan instead of the records: the access path
+     * taken on each class (index, covering, polymorphic or full scan) followed by the fetch or filter
+     * of the candidates, each with its index ids, estimated and actual rows, records decoded and time.
+     */
+    QueryPlan explain() const;
+
 private:
     friend class Transaction;
 
     FindOperationBuilder(const Transaction* txn, const std::string& className, bool includeSubClassOf);
 
+    // the search behind get() and explain(), which records its stages if queryPlan is not null
+    ResultSet getResultSet(QueryPlan* queryPlan) const;
+
     std::string _className;
     ConditionType _conditionType;
     bool _includeSubClassOf;
     bool _indexed { false };
     std::vector<std::string> _orderBy {};
+    std::vector<std::string> _projection {};
 
     //TODO: can be improved by using std::varient in c++17
     std::shared_ptr<Condition> _condition {};
@@ -1506,6 +1676,14 @@ public:
 
     virtual TraverseOperationBuilder& depth(unsigned int minDepth, unsigned int maxDepth);
 
+    /**
+     * Expand every depth level with up to nThreads threads, or one per hardware thread if nThreads is 0.
+     * Each thread reads through its own read-only transaction on the snapshot of this one, and the result is
+     * the same as that of a single thread. A read-write transaction traverses with one thread, as the others
+     * would not see its uncommitted writes.
+     */
+    virtual TraverseOperationBuilder& parallel(unsigned int nThreads);
+
     //    virtual TraverseOperationBuilder& orderBy(const std::string &propName);
     //
     //    template<typename ...T>
@@ -1536,6 +1714,13 @@ public:
 
     unsigned long count() const;
 
+    /**
+     * Run the traversal as get() does and return its plan instead of the vertices: one TRAVERSE stage
+     * with the sources, depth range and threads used, the adjacency entries read and the vertices
+     * visited, followed by the FETCH of the vertices found.
+     */
+    QueryPlan explain() const;
+
 private:
     friend class Transaction;
 
@@ -1550,6 +1735,7 @@ private:
     GraphFilter _edgeFilter {};
     GraphFilter _vertexFilter {};
     std::vector<std::string> _orderBy {};
+    unsigned int _nThreads { 1 };
 };
 
 class ShortestPathOperationBuilder : public OperationBuilder {
@@ -1562,6 +1748,28 @@ public:
 
     virtual ShortestPathOperationBuilder& whereE(const GraphFilter& filter);
 
+    /**
+     * Search from both the source, along out-edges, and the destination, along in-edges, a level of the smaller
+     * frontier at a time until they meet (the default), or only forward from the source.
+     */
+    virtual ShortestPathOperationBuilder& bidirectional(bool isBidirectional = true);
+
+    /**
+     * Find the path of the least total weight instead of the fewest edges with Dijkstra's algorithm, searching forward
+     * from the source. The weight of an edge is the value of its numeric property, which must not be negative or NaN.
+     * An edge without the property weighs defaultWeight if it is given, or is not followed otherwise.
+     */
+    virtual ShortestPathOperationBuilder& weight(const std::string& propertyName);
+
+    virtual ShortestPathOperationBuilder& weight(const std::string& propertyName, double defaultWeight);
+
+    /**
+     * Search a weighted path with A*, ordering vertices by their weight from the source plus the estimate
+     * of their remaining weight to the destination. An estimate which is never above the actual remaining weight
+     * keeps the path found the lightest one.
+     */
+    virtual ShortestPathOperationBuilder& heuristic(double (*estimate)(const Record& vertex, const Record& destination));
+
     //    virtual ShortestPathOperationBuilder& minDepth(unsigned int depth);
     //
     //    virtual ShortestPathOperationBuilder& maxDepth(unsigned int depth);
@@ -1598,6 +1806,13 @@ public:
 
     unsigned long count() const;
 
+    /**
+     * Search the path as get() does and return its plan instead of the vertices: one SHORTEST_PATH stage
+     * with the length (and weight) of the path and the search used, the adjacency entries read and the
+     * vertices visited, followed by the FETCH of the vertices on the path.
+     */
+    QueryPlan explain() const;
+
 private:
     friend class Transaction;
 
@@ -1611,6 +1826,11 @@ private:
     unsigned int _maxDepth { std::numeric_limits<unsigned int>::max() };
     GraphFilter _edgeFilter {};
     GraphFilter _vertexFilter {};
+    bool _bidirectional { true };
+    std::string _weightPropertyName {};
+    bool _hasDefaultWeight { false };
+    double _defaultWeight { 0.0 };
+    double (*_heuristic)(const Record& vertex, const Record& destination) { nullptr };
     std::vector<std::string> _orderBy {};
 };
 
@@ -1656,7 +1876,8 @@ inline bool operator==(const PropertyDescriptor& lhs, const PropertyDescriptor&
 
 inline bool operator==(const IndexDescriptor& lhs, const IndexDescriptor& rhs)
 {
-    return (lhs.id == rhs.id) && (lhs.classId == rhs.classId) && (lhs.propertyId == rhs.propertyId) && (lhs.unique == rhs.unique);
+    return (lhs.id == rhs.id) && (lhs.classId == rhs.classId) && (lhs.propertyIds == rhs.propertyIds) && (lhs.unique == rhs.unique)
+        && (lhs.collation == rhs.collation);
 }
 
 inline std::string rid2str(const nogdb::RecordId& rid)
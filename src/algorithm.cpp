@@ -19,15 +19,133 @@
  *
  */
 
+#include <array>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <sstream>
+
 #include "algorithm.hpp"
 
 namespace nogdb {
 namespace algorithm {
+    namespace {
+        /**
+         * The depth at which every vertex was first reached, shared by the threads of a parallel traversal.
+         * The vertices are spread over shards by their hash, and each shard has a mutex of its own.
+         */
+        class VisitedVertices {
+        public:
+            // add the vertex at the depth unless it is there, and return whether it was added and its depth
+            std::pair<bool, unsigned int> visit(const RecordId& rid, unsigned int depth)
+            {
+                auto& shard = _shards[RecordIdHash {}(rid) % SHARD_COUNT];
+                std::lock_guard<std::mutex> lock { shard.mutex };
+                auto vertex = shard.depths.insert({ rid, depth });
+                return std::make_pair(vertex.second, vertex.first->second);
+            }
+
+        private:
+            static constexpr size_t SHARD_COUNT = 64;
+
+            struct Shard {
+                std::mutex mutex {};
+                std::unordered_map<RecordId, unsigned int, RecordIdHash> depths {};
+            };
+
+            std::array<Shard, SHARD_COUNT> _shards {};
+        };
+
+        /**
+         * The threads of a parallel traversal, which are started once and given the work of one level after another.
+         */
+        class WorkerPool {
+        public:
+            explicit WorkerPool(size_t size)
+            {
+                for (auto worker = size_t { 0 }; worker < size; ++worker) {
+                    _threads.emplace_back([this, worker]() { work(worker); });
+                }
+            }
+
+            ~WorkerPool() noexcept
+            {
+                {
+                    std::lock_guard<std::mutex> lock { _mutex };
+                    _stopped = true;
+                }
+                _started.notify_all();
+                for (auto& thread : _threads) {
+                    thread.join();
+                }
+            }
+
+            WorkerPool(const WorkerPool&) = delete;
+
+            WorkerPool& operator=(const WorkerPool&) = delete;
+
+            // give the task to the first workers, which call it with their index, until wait() returns
+            void start(size_t count, const std::function<void(size_t)>& task)
+            {
+                {
+                    std::lock_guard<std::mutex> lock { _mutex };
+                    _task = &task;
+                    _count = count;
+                    _running = count;
+                    ++_round;
+                }
+                _started.notify_all();
+            }
+
+            void wait()
+            {
+                std::unique_lock<std::mutex> lock { _mutex };
+                _finished.wait(lock, [this]() { return _running == 0; });
+            }
+
+        private:
+            void work(size_t worker)
+            {
+                auto round = size_t { 0 };
+                std::unique_lock<std::mutex> lock { _mutex };
+                while (true) {
+                    _started.wait(lock, [&]() { return _stopped || _round != round; });
+                    if (_stopped) {
+                        return;
+                    }
+                    round = _round;
+                    if (worker < _count) {
+                        auto task = _task;
+                        lock.unlock();
+                        (*task)(worker);
+                        lock.lock();
+                        if (--_running == 0) {
+                            _finished.notify_one();
+                        }
+                    }
+                }
+            }
+
+            std::vector<std::thread> _threads {};
+            std::mutex _mutex {};
+            std::condition_variable _started {};
+            std::condition_variable _finished {};
+            const std::function<void(size_t)>* _task { nullptr };
+            size_t _count { 0 };
+            size_t _running { 0 };
+            size_t _round { 0 };
+            bool _stopped { false };
+        };
+    }
+
     using namespace adapter::schema;
     using namespace adapter::relation;
     using namespace datarecord;
     using compare::RecordCompare;
     using compare::ClassFilter;
+    using parser::RecordParser;
+    using schema::SchemaUtils;
 
     ResultSet GraphTraversal::breadthFirstSearch(const Transaction& txn,
         const std::set<RecordDescriptor>& recordDescriptors,
@@ -35,29 +153,64 @@ namespace algorithm {
         unsigned int maxDepth,
         const Direction& direction,
         const GraphFilter& edgeFilter,
-        const GraphFilter& vertexFilter)
+        const GraphFilter& vertexFilter,
+        unsigned int nThreads,
+        QueryPlan* queryPlan)
     {
-        const auto searchResultDescriptor = breadthFirstSearchRdesc(
-            txn, recordDescriptors, minDepth, maxDepth, direction, edgeFilter, vertexFilter);
-        ResultSet result(searchResultDescriptor.size());
-        std::transform(searchResultDescriptor.begin(), searchResultDescriptor.end(), result.begin(),
-            [&txn](const RecordDescriptor& descriptor) {
-                const auto classInfo = txn._adapter->dbClass()->getInfo(descriptor.rid.first);
-                const auto& record = DataRecordUtils::getRecordWithBasicInfo(&txn, classInfo, descriptor);
-                record.setBasicInfo(DEPTH_PROPERTY, descriptor._depth);
-                return Result(descriptor, record);
-            });
+        return fetchRecords(txn, breadthFirstSearchRdesc(txn, recordDescriptors, minDepth, maxDepth, direction,
+            edgeFilter, vertexFilter, nThreads, queryPlan), queryPlan);
+    }
 
+    std::vector<RecordDescriptor> GraphTraversal::breadthFirstSearchRdesc(const Transaction& txn,
+        const std::set<RecordDescriptor>& recordDescriptors,
+        unsigned int minDepth,
+        unsigned int maxDepth,
+        const Direction& direction,
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter,
+        unsigned int nThreads,
+        QueryPlan* queryPlan)
+    {
+        auto stopwatch = explain::Stopwatch {};
+        auto stage = PlanStage { "TRAVERSE", "" };
+        auto result = std::vector<RecordDescriptor> {};
+        auto threadCount = (nThreads == 0) ? std::max(1U, std::thread::hardware_concurrency()) : nThreads;
+        auto workerTxns = std::vector<Transaction> {};
+        try {
+            if (threadCount > 1 && maxDepth > 0 && txn.getTxnMode() == TxnMode::READ_ONLY) {
+                workerTxns = beginSnapshotTxns(txn, threadCount - 1);
+            }
+            if (workerTxns.empty()) {
+                result = sequentialBreadthFirstSearchRdesc(
+                    txn, recordDescriptors, minDepth, maxDepth, direction, edgeFilter, vertexFilter, stage);
+            } else {
+                result = parallelBreadthFirstSearchRdesc(txn, workerTxns, recordDescriptors, minDepth, maxDepth,
+                    direction, edgeFilter, vertexFilter, stage);
+            }
+        } catch (const Error& err) {
+            if (err.code() == NOGDB_GRAPH_NOEXST_VERTEX) {
+                throw NOGDB_GRAPH_ERROR(NOGDB_GRAPH_UNKNOWN_ERR);
+            } else {
+                throw NOGDB_FATAL_ERROR(err);
+            }
+        }
+        if (queryPlan != nullptr) {
+            stage.detail = "sources=" + std::to_string(recordDescriptors.size())
+                + ", depth=" + std::to_string(minDepth) + ".." + std::to_string(maxDepth)
+                + (workerTxns.empty() ? "" : ", threads=" + std::to_string(workerTxns.size() + 1));
+            explain::record(queryPlan, stage, result.size(), stopwatch);
+        }
         return result;
     }
 
-    std::vector<RecordDescriptor> GraphTraversal::breadthFirstSearchRdesc(const Transaction& txn,
+    std::vector<RecordDescriptor> GraphTraversal::sequentialBreadthFirstSearchRdesc(const Transaction& txn,
         const std::set<RecordDescriptor>& recordDescriptors,
         unsigned int minDepth,
         unsigned int maxDepth,
         const Direction& direction,
         const GraphFilter& edgeFilter,
-        const GraphFilter& vertexFilter)
+        const GraphFilter& vertexFilter,
+        PlanStage& stage)
     {
         auto result = std::vector<RecordDescriptor> {};
         auto visited = std::unordered_set<RecordId, RecordIdHash> {};
@@ -67,36 +220,200 @@ namespace algorithm {
             queue.push(std::make_pair(recordDescriptor, 0));
         }
 
-        try {
-            auto edgeClassFilter = RecordCompare::getFilterClasses(txn, edgeFilter);
-            auto vertexClassFilter = RecordCompare::getFilterClasses(txn, vertexFilter);
-            auto addUniqueVertex = [&](const std::pair<RecordDescriptor, unsigned int>& nextVertexInfo) {
-                auto currentVertex = nextVertexInfo.first;
-                auto currentLevel = nextVertexInfo.second;
-                if (visited.find(currentVertex.rid) != visited.cend())
-                    return;
-                auto vertexRdesc = RecordCompare::filterRecord(txn, currentVertex, vertexFilter, vertexClassFilter);
-                if ((currentLevel >= minDepth) && (currentLevel <= maxDepth) && (vertexRdesc != RecordDescriptor {})) {
-                    vertexRdesc._depth = currentLevel;
-                    result.emplace_back(vertexRdesc);
-                }
-                visited.insert(currentVertex.rid);
-                if ((currentLevel < maxDepth) && (vertexRdesc != RecordDescriptor {})) {
-                    queue.push(std::make_pair(currentVertex.rid, currentLevel));
+        auto edgeClassFilter = RecordCompare::getFilterClasses(txn, edgeFilter);
+        auto vertexClassFilter = RecordCompare::getFilterClasses(txn, vertexFilter);
+        auto addUniqueVertex = [&](const std::pair<RecordDescriptor, unsigned int>& nextVertexInfo) {
+            auto currentVertex = nextVertexInfo.first;
+            auto currentLevel = nextVertexInfo.second;
+            if (visited.find(currentVertex.rid) != visited.cend())
+                return;
+            auto vertexRdesc = RecordCompare::filterRecord(txn, currentVertex, vertexFilter, vertexClassFilter);
+            if ((currentLevel >= minDepth) && (currentLevel <= maxDepth) && (vertexRdesc != RecordDescriptor {})) {
+                vertexRdesc._depth = currentLevel;
+                result.emplace_back(vertexRdesc);
+            }
+            visited.insert(currentVertex.rid);
+            if ((currentLevel < maxDepth) && (vertexRdesc != RecordDescriptor {})) {
+                queue.push(std::make_pair(currentVertex.rid, currentLevel));
+            }
+        };
+
+        if (minDepth == 0) {
+            result.assign(recordDescriptors.cbegin(), recordDescriptors.cend());
+        }
+        while (!queue.empty()) {
+            auto vertex = queue.front();
+            queue.pop();
+            auto edgeNeighbours =
+                RecordCompare::filterIncidentEdges(txn, vertex.first.rid, direction, edgeFilter, edgeClassFilter);
+            ++stage.rowsScanned;
+            stage.indexEntries += edgeNeighbours.size();
+            for (const auto& edgeNeighbour : edgeNeighbours) {
+                addUniqueVertex(std::make_pair(edgeNeighbour.second, vertex.second + 1));
+            }
+        }
+        return result;
+    }
+
+    std::vector<RecordDescriptor> GraphTraversal::parallelBreadthFirstSearchRdesc(const Transaction& txn,
+        const std::vector<Transaction>& workerTxns,
+        const std::set<RecordDescriptor>& recordDescriptors,
+        unsigned int minDepth,
+        unsigned int maxDepth,
+        const Direction& direction,
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter,
+        PlanStage& stage)
+    {
+        auto result = std::vector<RecordDescriptor> {};
+        auto edgeClassFilter = RecordCompare::getFilterClasses(txn, edgeFilter);
+        auto vertexClassFilter = RecordCompare::getFilterClasses(txn, vertexFilter);
+        VisitedVertices visited;
+        WorkerPool workers { workerTxns.size() };
+        auto frontier = std::vector<RecordId> {};
+        for (const auto& recordDescriptor : recordDescriptors) {
+            visited.visit(recordDescriptor.rid, 0);
+            frontier.emplace_back(recordDescriptor.rid);
+        }
+        if (minDepth == 0) {
+            result.assign(recordDescriptors.cbegin(), recordDescriptors.cend());
+        }
+
+        for (auto level = 0U; !frontier.empty() && level < maxDepth; ++level) {
+            auto nextLevel = level + 1;
+            auto chunkCount = std::min(workerTxns.size() + 1,
+                (frontier.size() + PARALLEL_TRAVERSE_MIN_VERTICES - 1) / PARALLEL_TRAVERSE_MIN_VERTICES);
+            // the neighbours of every frontier vertex which were first reached at the next level, in edge order
+            auto neighbours = std::vector<std::vector<RecordId>>(frontier.size());
+            // the vertices each chunk has claimed, with their descriptors if they passed the vertex filter
+            auto claimed = std::vector<std::unordered_map<RecordId, RecordDescriptor, RecordIdHash>>(chunkCount);
+            auto rowsScanned = std::vector<size_t>(chunkCount);
+            auto indexEntries = std::vector<size_t>(chunkCount);
+            auto errors = std::vector<std::exception_ptr>(chunkCount);
+            auto expand = [&](const Transaction& chunkTxn, size_t chunk) {
+                try {
+                    for (auto i = frontier.size() * chunk / chunkCount; i < frontier.size() * (chunk + 1) / chunkCount; ++i) {
+                        auto edgeNeighbours =
+                            RecordCompare::filterIncidentEdges(chunkTxn, frontier[i], direction, edgeFilter, edgeClassFilter);
+                        ++rowsScanned[chunk];
+                        indexEntries[chunk] += edgeNeighbours.size();
+                        for (const auto& edgeNeighbour : edgeNeighbours) {
+                            auto nextVertex = edgeNeighbour.second.rid;
+                            auto visit = visited.visit(nextVertex, nextLevel);
+                            if (visit.first) {
+                                claimed[chunk].insert({ nextVertex,
+                                    RecordCompare::filterRecord(chunkTxn, edgeNeighbour.second, vertexFilter, vertexClassFilter) });
+                            }
+                            if (visit.second == nextLevel) {
+                                neighbours[i].emplace_back(nextVertex);
+                            }
+                        }
+                    }
+                } catch (...) {
+                    errors[chunk] = std::current_exception();
                 }
             };
+            auto expandOnWorker = std::function<void(size_t)> { [&](size_t worker) {
+                expand(workerTxns[worker], worker + 1);
+            } };
+            workers.start(chunkCount - 1, expandOnWorker);
+            expand(txn, 0);
+            workers.wait();
+            for (const auto& error : errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
 
-            if (minDepth == 0) {
-                result.assign(recordDescriptors.cbegin(), recordDescriptors.cend());
+            for (auto chunk = size_t { 1 }; chunk < chunkCount; ++chunk) {
+                claimed[0].insert(claimed[chunk].cbegin(), claimed[chunk].cend());
+                stage.rowsScanned += rowsScanned[chunk];
+                stage.indexEntries += indexEntries[chunk];
             }
-            while (!queue.empty()) {
-                auto vertex = queue.front();
-                queue.pop();
-                for (const auto& edgeNeighbour :
-                    RecordCompare::filterIncidentEdges(txn, vertex.first.rid, direction, edgeFilter, edgeClassFilter)) {
-                    addUniqueVertex(std::make_pair(edgeNeighbour.second, vertex.second + 1));
+            stage.rowsScanned += rowsScanned[0];
+            stage.indexEntries += indexEntries[0];
+            auto nextFrontier = std::vector<RecordId> {};
+            for (const auto& vertexNeighbours : neighbours) {
+                for (const auto& nextVertex : vertexNeighbours) {
+                    auto vertex = claimed[0].find(nextVertex);
+                    if (vertex == claimed[0].cend()) {
+                        continue;
+                    }
+                    auto vertexRdesc = vertex->second;
+                    claimed[0].erase(vertex);
+                    if (vertexRdesc == RecordDescriptor {}) {
+                        continue;
+                    }
+                    if (nextLevel >= minDepth) {
+                        vertexRdesc._depth = nextLevel;
+                        result.emplace_back(vertexRdesc);
+                    }
+                    if (nextLevel < maxDepth) {
+                        nextFrontier.emplace_back(nextVertex);
+                    }
                 }
             }
+            frontier.swap(nextFrontier);
+        }
+        return result;
+    }
+
+    std::vector<Transaction> GraphTraversal::beginSnapshotTxns(const Transaction& txn, unsigned int count)
+    {
+        for (const auto& dbName : { TB_DBINFO, TB_CLASSES, TB_PROPERTIES, TB_INDEXES, TB_COMPOSITE_INDEXES,
+                 TB_TEXT_INDEXES, TB_POLYMORPHIC_INDEXES, TB_STATISTICS, TB_RELATIONS_IN, TB_RELATIONS_OUT }) {
+            txn._txnBase->shareDBi(dbName);
+        }
+        for (const auto& classInfo : txn._adapter->dbClass()->getAllInfos()) {
+            txn._txnBase->shareDBi(std::to_string(classInfo.id));
+        }
+        auto txns = std::vector<Transaction> {};
+        for (auto i = 0U; i < count; ++i) {
+            txns.emplace_back(Transaction { &txn });
+            if (txns.back()._txnBase->id() != txn._txnBase->id() || !txns.back()._txnBase->hasSharedDBi()) {
+                return std::vector<Transaction> {};
+            }
+        }
+        return txns;
+    }
+
+    ResultSet GraphTraversal::bfsShortestPath(const Transaction& txn,
+        const RecordDescriptor& srcVertexRecordDescriptor,
+        const RecordDescriptor& dstVertexRecordDescriptor,
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter,
+        bool isBidirectional,
+        QueryPlan* queryPlan)
+    {
+        return fetchRecords(txn, bfsShortestPathRdesc(txn, srcVertexRecordDescriptor, dstVertexRecordDescriptor,
+            edgeFilter, vertexFilter, isBidirectional, queryPlan), queryPlan);
+    }
+
+    std::vector<RecordDescriptor> GraphTraversal::bfsShortestPathRdesc(const Transaction& txn,
+        const RecordDescriptor& srcVertexRecordDescriptor,
+        const RecordDescriptor& dstVertexRecordDescriptor,
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter,
+        bool isBidirectional,
+        QueryPlan* queryPlan)
+    {
+        auto stopwatch = explain::Stopwatch {};
+        auto stage = PlanStage { "SHORTEST_PATH", "" };
+        auto result = std::vector<RecordDescriptor> {};
+        try {
+            if (srcVertexRecordDescriptor == dstVertexRecordDescriptor) {
+                result.emplace_back(srcVertexRecordDescriptor);
+            } else if (isBidirectional) {
+                result = bidirectionalShortestPathRdesc(
+                    txn, srcVertexRecordDescriptor, dstVertexRecordDescriptor, edgeFilter, vertexFilter, stage);
+            } else {
+                result = forwardShortestPathRdesc(
+                    txn, srcVertexRecordDescriptor, dstVertexRecordDescriptor, edgeFilter, vertexFilter, stage);
+            }
+            auto currentLevel = 0U;
+            for (auto& res : result) {
+                res._depth = currentLevel++;
+            }
         } catch (const Error& err) {
             if (err.code() == NOGDB_GRAPH_NOEXST_VERTEX) {
                 throw NOGDB_GRAPH_ERROR(NOGDB_GRAPH_UNKNOWN_ERR);
@@ -104,92 +421,348 @@ namespace algorithm {
                 throw NOGDB_FATAL_ERROR(err);
             }
         }
+        if (queryPlan != nullptr) {
+            stage.detail = "path length=" + std::to_string(result.empty() ? 0 : result.size() - 1)
+                + (isBidirectional ? ", bidirectional" : "");
+            explain::record(queryPlan, stage, result.size(), stopwatch);
+        }
         return result;
     }
 
-    ResultSet GraphTraversal::bfsShortestPath(const Transaction& txn,
+    std::vector<RecordDescriptor> GraphTraversal::forwardShortestPathRdesc(const Transaction& txn,
         const RecordDescriptor& srcVertexRecordDescriptor,
         const RecordDescriptor& dstVertexRecordDescriptor,
         const GraphFilter& edgeFilter,
-        const GraphFilter& vertexFilter)
+        const GraphFilter& vertexFilter,
+        PlanStage& stage)
     {
-        const auto searchResultDescriptor = bfsShortestPathRdesc(
-            txn, srcVertexRecordDescriptor, dstVertexRecordDescriptor, edgeFilter, vertexFilter);
+        auto result = std::vector<RecordDescriptor> {};
+        auto edgeClassFilter = RecordCompare::getFilterClasses(txn, edgeFilter);
+        auto vertexClassFilter = RecordCompare::getFilterClasses(txn, vertexFilter);
+        auto found = false;
+        auto visited = std::unordered_map<RecordId, std::pair<RecordDescriptor, RecordId>, RecordIdHash> {};
+        visited.insert({ srcVertexRecordDescriptor.rid, { RecordDescriptor {}, RecordId {} } });
+        auto queue = std::queue<RecordId> {};
+        queue.push(srcVertexRecordDescriptor.rid);
+        while (!queue.empty() && !found) {
+            auto vertex = queue.front();
+            queue.pop();
 
-        ResultSet result(searchResultDescriptor.size());
-        std::transform(searchResultDescriptor.begin(), searchResultDescriptor.end(), result.begin(),
-            [&txn](const RecordDescriptor& descriptor) {
-                const auto classInfo = txn._adapter->dbClass()->getInfo(descriptor.rid.first);
-                const auto& record = DataRecordUtils::getRecordWithBasicInfo(&txn, classInfo, descriptor);
-                record.setBasicInfo(DEPTH_PROPERTY, descriptor._depth);
-                return Result(descriptor, record);
-            });
+            auto edgeNeighbours =
+                RecordCompare::filterIncidentEdges(txn, vertex, Direction::OUT, edgeFilter, edgeClassFilter);
+            ++stage.rowsScanned;
+            stage.indexEntries += edgeNeighbours.size();
+            for (const auto& edgeNeighbour : edgeNeighbours) {
+                auto nextVertex = edgeNeighbour.second.rid;
+                if (visited.find(nextVertex) == visited.cend()) {
+                    auto vertexRdesc = RecordCompare::filterRecord(
+                        txn, nextVertex, vertexFilter, vertexClassFilter);
+                    if (vertexRdesc != RecordDescriptor {}) {
+                        visited.insert({ nextVertex, { vertexRdesc, vertex } });
+                        queue.push(nextVertex);
+                    }
+                }
+                if (nextVertex == dstVertexRecordDescriptor.rid && visited.find(nextVertex) != visited.cend()) {
+                    found = true;
+                    break;
+                }
+            }
+        }
 
+        if (found) {
+            auto vertex = dstVertexRecordDescriptor.rid;
+            while (vertex != srcVertexRecordDescriptor.rid) {
+                auto data = visited.at(vertex);
+                result.emplace_back(data.first);
+                vertex = data.second;
+            }
+            result.emplace_back(srcVertexRecordDescriptor);
+            std::reverse(result.begin(), result.end());
+        }
         return result;
     }
 
-    std::vector<RecordDescriptor> GraphTraversal::bfsShortestPathRdesc(const Transaction& txn,
+    std::vector<RecordDescriptor> GraphTraversal::bidirectionalShortestPathRdesc(const Transaction& txn,
         const RecordDescriptor& srcVertexRecordDescriptor,
         const RecordDescriptor& dstVertexRecordDescriptor,
         const GraphFilter& edgeFilter,
-        const GraphFilter& vertexFilter)
+        const GraphFilter& vertexFilter,
+        PlanStage& stage)
     {
         auto result = std::vector<RecordDescriptor> {};
-        try {
-            if (srcVertexRecordDescriptor == dstVertexRecordDescriptor) {
-                result.emplace_back(srcVertexRecordDescriptor);
-            } else {
-                auto edgeClassFilter = RecordCompare::getFilterClasses(txn, edgeFilter);
-                auto vertexClassFilter = RecordCompare::getFilterClasses(txn, vertexFilter);
-                auto found = false;
-                auto visited = std::unordered_map<RecordId, std::pair<RecordDescriptor, RecordId>, RecordIdHash> {};
-                visited.insert({ srcVertexRecordDescriptor.rid, { RecordDescriptor {}, RecordId {} } });
-                auto queue = std::queue<RecordId> {};
-                queue.push(srcVertexRecordDescriptor.rid);
-                while (!queue.empty() && !found) {
-                    auto vertex = queue.front();
-                    queue.pop();
-
-                    for (const auto& edgeNeighbour :
-                        RecordCompare::filterIncidentEdges(txn, vertex, Direction::OUT, edgeFilter, edgeClassFilter)) {
-                        auto nextVertex = edgeNeighbour.second.rid;
-                        if (visited.find(nextVertex) == visited.cend()) {
-                            auto vertexRdesc = RecordCompare::filterRecord(
-                                txn, nextVertex, vertexFilter, vertexClassFilter);
-                            if (vertexRdesc != RecordDescriptor {}) {
-                                visited.insert({ nextVertex, { vertexRdesc, vertex } });
-                                queue.push(nextVertex);
-                            }
-                        }
-                        if (nextVertex == dstVertexRecordDescriptor.rid) {
-                            found = true;
-                            break;
-                        }
-                    }
-                }
+        auto edgeClassFilter = RecordCompare::getFilterClasses(txn, edgeFilter);
+        auto vertexClassFilter = RecordCompare::getFilterClasses(txn, vertexFilter);
+        auto dstRdesc = RecordCompare::filterRecord(txn, dstVertexRecordDescriptor, vertexFilter, vertexClassFilter);
+        if (dstRdesc == RecordDescriptor {}) {
+            return result;
+        }
+        // every vertex reached from a side is kept with the vertex it was reached from
+        using Parents = std::unordered_map<RecordId, std::pair<RecordDescriptor, RecordId>, RecordIdHash>;
+        auto forwardParents = Parents {};
+        auto backwardParents = Parents {};
+        forwardParents.insert({ srcVertexRecordDescriptor.rid, { srcVertexRecordDescriptor, RecordId {} } });
+        backwardParents.insert({ dstVertexRecordDescriptor.rid, { dstRdesc, RecordId {} } });
+        auto forwardFrontier = std::vector<RecordId> { srcVertexRecordDescriptor.rid };
+        auto backwardFrontier = std::vector<RecordId> { dstVertexRecordDescriptor.rid };
+        auto rejected = std::unordered_set<RecordId, RecordIdHash> {};
+        auto meeting = RecordId {};
+        auto found = false;
 
-                if (found) {
-                    auto vertex = dstVertexRecordDescriptor.rid;
-                    while (vertex != srcVertexRecordDescriptor.rid) {
-                        auto data = visited.at(vertex);
-                        result.emplace_back(data.first);
-                        vertex = data.second;
+        auto expand = [&](std::vector<RecordId>& frontier, Parents& parents, const Parents& otherParents,
+                          const Direction& direction) {
+            auto nextFrontier = std::vector<RecordId> {};
+            for (const auto& vertex : frontier) {
+                auto edgeNeighbours =
+                    RecordCompare::filterIncidentEdges(txn, vertex, direction, edgeFilter, edgeClassFilter);
+                ++stage.rowsScanned;
+                stage.indexEntries += edgeNeighbours.size();
+                for (const auto& edgeNeighbour : edgeNeighbours) {
+                    auto nextVertex = edgeNeighbour.second.rid;
+                    if (parents.find(nextVertex) != parents.cend() || rejected.find(nextVertex) != rejected.cend()) {
+                        continue;
+                    }
+                    // the vertices reached from the other side have passed the filter already
+                    auto other = otherParents.find(nextVertex);
+                    auto vertexRdesc = (other != otherParents.cend())
+                        ? other->second.first
+                        : RecordCompare::filterRecord(txn, nextVertex, vertexFilter, vertexClassFilter);
+                    if (vertexRdesc == RecordDescriptor {}) {
+                        rejected.insert(nextVertex);
+                        continue;
                     }
-                    result.emplace_back(srcVertexRecordDescriptor);
-                    std::reverse(result.begin(), result.end());
-                    auto currentLevel = 0U;
-                    for (auto& res : result) {
-                        res._depth = currentLevel++;
+                    parents.insert({ nextVertex, { vertexRdesc, vertex } });
+                    if (other != otherParents.cend()) {
+                        meeting = nextVertex;
+                        found = true;
+                        return;
                     }
+                    nextFrontier.emplace_back(nextVertex);
                 }
             }
+            frontier.swap(nextFrontier);
+        };
+
+        while (!found && !forwardFrontier.empty() && !backwardFrontier.empty()) {
+            if (forwardFrontier.size() <= backwardFrontier.size()) {
+                expand(forwardFrontier, forwardParents, backwardParents, Direction::OUT);
+            } else {
+                expand(backwardFrontier, backwardParents, forwardParents, Direction::IN);
+            }
+        }
+
+        if (found) {
+            for (auto vertex = meeting; vertex != srcVertexRecordDescriptor.rid;) {
+                const auto& data = forwardParents.at(vertex);
+                result.emplace_back(data.first);
+                vertex = data.second;
+            }
+            result.emplace_back(srcVertexRecordDescriptor);
+            std::reverse(result.begin(), result.end());
+            for (auto vertex = meeting; vertex != dstVertexRecordDescriptor.rid;) {
+                vertex = backwardParents.at(vertex).second;
+                result.emplace_back(backwardParents.at(vertex).first);
+            }
+        }
+        return result;
+    }
+
+    ResultSet GraphTraversal::weightedShortestPath(const Transaction& txn,
+        const RecordDescriptor& srcVertexRecordDescriptor,
+        const RecordDescriptor& dstVertexRecordDescriptor,
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter,
+        const PathWeight& pathWeight,
+        QueryPlan* queryPlan)
+    {
+        return fetchRecords(txn, weightedShortestPathRdesc(txn, srcVertexRecordDescriptor, dstVertexRecordDescriptor,
+            edgeFilter, vertexFilter, pathWeight, queryPlan), queryPlan);
+    }
+
+    std::vector<RecordDescriptor> GraphTraversal::weightedShortestPathRdesc(const Transaction& txn,
+        const RecordDescriptor& srcVertexRecordDescriptor,
+        const RecordDescriptor& dstVertexRecordDescriptor,
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter,
+        const PathWeight& pathWeight,
+        QueryPlan* queryPlan)
+    {
+        auto stopwatch = explain::Stopwatch {};
+        auto stage = PlanStage { "SHORTEST_PATH", "" };
+        auto result = std::vector<RecordDescriptor> {};
+        auto totalWeight = 0.0;
+        try {
+            if (srcVertexRecordDescriptor == dstVertexRecordDescriptor) {
+                result.emplace_back(srcVertexRecordDescriptor);
+            } else {
+                result = dijkstraShortestPathRdesc(txn, srcVertexRecordDescriptor, dstVertexRecordDescriptor,
+                    edgeFilter, vertexFilter, pathWeight, stage, totalWeight);
+            }
+            auto currentLevel = 0U;
+            for (auto& res : result) {
+                res._depth = currentLevel++;
+            }
         } catch (const Error& err) {
             if (err.code() == NOGDB_GRAPH_NOEXST_VERTEX) {
                 throw NOGDB_GRAPH_ERROR(NOGDB_GRAPH_UNKNOWN_ERR);
+            } else if (err.code() == NOGDB_GRAPH_NEGATIVE_WEIGHT || err.code() == NOGDB_CTX_INVALID_PROPTYPE) {
+                throw;
             } else {
                 throw NOGDB_FATAL_ERROR(err);
             }
         }
+        if (queryPlan != nullptr) {
+            auto detail = std::ostringstream {};
+            detail << "path length=" << (result.empty() ? 0 : result.size() - 1) << ", path weight=" << totalWeight
+                   << ((pathWeight.heuristic != nullptr) ? ", a*" : ", dijkstra");
+            stage.detail = detail.str();
+            explain::record(queryPlan, stage, result.size(), stopwatch);
+        }
+        return result;
+    }
+
+    std::vector<RecordDescriptor> GraphTraversal::dijkstraShortestPathRdesc(const Transaction& txn,
+        const RecordDescriptor& srcVertexRecordDescriptor,
+        const RecordDescriptor& dstVertexRecordDescriptor,
+        const GraphFilter& edgeFilter,
+        const GraphFilter& vertexFilter,
+        const PathWeight& pathWeight,
+        PlanStage& stage,
+        double& totalWeight)
+    {
+        auto result = std::vector<RecordDescriptor> {};
+        auto edgeClassFilter = RecordCompare::getFilterClasses(txn, edgeFilter);
+        auto vertexClassFilter = RecordCompare::getFilterClasses(txn, vertexFilter);
+        auto dstRdesc = RecordCompare::filterRecord(txn, dstVertexRecordDescriptor, vertexFilter, vertexClassFilter);
+        if (dstRdesc == RecordDescriptor {}) {
+            return result;
+        }
+        auto toRecord = [&txn](const RecordDescriptor& descriptor) {
+            const auto classInfo = txn._adapter->dbClass()->getInfo(descriptor.rid.first);
+            return DataRecordUtils::getRecordWithBasicInfo(&txn, classInfo, descriptor);
+        };
+        const auto dstRecord = (pathWeight.heuristic != nullptr) ? toRecord(dstRdesc) : Record {};
+        auto estimate = [&](const RecordDescriptor& vertex) {
+            return (pathWeight.heuristic != nullptr) ? (*pathWeight.heuristic)(toRecord(vertex), dstRecord) : 0.0;
+        };
+
+        // the weight property of every edge class met so far, or an undefined one if the class has none
+        auto weightProperties = std::unordered_map<ClassId, PropertyAccessInfo> {};
+        auto enableVersion = txn._txnCtx->isVersionEnabled();
+        auto getWeight = [&](const RecordDescriptor& edge, double& weight) {
+            auto weightProperty = weightProperties.find(edge.rid.first);
+            if (weightProperty == weightProperties.cend()) {
+                const auto classInfo = txn._adapter->dbClass()->getInfo(edge.rid.first);
+                const auto propertyInfos = SchemaUtils::getPropertyNameMapInfo(&txn, classInfo.id, classInfo.superClassId);
+                const auto propertyInfo = propertyInfos.find(pathWeight.propertyName);
+                auto info = (propertyInfo != propertyInfos.cend()) ? propertyInfo->second : PropertyAccessInfo {};
+                if (info.type == PropertyType::TEXT || info.type == PropertyType::BLOB) {
+                    throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_PROPTYPE);
+                }
+                weightProperty = weightProperties.emplace(edge.rid.first, info).first;
+            }
+            const auto& info = weightProperty->second;
+            auto value = std::make_pair(static_cast<const unsigned char*>(nullptr), size_t { 0 });
+            auto rawData = storage_engine::lmdb::Result {};
+            if (info.type != PropertyType::UNDEFINED) {
+                rawData = DataRecord(txn._txnBase, edge.rid.first, ClassType::EDGE).getResult(edge.rid.second);
+                value = RecordParser::parseRawDataPropertyValue(rawData, info.id, ClassType::EDGE, enableVersion);
+            }
+            if (value.first == nullptr) {
+                weight = pathWeight.defaultWeight;
+                return pathWeight.hasDefaultWeight;
+            }
+            weight = RecordParser::parseNumericValue(Bytes { value.first, value.second }, info.type);
+            return true;
+        };
+
+        // entries are (weight from the source plus estimate, weight from the source, vertex), the lightest first
+        using QueueEntry = std::tuple<double, double, RecordId>;
+        auto queue = std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> {};
+        auto distances = std::unordered_map<RecordId, double, RecordIdHash> {};
+        auto estimates = std::unordered_map<RecordId, double, RecordIdHash> {};
+        auto parents = std::unordered_map<RecordId, std::pair<RecordDescriptor, RecordId>, RecordIdHash> {};
+        auto rejected = std::unordered_set<RecordId, RecordIdHash> {};
+        distances.insert({ srcVertexRecordDescriptor.rid, 0.0 });
+        parents.insert({ srcVertexRecordDescriptor.rid, { srcVertexRecordDescriptor, RecordId {} } });
+        queue.emplace(estimate(srcVertexRecordDescriptor), 0.0, srcVertexRecordDescriptor.rid);
+        auto found = false;
+        while (!queue.empty()) {
+            auto distance = std::get<1>(queue.top());
+            auto vertex = std::get<2>(queue.top());
+            queue.pop();
+            // a lighter path to the vertex has been queued after this entry
+            if (distance > distances.at(vertex)) {
+                continue;
+            }
+            if (vertex == dstVertexRecordDescriptor.rid) {
+                totalWeight = distance;
+                found = true;
+                break;
+            }
+            auto edgeNeighbours =
+                RecordCompare::filterIncidentEdges(txn, vertex, Direction::OUT, edgeFilter, edgeClassFilter);
+            ++stage.rowsScanned;
+            stage.indexEntries += edgeNeighbours.size();
+            for (const auto& edgeNeighbour : edgeNeighbours) {
+                auto nextVertex = edgeNeighbour.second.rid;
+                auto weight = 0.0;
+                if (rejected.find(nextVertex) != rejected.cend() || !getWeight(edgeNeighbour.first, weight)) {
+                    continue;
+                }
+                // a NaN weight has no order against the distances, so it is rejected like a negative one
+                if (!(weight >= 0.0)) {
+                    throw NOGDB_GRAPH_ERROR(NOGDB_GRAPH_NEGATIVE_WEIGHT);
+                }
+                auto nextDistance = distance + weight;
+                auto visited = distances.find(nextVertex);
+                if (visited != distances.cend() && visited->second <= nextDistance) {
+                    continue;
+                }
+                auto parent = parents.find(nextVertex);
+                if (parent == parents.cend()) {
+                    auto vertexRdesc = (nextVertex == dstVertexRecordDescriptor.rid)
+                        ? dstRdesc
+                        : RecordCompare::filterRecord(txn, nextVertex, vertexFilter, vertexClassFilter);
+                    if (vertexRdesc == RecordDescriptor {}) {
+                        rejected.insert(nextVertex);
+                        continue;
+                    }
+                    parent = parents.insert({ nextVertex, { vertexRdesc, vertex } }).first;
+                    estimates.insert({ nextVertex, estimate(vertexRdesc) });
+                } else {
+                    parent->second.second = vertex;
+                }
+                distances[nextVertex] = nextDistance;
+                queue.emplace(nextDistance + estimates.at(nextVertex), nextDistance, nextVertex);
+            }
+        }
+
+        if (found) {
+            for (auto vertex = dstVertexRecordDescriptor.rid; vertex != srcVertexRecordDescriptor.rid;) {
+                const auto& data = parents.at(vertex);
+                result.emplace_back(data.first);
+                vertex = data.second;
+            }
+            result.emplace_back(srcVertexRecordDescriptor);
+            std::reverse(result.begin(), result.end());
+        }
+        return result;
+    }
+
+    ResultSet GraphTraversal::fetchRecords(const Transaction& txn,
+        const std::vector<RecordDescriptor>& recordDescriptors,
+        QueryPlan* queryPlan)
+    {
+        auto stopwatch = explain::Stopwatch {};
+        ResultSet result(recordDescriptors.size());
+        std::transform(recordDescriptors.begin(), recordDescriptors.end(), result.begin(),
+            [&txn](const RecordDescriptor& descriptor) {
+                const auto classInfo = txn._adapter->dbClass()->getInfo(descriptor.rid.first);
+                const auto& record = DataRecordUtils::getRecordWithBasicInfo(&txn, classInfo, descriptor);
+                record.setBasicInfo(DEPTH_PROPERTY, descriptor._depth);
+                return Result(descriptor, record);
+            });
+        explain::recordRead(queryPlan, "FETCH", "", result.size(), result.size(), result.size(), stopwatch);
         return result;
     }
 }
@@ -25,6 +25,8 @@
 #include <queue>
 #include <set>
 #include <stack>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -32,6 +34,7 @@
 #include "compare.hpp"
 #include "constant.hpp"
 #include "datarecord.hpp"
+#include "explain.hpp"
 #include "lmdb_engine.hpp"
 #include "parser.hpp"
 #include "relation.hpp"
@@ -45,6 +48,21 @@ namespace algorithm {
     using namespace adapter::schema;
     using namespace adapter::relation;
 
+    /**
+     * The numeric edge property a weighted shortest path sums up, and the optional A* estimate of
+     * the remaining weight from a vertex to the destination.
+     */
+    struct PathWeight {
+        std::string propertyName {};
+        bool hasDefaultWeight { false };
+        double defaultWeight { 0.0 };
+        double (*heuristic)(const Record& vertex, const Record& destination) { nullptr };
+    };
+
+    /**
+     * If queryPlan is not null, the search stage (vertices visited and adjacency entries read)
+     * and the fetch stage of the get() variants are appended to it.
+     */
     class GraphTraversal {
     public:
         GraphTraversal() = delete;
@@ -57,7 +75,9 @@ namespace algorithm {
             unsigned int maxDepth,
             const Direction& direction,
             const GraphFilter& edgeFilter,
-            const GraphFilter& vertexFilter);
+            const GraphFilter& vertexFilter,
+            unsigned int nThreads = 1,
+            QueryPlan* queryPlan = nullptr);
 
         static std::vector<RecordDescriptor> breadthFirstSearchRdesc(const Transaction& txn,
             const std::set<RecordDescriptor>& recordDescriptors,
@@ -65,19 +85,113 @@ namespace algorithm {
             unsigned int maxDepth,
             const Direction& direction,
             const GraphFilter& edgeFilter,
-            const GraphFilter& vertexFilter);
+            const GraphFilter& vertexFilter,
+            unsigned int nThreads = 1,
+            QueryPlan* queryPlan = nullptr);
 
         static ResultSet bfsShortestPath(const Transaction& txn,
             const RecordDescriptor& srcVertexRecordDescriptor,
             const RecordDescriptor& dstVertexRecordDescriptor,
             const GraphFilter& edgeFilter,
-            const GraphFilter& vertexFilter);
+            const GraphFilter& vertexFilter,
+            bool isBidirectional = true,
+            QueryPlan* queryPlan = nullptr);
 
         static std::vector<RecordDescriptor> bfsShortestPathRdesc(const Transaction& txn,
             const RecordDescriptor& srcVertexRecordDescriptor,
             const RecordDescriptor& dstVertexRecordDescriptor,
             const GraphFilter& edgeFilter,
-            const GraphFilter& vertexFilter);
+            const GraphFilter& vertexFilter,
+            bool isBidirectional = true,
+            QueryPlan* queryPlan = nullptr);
+
+        static ResultSet weightedShortestPath(const Transaction& txn,
+            const RecordDescriptor& srcVertexRecordDescriptor,
+            const RecordDescriptor& dstVertexRecordDescriptor,
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter,
+            const PathWeight& pathWeight,
+            QueryPlan* queryPlan = nullptr);
+
+        static std::vector<RecordDescriptor> weightedShortestPathRdesc(const Transaction& txn,
+            const RecordDescriptor& srcVertexRecordDescriptor,
+            const RecordDescriptor& dstVertexRecordDescriptor,
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter,
+            const PathWeight& pathWeight,
+            QueryPlan* queryPlan = nullptr);
+
+    private:
+        static std::vector<RecordDescriptor> sequentialBreadthFirstSearchRdesc(const Transaction& txn,
+            const std::set<RecordDescriptor>& recordDescriptors,
+            unsigned int minDepth,
+            unsigned int maxDepth,
+            const Direction& direction,
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter,
+            PlanStage& stage);
+
+        /**
+         * Expand the frontier of each depth in contiguous chunks, the first on the calling thread and the others
+         * on threads which are started once for the traversal and read through the worker transactions. A vertex is filtered by the chunk which first claims it
+         * in the shared visited set, and the claimed vertices are then collected in the order of the frontier and
+         * of its edges, which is the order in which the sequential search reaches them.
+         */
+        static std::vector<RecordDescriptor> parallelBreadthFirstSearchRdesc(const Transaction& txn,
+            const std::vector<Transaction>& workerTxns,
+            const std::set<RecordDescriptor>& recordDescriptors,
+            unsigned int minDepth,
+            unsigned int maxDepth,
+            const Direction& direction,
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter,
+            PlanStage& stage);
+
+        /**
+         * Begin read-only transactions on the snapshot of a read-only transaction, which opens every database they
+         * read for them, as none may be opened by another transaction while it is running. None is returned if a
+         * write has been committed since the transaction began, as a new transaction would read the newer snapshot,
+         * or if the transaction is the first to open one of the databases, which the others cannot use until it ends.
+         */
+        static std::vector<Transaction> beginSnapshotTxns(const Transaction& txn, unsigned int count);
+
+        static std::vector<RecordDescriptor> forwardShortestPathRdesc(const Transaction& txn,
+            const RecordDescriptor& srcVertexRecordDescriptor,
+            const RecordDescriptor& dstVertexRecordDescriptor,
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter,
+            PlanStage& stage);
+
+        /**
+         * Expand the source along out-edges and the destination along in-edges, a whole level of the smaller
+         * frontier at a time. The first vertex reached from both sides lies on a shortest path, since a shorter
+         * one would have met at a vertex of an earlier level. The vertex filter applies to every vertex but the source.
+         */
+        static std::vector<RecordDescriptor> bidirectionalShortestPathRdesc(const Transaction& txn,
+            const RecordDescriptor& srcVertexRecordDescriptor,
+            const RecordDescriptor& dstVertexRecordDescriptor,
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter,
+            PlanStage& stage);
+
+        /**
+         * Dijkstra's search along out-edges, ordered by the weight from the source plus the heuristic estimate.
+         * A vertex is queued again whenever a lighter path to it is found, so an estimate which is admissible
+         * but not consistent still yields the lightest path once the destination is taken off the queue.
+         * Edge weights are decoded from the weight property alone and only for the edges being relaxed.
+         */
+        static std::vector<RecordDescriptor> dijkstraShortestPathRdesc(const Transaction& txn,
+            const RecordDescriptor& srcVertexRecordDescriptor,
+            const RecordDescriptor& dstVertexRecordDescriptor,
+            const GraphFilter& edgeFilter,
+            const GraphFilter& vertexFilter,
+            const PathWeight& pathWeight,
+            PlanStage& stage,
+            double& totalWeight);
+
+        static ResultSet fetchRecords(const Transaction& txn,
+            const std::vector<RecordDescriptor>& recordDescriptors,
+            QueryPlan* queryPlan);
     };
 }
 }
\ No newline at end of file
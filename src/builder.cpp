@@ -65,6 +65,12 @@ FindOperationBuilder& FindOperationBuilder::indexed(bool onlyIndex)
     return *this;
 }
 
+FindOperationBuilder& FindOperationBuilder::select(const std::vector<std::string>& propertyNames)
+{
+    _projection = propertyNames;
+    return *this;
+}
+
 FindEdgeOperationBuilder::FindEdgeOperationBuilder(const Transaction* txn,
     const RecordDescriptor& recordDescriptor,
     const EdgeDirection& direction)
@@ -126,6 +132,12 @@ TraverseOperationBuilder& TraverseOperationBuilder::depth(unsigned int minDepth,
     return *this;
 }
 
+TraverseOperationBuilder& TraverseOperationBuilder::parallel(unsigned int nThreads)
+{
+    _nThreads = nThreads;
+    return *this;
+}
+
 ShortestPathOperationBuilder::ShortestPathOperationBuilder(const Transaction* txn,
     const RecordDescriptor& srcVertexRecordDescriptor,
     const RecordDescriptor& dstVertexRecordDescriptor)
@@ -147,4 +159,32 @@ ShortestPathOperationBuilder& ShortestPathOperationBuilder::whereE(const GraphFi
     return *this;
 }
 
+ShortestPathOperationBuilder& ShortestPathOperationBuilder::bidirectional(bool isBidirectional)
+{
+    _bidirectional = isBidirectional;
+    return *this;
+}
+
+ShortestPathOperationBuilder& ShortestPathOperationBuilder::weight(const std::string& propertyName)
+{
+    _weightPropertyName = propertyName;
+    _hasDefaultWeight = false;
+    return *this;
+}
+
+ShortestPathOperationBuilder& ShortestPathOperationBuilder::weight(const std::string& propertyName, double defaultWeight)
+{
+    _weightPropertyName = propertyName;
+    _hasDefaultWeight = true;
+    _defaultWeight = defaultWeight;
+    return *this;
+}
+
+ShortestPathOperationBuilder& ShortestPathOperationBuilder::heuristic(
+    double (*estimate)(const Record& vertex, const Record& destination))
+{
+    _heuristic = estimate;
+    return *this;
+}
+
 }
\ No newline at end of file
@@ -23,10 +23,12 @@
 
 #include "constant.hpp"
 #include "datarecord_adapter.hpp"
+#include "index.hpp"
 #include "lmdb_engine.hpp"
 #include "parser.hpp"
 #include "relation.hpp"
 #include "schema.hpp"
+#include "statistics.hpp"
 #include "validate.hpp"
 
 #include "nogdb/nogdb.h"
@@ -36,7 +38,9 @@ using namespace utils::assertion;
 using namespace adapter::schema;
 using namespace adapter::datarecord;
 using namespace schema;
+using index::IndexUtils;
 using parser::RecordParser;
+using statistics::StatisticsUtils;
 
 const ClassDescriptor Transaction::addClass(const std::string& className, ClassType type)
 {
@@ -104,10 +108,20 @@ void Transaction::dropClass(const std::string& className)
     for (const auto& property : propertyInfos) {
         // check if all index tables associated with the column have been removed beforehand
         auto foundIndex = _adapter->dbIndex()->getInfo(foundClass.id, property.id);
-        if (foundIndex.id != IndexId { 0 }) {
+        auto foundTextIndex = _adapter->dbTextIndex()->getInfo(foundClass.id, property.id);
+        auto foundPolymorphicIndex = _adapter->dbPolymorphicIndex()->getInfo(foundClass.id, property.id);
+        if (foundIndex.id != IndexId { 0 } || foundTextIndex.id != IndexId { 0 }
+            || foundPolymorphicIndex.id != IndexId { 0 }) {
             throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_IN_USED_PROPERTY);
         }
     }
+    if (!_adapter->dbCompositeIndex()->getInfos(foundClass.id).empty()) {
+        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_IN_USED_PROPERTY);
+    }
+    // the records of the class are also kept by the polymorphic indexes of its superclasses
+    auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(this, foundClass.id, foundClass.superClassId);
+    auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(this, foundClass.id, foundClass.superClassId);
+    auto polymorphicIndexInfos = IndexUtils::getPolymorphicIndexInfos(this, foundClass.id, propertyNameMapInfo);
     try {
         auto rids = std::vector<RecordId> {};
         // delete class from schema
@@ -117,11 +131,18 @@ void Transaction::dropClass(const std::string& className)
             _adapter->dbProperty()->remove(property.classId, property.name);
             //TODO: implement existing index deletion if needed
         }
+        // delete statistics of the class
+        StatisticsUtils::remove(this, foundClass.id);
         // delete all associated relations
         auto table = DataRecord(_txnBase, foundClass.id, foundClass.type);
         std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
             [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
                 auto recordId = RecordId { foundClass.id, positionId };
+                if (!polymorphicIndexInfos.empty()) {
+                    auto record = RecordParser::parseRawData(
+                        result, propertyIdMapInfo, foundClass.type == ClassType::EDGE, _txnCtx->isVersionEnabled());
+                    IndexUtils::removePolymorphic(this, RecordDescriptor { recordId }, record, polymorphicIndexInfos);
+                }
                 if (foundClass.type == ClassType::EDGE) {
                     auto vertices = RecordParser::parseEdgeRawDataVertexSrcDst(result, _txnCtx->isVersionEnabled());
                     _graph->removeRelFromEdge(recordId, vertices.first, vertices.second);
@@ -209,4 +230,24 @@ void Transaction::renameClass(const std::string& oldClassName, const std::string
         std::rethrow_exception(std::current_exception());
     }
 }
+
+const ClassStatistics Transaction::analyze(const std::string& className)
+{
+    BEGIN_VALIDATION(this)
+        .isTxnValid()
+        .isTxnCompleted()
+        .isClassNameValid(className);
+
+    auto foundClass = SchemaUtils::getExistingClass(this, className);
+    try {
+        return StatisticsUtils::analyze(this, foundClass);
+    } catch (const Error& err) {
+        rollback();
+        throw NOGDB_FATAL_ERROR(err);
+    } catch (...) {
+        rollback();
+        std::rethrow_exception(std::current_exception());
+    }
+}
+
 }
@@ -0,0 +1,243 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstring>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "column.hpp"
+#include "utils.hpp"
+
+namespace nogdb {
+namespace column {
+    using namespace utils::assertion;
+
+    namespace {
+        inline size_t emitSelection(uint32_t mask, size_t base, uint16_t* selection, size_t count)
+        {
+            while (mask != 0) {
+                selection[count++] = static_cast<uint16_t>(base + static_cast<size_t>(__builtin_ctz(mask)));
+                mask &= mask - 1;
+            }
+            return count;
+        }
+
+        template <typename T>
+        inline bool inRange(T value, const T& lower, const T& upper, bool lowerInclusive, bool upperInclusive)
+        {
+            return (value > lower || (lowerInclusive && value == lower))
+                && (value < upper || (upperInclusive && value == upper));
+        }
+
+#ifdef __AVX2__
+        inline uint32_t nullMask4(const uint8_t* nulls)
+        {
+            return static_cast<uint32_t>(nulls[0]) | (static_cast<uint32_t>(nulls[1]) << 1)
+                | (static_cast<uint32_t>(nulls[2]) << 2) | (static_cast<uint32_t>(nulls[3]) << 3);
+        }
+#endif
+    }
+
+    bool ColumnBlock::isColumnType(PropertyType type)
+    {
+        switch (type) {
+        case PropertyType::TINYINT:
+        case PropertyType::UNSIGNED_TINYINT:
+        case PropertyType::SMALLINT:
+        case PropertyType::UNSIGNED_SMALLINT:
+        case PropertyType::INTEGER:
+        case PropertyType::UNSIGNED_INTEGER:
+        case PropertyType::BIGINT:
+        case PropertyType::UNSIGNED_BIGINT:
+        case PropertyType::REAL:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    void ColumnBlock::append(const unsigned char* value, size_t size, PropertyType type)
+    {
+        require(_size < COLUMN_BLOCK_SIZE);
+        auto index = _size++;
+        _values[index] = 0;
+        _realValues[index] = 0.0;
+        if (value == nullptr || size == 0) {
+            _nulls[index] = 1;
+            return;
+        }
+        _nulls[index] = 0;
+        switch (type) {
+        case PropertyType::TINYINT:
+            _values[index] = decodeColumnValue<int8_t>(value, size);
+            break;
+        case PropertyType::UNSIGNED_TINYINT:
+            _values[index] = decodeColumnValue<uint8_t>(value, size);
+            break;
+        case PropertyType::SMALLINT:
+            _values[index] = decodeColumnValue<int16_t>(value, size);
+            break;
+        case PropertyType::UNSIGNED_SMALLINT:
+            _values[index] = decodeColumnValue<uint16_t>(value, size);
+            break;
+        case PropertyType::INTEGER:
+            _values[index] = decodeColumnValue<int32_t>(value, size);
+            break;
+        case PropertyType::UNSIGNED_INTEGER:
+            _values[index] = decodeColumnValue<uint32_t>(value, size);
+            break;
+        case PropertyType::BIGINT:
+            _values[index] = decodeColumnValue<int64_t>(value, size);
+            break;
+        case PropertyType::UNSIGNED_BIGINT:
+            _values[index] = flipSignBit(decodeColumnValue<uint64_t>(value, size));
+            break;
+        case PropertyType::REAL:
+            _realValues[index] = decodeColumnValue<double>(value, size);
+            break;
+        default:
+            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_PROPTYPE);
+        }
+    }
+
+    size_t ColumnBlock::select(const ColumnPredicate& predicate, uint16_t* selection) const
+    {
+        if (predicate.isIn) {
+            return selectIn(predicate, selection);
+        } else if (predicate.isReal) {
+            return selectRealRange(predicate, selection);
+        } else {
+            return selectRange(predicate, selection);
+        }
+    }
+
+    size_t ColumnBlock::selectRange(const ColumnPredicate& predicate, uint16_t* selection) const
+    {
+        auto count = size_t { 0 };
+        auto index = size_t { 0 };
+        const auto negativeMask = predicate.isNegative ? uint32_t { 0xf } : uint32_t { 0 };
+#ifdef __AVX2__
+        const auto lower = _mm256_set1_epi64x(predicate.lower);
+        const auto upper = _mm256_set1_epi64x(predicate.upper);
+        const auto lowerInclusive = _mm256_set1_epi64x(predicate.lowerInclusive ? -1 : 0);
+        const auto upperInclusive = _mm256_set1_epi64x(predicate.upperInclusive ? -1 : 0);
+        for (; index + 4 <= _size; index += 4) {
+            const auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_values + index));
+            const auto aboveLower = _mm256_or_si256(_mm256_cmpgt_epi64(values, lower),
+                _mm256_and_si256(lowerInclusive, _mm256_cmpeq_epi64(values, lower)));
+            const auto belowUpper = _mm256_or_si256(_mm256_cmpgt_epi64(upper, values),
+                _mm256_and_si256(upperInclusive, _mm256_cmpeq_epi64(values, upper)));
+            auto mask = static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_and_si256(aboveLower, belowUpper))));
+            mask = (mask ^ negativeMask) & ~nullMask4(_nulls + index) & 0xf;
+            count = emitSelection(mask, index, selection, count);
+        }
+#endif
+        for (; index < _size; ++index) {
+            if (!_nulls[index]
+                && (inRange(_values[index], predicate.lower, predicate.upper, predicate.lowerInclusive, predicate.upperInclusive)
+                       ^ predicate.isNegative)) {
+                selection[count++] = static_cast<uint16_t>(index);
+            }
+        }
+        return count;
+    }
+
+    size_t ColumnBlock::selectRealRange(const ColumnPredicate& predicate, uint16_t* selection) const
+    {
+        auto count = size_t { 0 };
+        auto index = size_t { 0 };
+        const auto negativeMask = predicate.isNegative ? uint32_t { 0xf } : uint32_t { 0 };
+#ifdef __AVX2__
+        const auto lower = _mm256_set1_pd(predicate.lowerReal);
+        const auto upper = _mm256_set1_pd(predicate.upperReal);
+        const auto lowerInclusive = _mm256_castsi256_pd(_mm256_set1_epi64x(predicate.lowerInclusive ? -1 : 0));
+        const auto upperInclusive = _mm256_castsi256_pd(_mm256_set1_epi64x(predicate.upperInclusive ? -1 : 0));
+        for (; index + 4 <= _size; index += 4) {
+            const auto values = _mm256_loadu_pd(_realValues + index);
+            const auto aboveLower = _mm256_or_pd(_mm256_cmp_pd(values, lower, _CMP_GT_OQ),
+                _mm256_and_pd(lowerInclusive, _mm256_cmp_pd(values, lower, _CMP_EQ_OQ)));
+            const auto belowUpper = _mm256_or_pd(_mm256_cmp_pd(values, upper, _CMP_LT_OQ),
+                _mm256_and_pd(upperInclusive, _mm256_cmp_pd(values, upper, _CMP_EQ_OQ)));
+            auto mask = static_cast<uint32_t>(_mm256_movemask_pd(_mm256_and_pd(aboveLower, belowUpper)));
+            mask = (mask ^ negativeMask) & ~nullMask4(_nulls + index) & 0xf;
+            count = emitSelection(mask, index, selection, count);
+        }
+#endif
+        for (; index < _size; ++index) {
+            if (!_nulls[index]
+                && (inRange(_realValues[index], predicate.lowerReal, predicate.upperReal, predicate.lowerInclusive, predicate.upperInclusive)
+                       ^ predicate.isNegative)) {
+                selection[count++] = static_cast<uint16_t>(index);
+            }
+        }
+        return count;
+    }
+
+    size_t ColumnBlock::selectIn(const ColumnPredicate& predicate, uint16_t* selection) const
+    {
+        auto count = size_t { 0 };
+        auto index = size_t { 0 };
+        const auto negativeMask = predicate.isNegative ? uint32_t { 0xf } : uint32_t { 0 };
+#ifdef __AVX2__
+        for (; index + 4 <= _size; index += 4) {
+            auto matched = _mm256_setzero_pd();
+            if (predicate.isReal) {
+                const auto values = _mm256_loadu_pd(_realValues + index);
+                for (const auto& value : predicate.inRealValues) {
+                    matched = _mm256_or_pd(matched, _mm256_cmp_pd(values, _mm256_set1_pd(value), _CMP_EQ_OQ));
+                }
+            } else {
+                const auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_values + index));
+                for (const auto& value : predicate.inValues) {
+                    matched = _mm256_or_pd(matched,
+                        _mm256_castsi256_pd(_mm256_cmpeq_epi64(values, _mm256_set1_epi64x(value))));
+                }
+            }
+            auto mask = static_cast<uint32_t>(_mm256_movemask_pd(matched));
+            mask = (mask ^ negativeMask) & ~nullMask4(_nulls + index) & 0xf;
+            count = emitSelection(mask, index, selection, count);
+        }
+#endif
+        for (; index < _size; ++index) {
+            if (_nulls[index]) {
+                continue;
+            }
+            auto matched = false;
+            if (predicate.isReal) {
+                for (const auto& value : predicate.inRealValues) {
+                    matched |= (_realValues[index] == value);
+                }
+            } else {
+                for (const auto& value : predicate.inValues) {
+                    matched |= (_values[index] == value);
+                }
+            }
+            if (matched ^ predicate.isNegative) {
+                selection[count++] = static_cast<uint16_t>(index);
+            }
+        }
+        return count;
+    }
+
+}
+}
@@ -0,0 +1,115 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "nogdb/nogdb_types.h"
+
+namespace nogdb {
+namespace column {
+
+    constexpr size_t COLUMN_BLOCK_SIZE = 1024;
+
+    /**
+     * A numeric predicate normalised for column evaluation. Integer properties are widened
+     * to int64_t (UNSIGNED_BIGINT has its sign bit flipped to preserve the order) and REAL
+     * properties are kept as double. Every range comparator is expressed as lower/upper bounds.
+     */
+    struct ColumnPredicate {
+        bool isReal { false };
+        bool isNegative { false };
+        bool isIn { false };
+        bool lowerInclusive { true };
+        bool upperInclusive { true };
+        int64_t lower { std::numeric_limits<int64_t>::min() };
+        int64_t upper { std::numeric_limits<int64_t>::max() };
+        double lowerReal { -std::numeric_limits<double>::infinity() };
+        double upperReal { std::numeric_limits<double>::infinity() };
+        std::vector<int64_t> inValues {};
+        std::vector<double> inRealValues {};
+    };
+
+    /**
+     * A block of up to COLUMN_BLOCK_SIZE values of one property decoded from consecutive records.
+     * Records without the property (or with an empty value) are marked as null and never selected.
+     */
+    class ColumnBlock {
+    public:
+        ColumnBlock() = default;
+
+        ~ColumnBlock() noexcept = default;
+
+        void clear() noexcept
+        {
+            _size = 0;
+        }
+
+        size_t size() const noexcept
+        {
+            return _size;
+        }
+
+        bool full() const noexcept
+        {
+            return _size == COLUMN_BLOCK_SIZE;
+        }
+
+        // append a raw property value, or nullptr for a null value
+        void append(const unsigned char* value, size_t size, PropertyType type);
+
+        // fill selection with indexes of rows satisfying the predicate and return the number of selected rows
+        size_t select(const ColumnPredicate& predicate, uint16_t* selection) const;
+
+        static bool isColumnType(PropertyType type);
+
+    private:
+        size_t _size { 0 };
+        int64_t _values[COLUMN_BLOCK_SIZE];
+        double _realValues[COLUMN_BLOCK_SIZE];
+        uint8_t _nulls[COLUMN_BLOCK_SIZE];
+
+        size_t selectRange(const ColumnPredicate& predicate, uint16_t* selection) const;
+
+        size_t selectRealRange(const ColumnPredicate& predicate, uint16_t* selection) const;
+
+        size_t selectIn(const ColumnPredicate& predicate, uint16_t* selection) const;
+    };
+
+    template <typename T>
+    inline T decodeColumnValue(const unsigned char* value, size_t size)
+    {
+        auto result = T {};
+        memcpy(&result, value, (size < sizeof(T)) ? size : sizeof(T));
+        return result;
+    }
+
+    inline int64_t flipSignBit(uint64_t value)
+    {
+        return static_cast<int64_t>(value ^ (uint64_t { 1 } << 63));
+    }
+
+}
+}
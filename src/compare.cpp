@@ -24,6 +24,7 @@
 
 #include "compare.hpp"
 #include "datarecord.hpp"
+#include "explain.hpp"
 #include "index.hpp"
 #include "relation.hpp"
 #include "schema.hpp"
@@ -95,6 +96,185 @@ namespace compare {
         return compareRecordByCondition(record, foundProperty->second.type, condition);
     }
 
+    bool RecordCompare::isColumnComparable(const PropertyType& propertyType, const Condition& condition)
+    {
+        if (!column::ColumnBlock::isColumnType(propertyType)) {
+            return false;
+        }
+        switch (condition.comp) {
+        case Condition::Comparator::EQUAL:
+        case Condition::Comparator::GREATER:
+        case Condition::Comparator::GREATER_EQUAL:
+        case Condition::Comparator::LESS:
+        case Condition::Comparator::LESS_EQUAL:
+            return !condition.valueBytes.empty();
+        case Condition::Comparator::BETWEEN:
+        case Condition::Comparator::BETWEEN_NO_LOWER:
+        case Condition::Comparator::BETWEEN_NO_UPPER:
+        case Condition::Comparator::BETWEEN_NO_BOUND:
+            return condition.valueSet.size() == 2;
+        case Condition::Comparator::IN:
+            // a negated IN holds when any of the values differs, which is not a set membership
+            return !condition.isNegative;
+        default:
+            return false;
+        }
+    }
+
+    bool RecordCompare::isComparable(const PropertyType& propertyType, const Condition& condition)
+    {
+        auto valueSize = size_t { 0 };
+        switch (propertyType) {
+        case PropertyType::TINYINT:
+        case PropertyType::UNSIGNED_TINYINT:
+            valueSize = sizeof(uint8_t);
+            break;
+        case PropertyType::SMALLINT:
+        case PropertyType::UNSIGNED_SMALLINT:
+            valueSize = sizeof(uint16_t);
+            break;
+        case PropertyType::INTEGER:
+        case PropertyType::UNSIGNED_INTEGER:
+            valueSize = sizeof(uint32_t);
+            break;
+        case PropertyType::BIGINT:
+        case PropertyType::UNSIGNED_BIGINT:
+            valueSize = sizeof(uint64_t);
+            break;
+        case PropertyType::REAL:
+            valueSize = sizeof(double);
+            break;
+        case PropertyType::TEXT:
+        case PropertyType::BLOB:
+            valueSize = 1;
+            break;
+        default:
+            return false;
+        }
+        auto isValueValid = [&](const Bytes& value) { return value.size() >= valueSize; };
+        switch (condition.comp) {
+        case Condition::Comparator::IS_NULL:
+        case Condition::Comparator::NOT_NULL:
+            return true;
+        case Condition::Comparator::EQUAL:
+            return isValueValid(condition.valueBytes);
+        case Condition::Comparator::GREATER:
+        case Condition::Comparator::GREATER_EQUAL:
+        case Condition::Comparator::LESS:
+        case Condition::Comparator::LESS_EQUAL:
+            return propertyType != PropertyType::BLOB && isValueValid(condition.valueBytes);
+        case Condition::Comparator::CONTAIN:
+        case Condition::Comparator::BEGIN_WITH:
+        case Condition::Comparator::END_WITH:
+        case Condition::Comparator::LIKE:
+        case Condition::Comparator::REGEX:
+            return propertyType == PropertyType::TEXT && isValueValid(condition.valueBytes);
+        case Condition::Comparator::IN:
+            return !condition.valueSet.empty()
+                && std::all_of(condition.valueSet.cbegin(), condition.valueSet.cend(), isValueValid);
+        case Condition::Comparator::BETWEEN:
+        case Condition::Comparator::BETWEEN_NO_LOWER:
+        case Condition::Comparator::BETWEEN_NO_UPPER:
+        case Condition::Comparator::BETWEEN_NO_BOUND:
+            return propertyType != PropertyType::BLOB && condition.valueSet.size() == 2
+                && isValueValid(condition.valueSet[0]) && isValueValid(condition.valueSet[1]);
+        default:
+            return false;
+        }
+    }
+
+    column::ColumnPredicate RecordCompare::getColumnPredicate(const PropertyType& propertyType, const Condition& condition)
+    {
+        auto predicate = column::ColumnPredicate {};
+        predicate.isReal = (propertyType == PropertyType::REAL);
+        predicate.isNegative = condition.isNegative;
+        auto toColumnValue = [&](const Bytes& bytes) -> int64_t {
+            switch (propertyType) {
+            case PropertyType::TINYINT:
+                return column::decodeColumnValue<int8_t>(bytes.getRaw(), bytes.size());
+            case PropertyType::UNSIGNED_TINYINT:
+                return column::decodeColumnValue<uint8_t>(bytes.getRaw(), bytes.size());
+            case PropertyType::SMALLINT:
+                return column::decodeColumnValue<int16_t>(bytes.getRaw(), bytes.size());
+            case PropertyType::UNSIGNED_SMALLINT:
+                return column::decodeColumnValue<uint16_t>(bytes.getRaw(), bytes.size());
+            case PropertyType::INTEGER:
+                return column::decodeColumnValue<int32_t>(bytes.getRaw(), bytes.size());
+            case PropertyType::UNSIGNED_INTEGER:
+                return column::decodeColumnValue<uint32_t>(bytes.getRaw(), bytes.size());
+            case PropertyType::BIGINT:
+                return column::decodeColumnValue<int64_t>(bytes.getRaw(), bytes.size());
+            case PropertyType::UNSIGNED_BIGINT:
+                return column::flipSignBit(column::decodeColumnValue<uint64_t>(bytes.getRaw(), bytes.size()));
+            default:
+                return 0;
+            }
+        };
+        auto setLower = [&](const Bytes& bytes, bool inclusive) {
+            predicate.lowerInclusive = inclusive;
+            if (predicate.isReal) {
+                predicate.lowerReal = column::decodeColumnValue<double>(bytes.getRaw(), bytes.size());
+            } else {
+                predicate.lower = toColumnValue(bytes);
+            }
+        };
+        auto setUpper = [&](const Bytes& bytes, bool inclusive) {
+            predicate.upperInclusive = inclusive;
+            if (predicate.isReal) {
+                predicate.upperReal = column::decodeColumnValue<double>(bytes.getRaw(), bytes.size());
+            } else {
+                predicate.upper = toColumnValue(bytes);
+            }
+        };
+        switch (condition.comp) {
+        case Condition::Comparator::EQUAL:
+            setLower(condition.valueBytes, true);
+            setUpper(condition.valueBytes, true);
+            break;
+        case Condition::Comparator::GREATER:
+            setLower(condition.valueBytes, false);
+            break;
+        case Condition::Comparator::GREATER_EQUAL:
+            setLower(condition.valueBytes, true);
+            break;
+        case Condition::Comparator::LESS:
+            setUpper(condition.valueBytes, false);
+            break;
+        case Condition::Comparator::LESS_EQUAL:
+            setUpper(condition.valueBytes, true);
+            break;
+        case Condition::Comparator::BETWEEN:
+            setLower(condition.valueSet[0], true);
+            setUpper(condition.valueSet[1], true);
+            break;
+        case Condition::Comparator::BETWEEN_NO_LOWER:
+            setLower(condition.valueSet[0], false);
+            setUpper(condition.valueSet[1], true);
+            break;
+        case Condition::Comparator::BETWEEN_NO_UPPER:
+            setLower(condition.valueSet[0], true);
+            setUpper(condition.valueSet[1], false);
+            break;
+        case Condition::Comparator::BETWEEN_NO_BOUND:
+            setLower(condition.valueSet[0], false);
+            setUpper(condition.valueSet[1], false);
+            break;
+        case Condition::Comparator::IN:
+            predicate.isIn = true;
+            for (const auto& valueBytes : condition.valueSet) {
+                if (predicate.isReal) {
+                    predicate.inRealValues.emplace_back(column::decodeColumnValue<double>(valueBytes.getRaw(), valueBytes.size()));
+                } else {
+                    predicate.inValues.emplace_back(toColumnValue(valueBytes));
+                }
+            }
+            break;
+        default:
+            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_COMPARATOR);
+        }
+        return predicate;
+    }
+
     bool RecordCompare::compareRecordByMultiCondition(const Record& record,
         const PropertyNameMapInfo& propertyNameMapInfo,
         const MultiCondition& multiCondition)
@@ -133,6 +313,12 @@ namespace compare {
                 }
             }
         }
+        for (const auto& onlyClass : classFilter.onlyClasses) {
+            auto classInfo = txn._adapter->dbClass()->getInfo(onlyClass);
+            if (classInfo.type != ClassType::UNDEFINED) {
+                classFilter.onlyClassIds.insert(classInfo.id);
+            }
+        }
         classFilter.ignoreClasses.insert(filter._ignoreClasses.cbegin(), filter._ignoreClasses.cend());
         for (const auto& ignoreSubOfClass : filter._ignoreSubOfClasses) {
             auto superClassInfo = txn._adapter->dbClass()->getInfo(ignoreSubOfClass);
@@ -203,17 +389,30 @@ namespace compare {
     {
         auto edgeRecordDescriptors = std::vector<std::pair<RecordDescriptor, RecordDescriptor>> {};
         auto edgeNeighbours = std::vector<std::pair<RecordId, RecordId>> {};
+        auto addEdgeNeighbours = [&](const Direction& edgeDirection) {
+            if (classFilter.onlyClasses.empty()) {
+                auto moreEdges = (edgeDirection == Direction::IN) ? txn._graph->getInEdgeAndNeighbours(vertex)
+                                                                  : txn._graph->getOutEdgeAndNeighbours(vertex);
+                edgeNeighbours.insert(edgeNeighbours.cend(), moreEdges.cbegin(), moreEdges.cend());
+                return;
+            }
+            for (const auto& edgeClassId : classFilter.onlyClassIds) {
+                auto moreEdges = (edgeDirection == Direction::IN)
+                    ? txn._graph->getInEdgeAndNeighbours(vertex, edgeClassId)
+                    : txn._graph->getOutEdgeAndNeighbours(vertex, edgeClassId);
+                edgeNeighbours.insert(edgeNeighbours.cend(), moreEdges.cbegin(), moreEdges.cend());
+            }
+        };
         switch (direction) {
         case Direction::IN:
-            edgeNeighbours = txn._graph->getInEdgeAndNeighbours(vertex);
+            addEdgeNeighbours(Direction::IN);
             break;
         case Direction::OUT:
-            edgeNeighbours = txn._graph->getOutEdgeAndNeighbours(vertex);
+            addEdgeNeighbours(Direction::OUT);
             break;
         case Direction::ALL:
-            edgeNeighbours = txn._graph->getInEdgeAndNeighbours(vertex);
-            auto moreEdges = txn._graph->getOutEdgeAndNeighbours(vertex);
-            edgeNeighbours.insert(edgeNeighbours.cend(), moreEdges.cbegin(), moreEdges.cend());
+            addEdgeNeighbours(Direction::IN);
+            addEdgeNeighbours(Direction::OUT);
             break;
         }
 
@@ -231,19 +430,39 @@ namespace compare {
     std::vector<RecordId> RecordCompare::resolveEdgeRecordIds(const Transaction& txn,
         const RecordId& recordId,
         const Direction& direction)
+    {
+        return resolveEdgeRecordIds(txn, recordId, direction, ClassFilter {});
+    }
+
+    std::vector<RecordId> RecordCompare::resolveEdgeRecordIds(const Transaction& txn,
+        const RecordId& recordId,
+        const Direction& direction,
+        const ClassFilter& classFilter)
     {
         auto edgeRecordIds = std::vector<RecordId> {};
+        auto addEdges = [&](const Direction& edgeDirection) {
+            if (classFilter.onlyClasses.empty()) {
+                auto moreEdges = (edgeDirection == Direction::IN) ? txn._graph->getInEdges(recordId)
+                                                                  : txn._graph->getOutEdges(recordId);
+                edgeRecordIds.insert(edgeRecordIds.cend(), moreEdges.cbegin(), moreEdges.cend());
+                return;
+            }
+            for (const auto& edgeClassId : classFilter.onlyClassIds) {
+                auto moreEdges = (edgeDirection == Direction::IN) ? txn._graph->getInEdges(recordId, edgeClassId)
+                                                                  : txn._graph->getOutEdges(recordId, edgeClassId);
+                edgeRecordIds.insert(edgeRecordIds.cend(), moreEdges.cbegin(), moreEdges.cend());
+            }
+        };
         switch (direction) {
         case Direction::IN:
-            edgeRecordIds = txn._graph->getInEdges(recordId);
+            addEdges(Direction::IN);
             break;
         case Direction::OUT:
-            edgeRecordIds = txn._graph->getOutEdges(recordId);
+            addEdges(Direction::OUT);
             break;
         default:
-            edgeRecordIds = txn._graph->getInEdges(recordId);
-            auto outEdges = txn._graph->getOutEdges(recordId);
-            edgeRecordIds.insert(edgeRecordIds.cend(), outEdges.cbegin(), outEdges.cend());
+            addEdges(Direction::IN);
+            addEdges(Direction::OUT);
             break;
         }
         return edgeRecordIds;
@@ -253,20 +472,42 @@ namespace compare {
         const ClassAccessInfo& classInfo,
         const PropertyNameMapInfo& propertyNameMapInfo,
         const Condition& condition,
-        bool searchIndexOnly)
+        bool searchIndexOnly,
+        QueryPlan* queryPlan)
     {
         auto foundProperty = propertyNameMapInfo.find(condition.propName);
         if (foundProperty == propertyNameMapInfo.cend()) {
             return ResultSet {};
         }
         auto propertyInfo = foundProperty->second;
+        auto stopwatch = explain::Stopwatch {};
         auto foundIndex = IndexUtils::hasIndex(&txn, classInfo, propertyInfo, condition);
         if (foundIndex.first) {
             auto indexedRecords = IndexUtils::getRecord(&txn, propertyInfo, foundIndex.second, condition);
-            return DataRecordUtils::getResultSet(&txn, classInfo, indexedRecords);
+            if (auto stage = explain::record(queryPlan, "INDEX_SCAN", classInfo.name, 0, indexedRecords.size(), stopwatch)) {
+                stage->indexIds.emplace_back(foundIndex.second.id);
+                stage->detail = condition.propName;
+                stage->estimatedRows = IndexUtils::getEstimateCount(&txn, propertyInfo, foundIndex.second, condition);
+                stage->indexEntries = indexedRecords.size();
+                stopwatch.reset();
+            }
+            auto resultSet = DataRecordUtils::getResultSet(&txn, classInfo, indexedRecords);
+            explain::recordRead(queryPlan, "FETCH", classInfo.name,
+                indexedRecords.size(), resultSet.size(), indexedRecords.size(), stopwatch);
+            return resultSet;
         } else {
             if (!searchIndexOnly) {
-                return DataRecordUtils::getResultSetByCondition(&txn, classInfo, propertyInfo.type, condition);
+                auto resultSet = DataRecordUtils::getResultSetByCondition(&txn, classInfo, propertyInfo.type, condition);
+                if (queryPlan != nullptr) {
+                    auto isColumnScan = isColumnComparable(propertyInfo.type, condition);
+                    auto classCount = DataRecord(txn._txnBase, classInfo.id, classInfo.type).count();
+                    auto stage = explain::recordRead(queryPlan, isColumnScan ? "COLUMN_SCAN" : "FULL_SCAN",
+                        classInfo.name, classCount, resultSet.size(), classCount, stopwatch);
+                    stage->detail = condition.propName;
+                    // a column scan only parses the records that have been selected
+                    stage->recordsDecoded = isColumnScan ? resultSet.size() : classCount;
+                }
+                return resultSet;
             }
         }
         return ResultSet {};
@@ -276,7 +517,8 @@ namespace compare {
         const ClassAccessInfo& classInfo,
         const PropertyNameMapInfo& propertyNameMapInfo,
         const MultiCondition& multiCondition,
-        bool searchIndexOnly)
+        bool searchIndexOnly,
+        QueryPlan* queryPlan)
     {
         auto conditionProperties = PropertyNameMapInfo {};
         for (const auto& conditionNode : multiCondition.conditions) {
@@ -292,14 +534,65 @@ namespace compare {
             }
         }
 
+        auto stopwatch = explain::Stopwatch {};
         auto foundIndex = IndexUtils::hasIndex(&txn, classInfo, conditionProperties, multiCondition);
         if (foundIndex.first) {
             auto indexedRecords = IndexUtils::getRecord(&txn, conditionProperties, foundIndex.second, multiCondition);
-            return DataRecordUtils::getResultSet(&txn, classInfo, indexedRecords);
+            if (auto stage = explain::record(queryPlan, "INDEX_SCAN", classInfo.name, 0, indexedRecords.size(), stopwatch)) {
+                for (const auto& propertyIndex : foundIndex.second) {
+                    // all properties of a composite index map to the same index
+                    if (std::find(stage->indexIds.cbegin(), stage->indexIds.cend(), propertyIndex.second.id)
+                        == stage->indexIds.cend()) {
+                        stage->indexIds.emplace_back(propertyIndex.second.id);
+                    }
+                }
+                // the conjunctive part of the multi-condition is the best available estimate
+                auto indexPlan = IndexUtils::getIndexPlan(&txn, classInfo, conditionProperties, multiCondition, true);
+                stage->estimatedRows = indexPlan.conjuncts.empty() ?
+                    DataRecord(txn._txnBase, classInfo.id, classInfo.type).count() : indexPlan.estimatedCount;
+                stage->indexEntries = indexedRecords.size();
+                stopwatch.reset();
+            }
+            auto resultSet = DataRecordUtils::getResultSet(&txn, classInfo, indexedRecords);
+            explain::recordRead(queryPlan, "FETCH", classInfo.name,
+                indexedRecords.size(), resultSet.size(), indexedRecords.size(), stopwatch);
+            return resultSet;
         } else {
-            if (!searchIndexOnly) {
-                return DataRecordUtils::getResultSetByMultiCondition(
+            auto indexPlan = IndexUtils::getIndexPlan(&txn, classInfo, conditionProperties, multiCondition, searchIndexOnly);
+            if (!indexPlan.conjuncts.empty()) {
+                auto indexEntries = uint64_t { 0 };
+                auto candidates = IndexUtils::getRecord(&txn, indexPlan, &indexEntries);
+                if (auto stage = explain::record(queryPlan,
+                        (indexPlan.conjuncts.size() > 1) ? "INDEX_INTERSECT" : "INDEX_SCAN", classInfo.name,
+                        indexPlan.estimatedCount, candidates.size(), stopwatch)) {
+                    for (const auto& conjunct : indexPlan.conjuncts) {
+                        stage->indexIds.emplace_back(conjunct.indexInfo.id);
+                        auto columns = std::string {};
+                        for (const auto& keyCondition : conjunct.keyConditions) {
+                            columns += (columns.empty() ? "" : ", ") + keyCondition->propName;
+                        }
+                        stage->detail += (stage->detail.empty() ? "" : ", ")
+                            + (conjunct.indexInfo.isComposite() ? "(" + columns + ")" : conjunct.condition->propName);
+                    }
+                    stage->indexEntries = indexEntries;
+                }
+                auto resultSet = DataRecordUtils::getResultSetByMultiCondition(
+                    &txn, classInfo, conditionProperties, multiCondition, candidates);
+                if (auto stage = explain::recordRead(queryPlan, "FILTER", classInfo.name,
+                        indexPlan.estimatedCount, resultSet.size(), candidates.size(), stopwatch)) {
+                    stage->detail = "residual multi-condition";
+                }
+                return resultSet;
+            } else if (!searchIndexOnly) {
+                auto resultSet = DataRecordUtils::getResultSetByMultiCondition(
                     &txn, classInfo, conditionProperties, multiCondition);
+                if (queryPlan != nullptr) {
+                    auto classCount = DataRecord(txn._txnBase, classInfo.id, classInfo.type).count();
+                    auto stage = explain::recordRead(
+                        queryPlan, "FULL_SCAN", classInfo.name, classCount, resultSet.size(), classCount, stopwatch);
+                    stage->detail = "multi-condition";
+                }
+                return resultSet;
             }
         }
         return ResultSet {};
@@ -327,6 +620,26 @@ namespace compare {
         return std::vector<RecordDescriptor> {};
     }
 
+    ResultSetCursor RecordCompare::compareConditionCursor(const Transaction& txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyNameMapInfo,
+        const Condition& condition,
+        bool searchIndexOnly)
+    {
+        auto foundProperty = propertyNameMapInfo.find(condition.propName);
+        if (foundProperty != propertyNameMapInfo.cend()) {
+            auto propertyInfo = foundProperty->second;
+            auto foundIndex = IndexUtils::hasIndex(&txn, classInfo, propertyInfo, condition);
+            if (foundIndex.first) {
+                return IndexUtils::getCursor(&txn, propertyInfo, foundIndex.second, condition);
+            }
+        }
+        auto resultSetCursor = ResultSetCursor { txn };
+        resultSetCursor.addMetadata(
+            compareConditionRdesc(txn, classInfo, propertyNameMapInfo, condition, searchIndexOnly));
+        return resultSetCursor;
+    }
+
     std::vector<RecordDescriptor> RecordCompare::compareMultiConditionRdesc(const Transaction& txn,
         const ClassAccessInfo& classInfo,
         const PropertyNameMapInfo& propertyNameMapInfo,
@@ -351,7 +664,12 @@ namespace compare {
         if (foundIndex.first) {
             return IndexUtils::getRecord(&txn, conditionProperties, foundIndex.second, conditions);
         } else {
-            if (!searchIndexOnly) {
+            auto indexPlan = IndexUtils::getIndexPlan(&txn, classInfo, conditionProperties, conditions, searchIndexOnly);
+            if (!indexPlan.conjuncts.empty()) {
+                auto candidates = IndexUtils::getRecord(&txn, indexPlan);
+                return DataRecordUtils::getRecordDescriptorByMultiCondition(
+                    &txn, classInfo, conditionProperties, conditions, candidates);
+            } else if (!searchIndexOnly) {
                 return DataRecordUtils::getRecordDescriptorByMultiCondition(
                     &txn, classInfo, conditionProperties, conditions);
             }
@@ -405,7 +723,12 @@ namespace compare {
         if (foundIndex.first) {
             return IndexUtils::getCountRecord(&txn, conditionProperties, foundIndex.second, conditions);
         } else {
-            if (!searchIndexOnly) {
+            auto indexPlan = IndexUtils::getIndexPlan(&txn, classInfo, conditionProperties, conditions, searchIndexOnly);
+            if (!indexPlan.conjuncts.empty()) {
+                auto candidates = IndexUtils::getRecord(&txn, indexPlan);
+                return DataRecordUtils::getCountRecordByMultiCondition(
+                    &txn, classInfo, conditionProperties, conditions, candidates);
+            } else if (!searchIndexOnly) {
                 return DataRecordUtils::getCountRecordByMultiCondition(
                     &txn, classInfo, conditionProperties, conditions);
             }
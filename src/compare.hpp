@@ -24,6 +24,7 @@
 #include <regex>
 #include <utility>
 
+#include "column.hpp"
 #include "datarecord.hpp"
 #include "index.hpp"
 #include "relation.hpp"
@@ -41,6 +42,8 @@ namespace compare {
     struct ClassFilter {
         std::set<std::string> onlyClasses;
         std::set<std::string> ignoreClasses;
+        // ids of the existing classes in onlyClasses, whose incident edges are read as ranges of the relations
+        std::set<ClassId> onlyClassIds;
     };
 
     class RecordCompare {
@@ -59,6 +62,16 @@ namespace compare {
             const PropertyNameMapInfo& propertyNameMapInfo,
             const Condition& condition);
 
+        static bool isColumnComparable(const PropertyType& propertyType, const Condition& condition);
+
+        /**
+         * Whether genericCompareFunc accepts the comparator of the condition for the property type
+         * and every value of the condition is wide enough to be read as a value of that type.
+         */
+        static bool isComparable(const PropertyType& propertyType, const Condition& condition);
+
+        static column::ColumnPredicate getColumnPredicate(const PropertyType& propertyType, const Condition& condition);
+
         static bool compareRecordByMultiCondition(const Record& record,
             const PropertyNameMapInfo& propertyNameMapInfo,
             const MultiCondition& multiCondition);
@@ -85,17 +98,32 @@ namespace compare {
             const RecordId& recordId,
             const Direction& direction);
 
+        /**
+         * Only the edges of the classes in onlyClassIds are read when onlyClasses is not empty,
+         * the other criteria of the filter still have to be checked with filterRecord.
+         */
+        static std::vector<RecordId> resolveEdgeRecordIds(const Transaction& txn,
+            const RecordId& recordId,
+            const Direction& direction,
+            const ClassFilter& classFilter);
+
+        /**
+         * If queryPlan is not null, the stages executed for the class (access path, index ids,
+         * estimated and actual rows, records decoded and timing) are appended to it.
+         */
         static ResultSet compareCondition(const Transaction& txn,
             const ClassAccessInfo& classInfo,
             const PropertyNameMapInfo& propertyNameMapInfo,
             const Condition& condition,
-            bool searchIndexOnly = false);
+            bool searchIndexOnly = false,
+            QueryPlan* queryPlan = nullptr);
 
         static ResultSet compareMultiCondition(const Transaction& txn,
             const ClassAccessInfo& classInfo,
             const PropertyNameMapInfo& propertyNameMapInfo,
             const MultiCondition& conditions,
-            bool searchIndexOnly = false);
+            bool searchIndexOnly = false,
+            QueryPlan* queryPlan = nullptr);
 
         static std::vector<RecordDescriptor> compareConditionRdesc(const Transaction& txn,
             const ClassAccessInfo& classInfo,
@@ -103,6 +131,16 @@ namespace compare {
             const Condition& condition,
             bool searchIndexOnly = false);
 
+        /**
+         * Like compareConditionRdesc but an indexed condition is read lazily from the index
+         * in index order as the cursor moves forward rather than materialized up front.
+         */
+        static ResultSetCursor compareConditionCursor(const Transaction& txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyNameMapInfo,
+            const Condition& condition,
+            bool searchIndexOnly = false);
+
         static std::vector<RecordDescriptor> compareMultiConditionRdesc(const Transaction& txn,
             const ClassAccessInfo& classInfo,
             const PropertyNameMapInfo& propertyNameMapInfo,
@@ -375,6 +413,19 @@ namespace compare {
                     throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_COMPARATOR);
                 }
             case PropertyType::TEXT: {
+                // pattern matching comparators fold the case on the fly without copying
+                switch (cmp) {
+                case Condition::Comparator::CONTAIN:
+                    return utils::string::contains(value.toText(), cmpValue1.toText(), isIgnoreCase);
+                case Condition::Comparator::BEGIN_WITH:
+                    return utils::string::beginWith(value.toText(), cmpValue1.toText(), isIgnoreCase);
+                case Condition::Comparator::END_WITH:
+                    return utils::string::endWith(value.toText(), cmpValue1.toText(), isIgnoreCase);
+                case Condition::Comparator::LIKE:
+                    return utils::string::like(value.toText(), cmpValue1.toText(), isIgnoreCase);
+                default:
+                    break;
+                }
                 auto textValue = (isIgnoreCase) ? toLower(value.toText()) : value.toText();
                 auto textCmpValue1 = (isIgnoreCase) ? toLower(cmpValue1.toText()) : cmpValue1.toText();
                 auto textCmpValue2 = (cmpValue2.empty()) ? "" : ((isIgnoreCase) ? toLower(cmpValue2.toText()) : cmpValue2.toText());
@@ -389,18 +440,6 @@ namespace compare {
                     return textValue < textCmpValue1;
                 case Condition::Comparator::LESS_EQUAL:
                     return textValue <= textCmpValue1;
-                case Condition::Comparator::CONTAIN:
-                    return textValue.find(textCmpValue1) < strlen(textValue.c_str());
-                case Condition::Comparator::BEGIN_WITH:
-                    return textValue.find(textCmpValue1) == 0;
-                case Condition::Comparator::END_WITH:
-                    std::reverse(textValue.begin(), textValue.end());
-                    std::reverse(textCmpValue1.begin(), textCmpValue1.end());
-                    return textValue.find(textCmpValue1) == 0;
-                case Condition::Comparator::LIKE:
-                    utils::string::replaceAll(textCmpValue1, "%", "(.*)");
-                    utils::string::replaceAll(textCmpValue1, "_", "(.)");
-                    return std::regex_match(textValue, std::regex(textCmpValue1));
                 case Condition::Comparator::REGEX: {
                     return std::regex_match(textValue, std::regex(textCmpValue1));
                 }
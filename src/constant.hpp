@@ -34,6 +34,10 @@ const std::string TB_PROPERTIES = ".properties";
 const std::string TB_RELATIONS_IN = ".relations#in";
 const std::string TB_RELATIONS_OUT = ".relations#out";
 const std::string TB_INDEXES = ".indexes";
+const std::string TB_COMPOSITE_INDEXES = ".composite_indexes";
+const std::string TB_TEXT_INDEXES = ".text_indexes";
+const std::string TB_POLYMORPHIC_INDEXES = ".polymorphic_indexes";
+const std::string TB_STATISTICS = ".statistics";
 
 const std::string TB_INDEXING_PREFIX = ".index_";
 
@@ -57,6 +61,31 @@ const std::string MAX_PROPERTY_ID_KEY = "?max_property_id";
 const std::string NUM_PROPERTY_KEY = "?num_property_id";
 const std::string MAX_INDEX_ID_KEY = "?max_index_id";
 const std::string NUM_INDEX_KEY = "?num_index_id";
+const std::string INDEX_KEY_VERSION_KEY = "?index_key_version";
+
+// version 1: one DBI with order-preserving keys per numeric index instead of a positive and a negative one
+// version 2: long texts are indexed under their prefix and a hash, see INDEX_TEXT_KEY_PREFIX_LENGTH
+// version 3: so are the long texts in the keys of composite and polymorphic indexes
+constexpr uint16_t INDEX_KEY_VERSION = 3;
+
+// texts longer than this are indexed under their first bytes followed by a hash of the whole text,
+// which keeps the keys within the key size limit of lmdb
+constexpr size_t INDEX_TEXT_KEY_PREFIX_LENGTH = 128;
+
+// length in bytes of the substrings under which a text index keeps its records
+constexpr size_t TEXT_INDEX_GRAM_LENGTH = 3;
+
+constexpr size_t STATISTICS_HISTOGRAM_BUCKETS = 64;
+constexpr size_t STATISTICS_MOST_COMMON_VALUES = 16;
+
+// non-null values of each property kept as a uniform random sample while a class is analyzed
+constexpr size_t STATISTICS_SAMPLE_SIZE = 30000;
+
+// index entries held in memory while building an index before they are spilled into a sorted run
+constexpr size_t INDEX_BUILD_MEMORY_LIMIT = 256 * 1024 * 1024;
+
+// vertices of a traversal frontier below which expanding them on another thread does not pay off
+constexpr size_t PARALLEL_TRAVERSE_MIN_VERTICES = 64;
 
 const std::regex GLOBAL_VALID_NAME_PATTERN = std::regex("^[A-Za-z_][A-Za-z0-9_]*$");
 
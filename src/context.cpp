@@ -23,6 +23,7 @@
 #include <string>
 
 #include "constant.hpp"
+#include "index.hpp"
 #include "schema.hpp"
 #include "storage_engine.hpp"
 #include "utils.hpp"
@@ -43,6 +44,27 @@ struct ContextSetting {
 std::unordered_map<std::string, Context::LMDBInstance> Context::_underlying =
     std::unordered_map<std::string, Context::LMDBInstance> {};
 
+namespace {
+    // bring the indexes of a newly opened environment up to the current key encoding, taking
+    // the writer lock only when the version read in a read-only transaction is an older one
+    void upgradeIndexes(Context& ctx)
+    {
+        auto isUpgradeNeeded = true;
+        try {
+            auto txn = ctx.beginTxn(TxnMode::READ_ONLY);
+            isUpgradeNeeded = index::IndexUtils::isUpgradeNeeded(&txn);
+            txn.commit();
+        } catch (const FatalError&) {
+            // the databases of a new environment are created by its first read-write transaction
+        }
+        if (isUpgradeNeeded) {
+            auto txn = ctx.beginTxn(TxnMode::READ_WRITE);
+            index::IndexUtils::upgrade(&txn);
+            txn.commit();
+        }
+    }
+}
+
 ContextInitializer::ContextInitializer(const std::string& dbPath)
     : _dbPath { dbPath }
 {
@@ -113,6 +135,7 @@ Context::Context(const std::string& dbPath)
                 instance._refCount = 1;
                 _underlying.emplace(dbPath, instance);
                 _envHandler = instance._handler;
+                upgradeIndexes(*this);
             } else {
                 _envHandler = foundContext->second._handler;
                 ++foundContext->second._refCount;
@@ -131,6 +154,7 @@ Context::Context(const std::string& dbPath, unsigned int maxDB, unsigned long ma
         instance._refCount = 1;
         _underlying.emplace(dbPath, instance);
         _envHandler = instance._handler;
+        upgradeIndexes(*this);
     } else {
         _envHandler = foundContext->second._handler;
         ++foundContext->second._refCount;
@@ -22,6 +22,7 @@
 #include <iterator>
 
 #include "datarecord.hpp"
+#include "index.hpp"
 #include "schema.hpp"
 
 #include "nogdb/nogdb_types.h"
@@ -42,6 +43,7 @@ ResultSetCursor::ResultSetCursor(ResultSetCursor&& rc) noexcept
     : txn { rc.txn }
 {
     metadata = std::move(rc.metadata);
+    indexCursor = std::move(rc.indexCursor);
     currentIndex = rc.currentIndex;
 }
 
@@ -50,6 +52,7 @@ ResultSetCursor& ResultSetCursor::operator=(ResultSetCursor&& rc) noexcept
     if (this != &rc) {
         txn = rc.txn;
         metadata = std::move(rc.metadata);
+        indexCursor = std::move(rc.indexCursor);
         currentIndex = rc.currentIndex;
     }
     return *this;
@@ -57,6 +60,7 @@ ResultSetCursor& ResultSetCursor::operator=(ResultSetCursor&& rc) noexcept
 
 bool ResultSetCursor::hasNext() const
 {
+    fetch(static_cast<size_t>(currentIndex + 1));
     return !(metadata.empty()) && (currentIndex < static_cast<long long>(metadata.size() - 1));
 }
 
@@ -67,6 +71,7 @@ bool ResultSetCursor::hasPrevious() const
 
 bool ResultSetCursor::hasAt(unsigned long index) const
 {
+    fetch(index + 1);
     return !(metadata.empty()) && (index < metadata.size() - 1);
 }
 
@@ -75,6 +80,7 @@ bool ResultSetCursor::next()
     BEGIN_VALIDATION(txn)
         .isTxnCompleted();
 
+    fetch(static_cast<size_t>(currentIndex + 1));
     if (!metadata.empty() && (currentIndex == -1)) {
         currentIndex = 0;
     } else if (hasNext()) {
@@ -114,11 +120,13 @@ bool ResultSetCursor::previous()
 
 bool ResultSetCursor::empty() const
 {
+    fetch(0);
     return metadata.empty();
 }
 
 size_t ResultSetCursor::size() const
 {
+    fetch(SIZE_MAX);
     return metadata.size();
 }
 
@@ -132,6 +140,7 @@ void ResultSetCursor::first()
     BEGIN_VALIDATION(txn)
         .isTxnCompleted();
 
+    fetch(0);
     if (!metadata.empty()) {
         currentIndex = 0;
         auto cursor = metadata.begin();
@@ -148,6 +157,7 @@ void ResultSetCursor::last()
     BEGIN_VALIDATION(txn)
         .isTxnCompleted();
 
+    fetch(SIZE_MAX);
     if (!metadata.empty()) {
         currentIndex = static_cast<long long>(metadata.size() - 1);
         auto cursor = metadata.end() - 1;
@@ -164,6 +174,7 @@ bool ResultSetCursor::to(unsigned long index)
     BEGIN_VALIDATION(txn)
         .isTxnCompleted();
 
+    fetch(index);
     if (index >= metadata.size()) {
         return false;
     }
@@ -187,4 +198,14 @@ const Result* ResultSetCursor::operator->() const
     return &(operator*());
 }
 
+bool ResultSetCursor::fetch(size_t index) const
+{
+    while (indexCursor && metadata.size() <= index) {
+        if (!indexCursor->fetch(metadata, index::INDEX_CURSOR_FETCH_SIZE)) {
+            indexCursor.reset();
+        }
+    }
+    return index < metadata.size();
+}
+
 }
\ No newline at end of file
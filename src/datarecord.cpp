@@ -94,14 +94,7 @@ namespace datarecord {
 
     size_t DataRecordUtils::getCountRecord(const Transaction *txn, const ClassAccessInfo& classInfo)
     {
-        auto vertexDataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
-        auto count = size_t {0};
-        std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
-            [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
-                ++count;
-            };
-        vertexDataRecord.resultSetIter(callback);
-        return count;
+        return DataRecord(txn->_txnBase, classInfo.id, classInfo.type).count();
     }
 
     ResultSet DataRecordUtils::getResultSetByCondition(const Transaction *txn,
@@ -112,6 +105,16 @@ namespace datarecord {
         auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
         auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
         auto resultSet = ResultSet {};
+        if (RecordCompare::isColumnComparable(propertyType, condition)) {
+            columnSetIterByCondition(txn, classInfo, propertyType, condition,
+                [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
+                    auto rid = RecordId { classInfo.id, positionId };
+                    auto record = RecordParser::parseRawDataWithBasicInfo(
+                        classInfo.name, rid, result, propertyIdMapInfo, classInfo.type, txn->_txnCtx->isVersionEnabled());
+                    resultSet.emplace_back(Result { RecordDescriptor { rid }, record });
+                });
+            return resultSet;
+        }
         std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
             [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
                 auto rid = RecordId { classInfo.id, positionId };
@@ -130,9 +133,16 @@ namespace datarecord {
         const PropertyType& propertyType,
         const Condition& condition)
     {
+        auto recordDescriptors = std::vector<RecordDescriptor> {};
+        if (RecordCompare::isColumnComparable(propertyType, condition)) {
+            columnSetIterByCondition(txn, classInfo, propertyType, condition,
+                [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
+                    recordDescriptors.emplace_back(RecordDescriptor { classInfo.id, positionId });
+                });
+            return recordDescriptors;
+        }
         auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
         auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
-        auto recordDescriptors = std::vector<RecordDescriptor> {};
         std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
             [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
                 auto rid = RecordId { classInfo.id, positionId };
@@ -151,9 +161,16 @@ namespace datarecord {
         const PropertyType& propertyType,
         const Condition& condition)
     {
+        auto count = size_t {0};
+        if (RecordCompare::isColumnComparable(propertyType, condition)) {
+            columnSetIterByCondition(txn, classInfo, propertyType, condition,
+                [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
+                    ++count;
+                });
+            return count;
+        }
         auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
         auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
-        auto count = size_t {0};
         std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
             [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
                 auto rid = RecordId { classInfo.id, positionId };
@@ -242,6 +259,48 @@ namespace datarecord {
         return count;
     }
 
+    ResultSet DataRecordUtils::getResultSetByMultiCondition(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const MultiCondition& multiCondition,
+        const std::vector<RecordDescriptor>& candidates)
+    {
+        auto resultSet = ResultSet {};
+        candidateIterByMultiCondition(txn, classInfo, propertyInfos, multiCondition, candidates,
+            [&](const RecordDescriptor& recordDescriptor, const Record& record) {
+                resultSet.emplace_back(Result { recordDescriptor, record });
+            });
+        return resultSet;
+    }
+
+    std::vector<RecordDescriptor> DataRecordUtils::getRecordDescriptorByMultiCondition(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const MultiCondition& multiCondition,
+        const std::vector<RecordDescriptor>& candidates)
+    {
+        auto recordDescriptors = std::vector<RecordDescriptor> {};
+        candidateIterByMultiCondition(txn, classInfo, propertyInfos, multiCondition, candidates,
+            [&](const RecordDescriptor& recordDescriptor, const Record&) {
+                recordDescriptors.emplace_back(recordDescriptor);
+            });
+        return recordDescriptors;
+    }
+
+    size_t DataRecordUtils::getCountRecordByMultiCondition(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const MultiCondition& multiCondition,
+        const std::vector<RecordDescriptor>& candidates)
+    {
+        auto count = size_t {0};
+        candidateIterByMultiCondition(txn, classInfo, propertyInfos, multiCondition, candidates,
+            [&](const RecordDescriptor&, const Record&) {
+                ++count;
+            });
+        return count;
+    }
+
     ResultSet DataRecordUtils::getResultSetByCmpFunction(const Transaction *txn,
         const ClassAccessInfo& classInfo,
         bool (*condition)(const Record& record))
@@ -302,5 +361,77 @@ namespace datarecord {
         return count;
     }
 
+    void DataRecordUtils::columnSetIterByCondition(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyType& propertyType,
+        const Condition& condition,
+        std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback)
+    {
+        auto propertyInfo = SchemaUtils::getPropertyNameMapInfo(txn, classInfo.id, classInfo.superClassId);
+        auto foundProperty = propertyInfo.find(condition.propName);
+        if (foundProperty == propertyInfo.cend()) {
+            // none of the records can have a value of an unknown property
+            return;
+        }
+        auto propertyId = foundProperty->second.id;
+        auto predicate = RecordCompare::getColumnPredicate(propertyType, condition);
+        auto enableVersion = txn->_txnCtx->isVersionEnabled();
+        auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
+        // raw data pointers stay valid until the end of the scan as the transaction is not modified meanwhile
+        auto block = std::unique_ptr<column::ColumnBlock>(new column::ColumnBlock {});
+        auto positionIds = std::vector<PositionId>(column::COLUMN_BLOCK_SIZE);
+        auto rawData = std::vector<std::pair<const char*, size_t>>(column::COLUMN_BLOCK_SIZE);
+        auto selection = std::vector<uint16_t>(column::COLUMN_BLOCK_SIZE);
+        auto flush = [&]() {
+            auto selected = block->select(predicate, selection.data());
+            for (size_t i = 0; i < selected; ++i) {
+                auto row = selection[i];
+                auto result = storage_engine::lmdb::Result {};
+                result.data = storage_engine::lmdb::Value { rawData[row].first, rawData[row].second };
+                callback(positionIds[row], result);
+            }
+            block->clear();
+        };
+        std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> decode =
+            [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
+                auto row = block->size();
+                positionIds[row] = positionId;
+                rawData[row] = std::make_pair(result.data.data(), result.data.size());
+                auto value = RecordParser::parseRawDataPropertyValue(result, propertyId, classInfo.type, enableVersion);
+                block->append(value.first, value.second, propertyType);
+                if (block->full()) {
+                    flush();
+                }
+            };
+        dataRecord.resultSetIter(decode);
+        if (block->size() > 0) {
+            flush();
+        }
+    }
+
+    void DataRecordUtils::candidateIterByMultiCondition(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const MultiCondition& multiCondition,
+        const std::vector<RecordDescriptor>& candidates,
+        std::function<void(const RecordDescriptor&, const Record&)> callback)
+    {
+        auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
+        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
+        auto propertyTypes = PropertyMapType {};
+        for (const auto& property : propertyInfos) {
+            propertyTypes.emplace(property.first, property.second.type);
+        }
+        for (const auto& recordDescriptor : candidates) {
+            auto result = dataRecord.getResult(recordDescriptor.rid.second);
+            auto record = RecordParser::parseRawDataWithBasicInfo(
+                classInfo.name, recordDescriptor.rid, result, propertyIdMapInfo, classInfo.type,
+                txn->_txnCtx->isVersionEnabled());
+            if (multiCondition.execute(record, propertyTypes)) {
+                callback(recordDescriptor, record);
+            }
+        }
+    }
+
+}
 }
-}
\ No newline at end of file
@@ -81,6 +81,24 @@ namespace datarecord {
             const PropertyNameMapInfo& propertyInfos,
             const MultiCondition& multiCondition);
 
+        static ResultSet getResultSetByMultiCondition(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const MultiCondition& multiCondition,
+            const std::vector<RecordDescriptor>& candidates);
+
+        static std::vector<RecordDescriptor> getRecordDescriptorByMultiCondition(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const MultiCondition& multiCondition,
+            const std::vector<RecordDescriptor>& candidates);
+
+        static size_t getCountRecordByMultiCondition(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const MultiCondition& multiCondition,
+            const std::vector<RecordDescriptor>& candidates);
+
 
         static ResultSet getResultSetByCmpFunction(const Transaction *txn,
             const ClassAccessInfo& classInfo,
@@ -94,6 +112,29 @@ namespace datarecord {
             const ClassAccessInfo& classInfo,
             bool (*condition)(const Record& record));
 
+    private:
+        /**
+         * Evaluate a numeric condition on blocks of column::COLUMN_BLOCK_SIZE records at a time.
+         * The property is decoded into a typed column, the block is filtered into a selection vector
+         * and the callback is invoked only for the selected records.
+         */
+        static void columnSetIterByCondition(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyType& propertyType,
+            const Condition& condition,
+            std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback);
+
+        /**
+         * Fetch only the candidate records (e.g. produced by index lookups) and invoke the callback
+         * for those satisfying the whole multi-condition, which acts as a residual filter.
+         */
+        static void candidateIterByMultiCondition(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const MultiCondition& multiCondition,
+            const std::vector<RecordDescriptor>& candidates,
+            std::function<void(const RecordDescriptor&, const Record&)> callback);
+
     };
 
 }
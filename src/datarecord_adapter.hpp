@@ -126,6 +126,13 @@ namespace datarecord {
             return cursor();
         }
 
+        // number of records, excluding the entry holding the next position id
+        size_t count() const
+        {
+            auto entries = size();
+            return (entries > 0 && !get(MAX_RECORD_NUM_EM).empty) ? entries - 1 : entries;
+        }
+
         void resultSetIter(std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback)
         {
             auto cursorHandler = getCursor();
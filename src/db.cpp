@@ -24,6 +24,7 @@
 #include "datarecord.hpp"
 #include "lmdb_engine.hpp"
 #include "schema.hpp"
+#include "statistics.hpp"
 
 #include "nogdb/nogdb.h"
 
@@ -31,6 +32,7 @@ namespace nogdb {
 using namespace adapter::schema;
 using namespace schema;
 using namespace datarecord;
+using statistics::StatisticsUtils;
 
 const DBInfo Transaction::getDBInfo() const
 {
@@ -138,11 +140,30 @@ const std::vector<IndexDescriptor> Transaction::getIndexes(const ClassDescriptor
             indexInfo.id,
             indexInfo.classId,
             indexInfo.propertyId,
-            indexInfo.isUnique });
+            indexInfo.isUnique,
+            indexInfo.collation });
+    }
+    for (const auto& indexInfo : _adapter->dbCompositeIndex()->getInfos(classInfo.id)) {
+        indexDescriptors.emplace_back(IndexDescriptor {
+            indexInfo.id,
+            indexInfo.classId,
+            indexInfo.propertyIds,
+            indexInfo.isUnique,
+            indexInfo.includedPropertyIds });
     }
     return indexDescriptors;
 }
 
+const ClassStatistics Transaction::getStatistics(const std::string& className) const
+{
+    BEGIN_VALIDATION(this)
+        .isTxnCompleted()
+        .isClassNameValid(className);
+
+    auto classInfo = SchemaUtils::getExistingClass(this, className);
+    return StatisticsUtils::getStatistics(this, classInfo);
+}
+
 const ClassDescriptor Transaction::getClass(const std::string& className) const
 {
     BEGIN_VALIDATION(this)
@@ -214,6 +235,78 @@ const IndexDescriptor Transaction::getIndex(const std::string& className, const
     auto classInfo = SchemaUtils::getExistingClass(this, className);
     auto propertyInfo = SchemaUtils::getExistingPropertyExtend(this, classInfo.id, propertyName);
     auto indexInfo = SchemaUtils::getIndexInfo(this, classInfo.id, propertyInfo.id);
+    return IndexDescriptor {
+        indexInfo.id,
+        indexInfo.classId,
+        indexInfo.propertyId,
+        indexInfo.isUnique,
+        indexInfo.collation
+    };
+}
+
+const IndexDescriptor Transaction::getIndex(const std::string& className,
+    const std::vector<std::string>& propertyNames) const
+{
+    auto validators = BEGIN_VALIDATION(this)
+                          .isTxnCompleted()
+                          .isClassNameValid(className);
+    for (const auto& propertyName : propertyNames) {
+        validators.isPropertyNameValid(propertyName);
+    }
+
+    auto classInfo = SchemaUtils::getExistingClass(this, className);
+    auto propertyIds = std::vector<PropertyId> {};
+    for (const auto& propertyName : propertyNames) {
+        propertyIds.emplace_back(SchemaUtils::getExistingPropertyExtend(this, classInfo.id, propertyName).id);
+    }
+    if (propertyIds.size() == 1 && _adapter->dbCompositeIndex()->getInfo(classInfo.id, propertyIds).id == IndexId {}) {
+        return getIndex(className, propertyNames.front());
+    }
+    auto indexInfo = SchemaUtils::getIndexInfo(this, classInfo.id, propertyIds);
+    return IndexDescriptor {
+        indexInfo.id,
+        indexInfo.classId,
+        indexInfo.propertyIds,
+        indexInfo.isUnique,
+        indexInfo.includedPropertyIds
+    };
+}
+
+const IndexDescriptor Transaction::getTextIndex(const std::string& className, const std::string& propertyName) const
+{
+    BEGIN_VALIDATION(this)
+        .isTxnCompleted()
+        .isClassNameValid(className)
+        .isPropertyNameValid(propertyName);
+
+    auto classInfo = SchemaUtils::getExistingClass(this, className);
+    auto propertyInfo = SchemaUtils::getExistingPropertyExtend(this, classInfo.id, propertyName);
+    auto indexInfo = _adapter->dbTextIndex()->getInfo(classInfo.id, propertyInfo.id);
+    if (indexInfo.id == IndexId {}) {
+        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_NOEXST_INDEX);
+    }
+    return IndexDescriptor {
+        indexInfo.id,
+        indexInfo.classId,
+        indexInfo.propertyId,
+        indexInfo.isUnique
+    };
+}
+
+const IndexDescriptor Transaction::getPolymorphicIndex(const std::string& className,
+    const std::string& propertyName) const
+{
+    BEGIN_VALIDATION(this)
+        .isTxnCompleted()
+        .isClassNameValid(className)
+        .isPropertyNameValid(propertyName);
+
+    auto classInfo = SchemaUtils::getExistingClass(this, className);
+    auto propertyInfo = SchemaUtils::getExistingPropertyExtend(this, classInfo.id, propertyName);
+    auto indexInfo = _adapter->dbPolymorphicIndex()->getInfo(classInfo.id, propertyInfo.id);
+    if (indexInfo.id == IndexId {}) {
+        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_NOEXST_INDEX);
+    }
     return IndexDescriptor {
         indexInfo.id,
         indexInfo.classId,
@@ -180,6 +180,17 @@ namespace metadata {
             return _cache.numIndex;
         }
 
+        void setIndexKeyVersion(uint16_t indexKeyVersion)
+        {
+            put(INDEX_KEY_VERSION_KEY, indexKeyVersion);
+        }
+
+        uint16_t getIndexKeyVersion() const
+        {
+            auto result = get(INDEX_KEY_VERSION_KEY);
+            return (result.empty) ? uint16_t { 0 } : result.data.numeric<uint16_t>();
+        }
+
     protected:
         struct DBInfoAccessCache {
             PropertyId maxPropertyId { 0 };
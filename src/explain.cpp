@@ -0,0 +1,102 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <iomanip>
+#include <sstream>
+
+#include "explain.hpp"
+
+namespace nogdb {
+
+std::string QueryPlan::toString() const
+{
+    auto output = std::ostringstream {};
+    output << std::fixed << std::setprecision(3);
+    for (const auto& stage : stages) {
+        output << stage.operation;
+        if (!stage.className.empty()) {
+            output << " on " << stage.className;
+        }
+        if (!stage.indexIds.empty()) {
+            output << " using index";
+            for (auto it = stage.indexIds.cbegin(); it != stage.indexIds.cend(); ++it) {
+                output << ((it == stage.indexIds.cbegin()) ? " #" : ", #") << *it;
+            }
+        }
+        if (!stage.detail.empty()) {
+            output << " (" << stage.detail << ")";
+        }
+        output << " estimated=" << stage.estimatedRows
+               << " actual=" << stage.actualRows
+               << " index_entries=" << stage.indexEntries
+               << " rows_scanned=" << stage.rowsScanned
+               << " records_decoded=" << stage.recordsDecoded
+               << " time=" << stage.elapsedTime << "ms\n";
+    }
+    output << "TOTAL actual=" << actualRows << " time=" << elapsedTime << "ms";
+    return output.str();
+}
+
+namespace explain {
+
+    PlanStage* record(QueryPlan* queryPlan,
+        const std::string& operation,
+        const std::string& className,
+        uint64_t estimatedRows,
+        uint64_t actualRows,
+        Stopwatch& stopwatch)
+    {
+        auto stage = PlanStage { operation, className };
+        stage.estimatedRows = estimatedRows;
+        return record(queryPlan, stage, actualRows, stopwatch);
+    }
+
+    PlanStage* recordRead(QueryPlan* queryPlan,
+        const std::string& operation,
+        const std::string& className,
+        uint64_t estimatedRows,
+        uint64_t actualRows,
+        uint64_t records,
+        Stopwatch& stopwatch)
+    {
+        auto stage = record(queryPlan, operation, className, estimatedRows, actualRows, stopwatch);
+        if (stage != nullptr) {
+            stage->rowsScanned = records;
+            stage->recordsDecoded = records;
+        }
+        return stage;
+    }
+
+    PlanStage* record(QueryPlan* queryPlan, const PlanStage& stage, uint64_t actualRows, Stopwatch& stopwatch)
+    {
+        if (queryPlan == nullptr) {
+            return nullptr;
+        }
+        queryPlan->stages.emplace_back(stage);
+        queryPlan->stages.back().actualRows = actualRows;
+        queryPlan->stages.back().elapsedTime = stopwatch.elapsed();
+        stopwatch.reset();
+        return &queryPlan->stages.back();
+    }
+
+}
+}
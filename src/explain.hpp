@@ -0,0 +1,83 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#pragma once
+
+#include <chrono>
+
+#include "nogdb/nogdb_types.h"
+
+namespace nogdb {
+namespace explain {
+
+    /**
+     * Measure the wall-clock time spent by a plan stage in milliseconds.
+     */
+    class Stopwatch {
+    public:
+        Stopwatch()
+            : _start { std::chrono::steady_clock::now() }
+        {
+        }
+
+        ~Stopwatch() noexcept = default;
+
+        void reset()
+        {
+            _start = std::chrono::steady_clock::now();
+        }
+
+        double elapsed() const
+        {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _start).count();
+        }
+
+    private:
+        std::chrono::steady_clock::time_point _start;
+    };
+
+    /**
+     * Append a stage to the plan of an explained operation and return it, so that the counters which
+     * depend on its access path can be filled in. The stage takes the time measured by the stopwatch,
+     * which is then reset for the next stage. Without a plan nothing is recorded and null is returned.
+     */
+    PlanStage* record(QueryPlan* queryPlan,
+        const std::string& operation,
+        const std::string& className,
+        uint64_t estimatedRows,
+        uint64_t actualRows,
+        Stopwatch& stopwatch);
+
+    // record a stage which reads and parses the given number of records, such as a FETCH or a FILTER
+    PlanStage* recordRead(QueryPlan* queryPlan,
+        const std::string& operation,
+        const std::string& className,
+        uint64_t estimatedRows,
+        uint64_t actualRows,
+        uint64_t records,
+        Stopwatch& stopwatch);
+
+    // record a stage whose counters the operation has filled in while it ran, such as a graph traversal
+    PlanStage* record(QueryPlan* queryPlan, const PlanStage& stage, uint64_t actualRows, Stopwatch& stopwatch);
+
+}
+}
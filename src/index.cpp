@@ -19,6 +19,13 @@
  *
  */
 
+#include <cmath>
+#include <limits>
+#include <set>
+
+#include "compare.hpp"
+#include "constant.hpp"
+#include "dbinfo_adapter.hpp"
 #include "index.hpp"
 
 namespace nogdb {
@@ -26,17 +33,18 @@ namespace index {
     using namespace adapter::index;
     using namespace adapter::datarecord;
     using parser::RecordParser;
+    using compare::RecordCompare;
 
     const std::vector<Condition::Comparator> IndexUtils::validComparators {
-        Condition::Comparator::EQUAL//,
-    //            Condition::Comparator::BETWEEN_NO_BOUND,
-    //            Condition::Comparator::BETWEEN,
-    //            Condition::Comparator::BETWEEN_NO_UPPER,
-    //            Condition::Comparator::BETWEEN_NO_LOWER,
-    //            Condition::Comparator::LESS_EQUAL,
-    //            Condition::Comparator::LESS,
-    //            Condition::Comparator::GREATER_EQUAL,
-    //            Condition::Comparator::GREATER
+        Condition::Comparator::EQUAL,
+        Condition::Comparator::BETWEEN_NO_BOUND,
+        Condition::Comparator::BETWEEN,
+        Condition::Comparator::BETWEEN_NO_UPPER,
+        Condition::Comparator::BETWEEN_NO_LOWER,
+        Condition::Comparator::LESS_EQUAL,
+        Condition::Comparator::LESS,
+        Condition::Comparator::GREATER_EQUAL,
+        Condition::Comparator::GREATER
     };
 
     void IndexUtils::initialize(const Transaction *txn,
@@ -47,49 +55,15 @@ namespace index {
     {
         switch (propertyInfo.type) {
         case PropertyType::UNSIGNED_TINYINT:
-            createNumeric<uint64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
-                return static_cast<uint64_t>(value.toTinyIntU());
-            });
-            break;
         case PropertyType::UNSIGNED_SMALLINT:
-            createNumeric<uint64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
-                return static_cast<uint64_t>(value.toSmallIntU());
-            });
-            break;
         case PropertyType::UNSIGNED_INTEGER:
-            createNumeric<uint64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
-                return static_cast<uint64_t>(value.toIntU());
-            });
-            break;
         case PropertyType::UNSIGNED_BIGINT:
-            createNumeric<uint64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
-                return value.toBigIntU();
-            });
-            break;
         case PropertyType::TINYINT:
-            createSignedNumeric<int64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
-                return static_cast<int64_t>(value.toTinyInt());
-            });
-            break;
         case PropertyType::SMALLINT:
-            createSignedNumeric<int64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
-                return static_cast<int64_t>(value.toSmallInt());
-            });
-            break;
         case PropertyType::INTEGER:
-            createSignedNumeric<int64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
-                return static_cast<int64_t>(value.toInt());
-            });
-            break;
         case PropertyType::BIGINT:
-            createSignedNumeric<int64_t>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
-                return value.toBigInt();
-            });
-            break;
         case PropertyType::REAL:
-            createSignedNumeric<double>(txn, propertyInfo, indexInfo, superClassId, classType, [](const Bytes& value) {
-                return value.toReal();
-            });
+            createNumeric(txn, propertyInfo, indexInfo, superClassId, classType);
             break;
         case PropertyType::TEXT:
             createString(txn, propertyInfo, indexInfo, superClassId, classType);
@@ -107,17 +81,13 @@ namespace index {
         case PropertyType::UNSIGNED_TINYINT:
         case PropertyType::UNSIGNED_SMALLINT:
         case PropertyType::UNSIGNED_INTEGER:
-        case PropertyType::UNSIGNED_BIGINT: {
-            openIndexRecordPositive(txn, indexInfo).destroy();
-            break;
-        }
+        case PropertyType::UNSIGNED_BIGINT:
         case PropertyType::TINYINT:
         case PropertyType::SMALLINT:
         case PropertyType::INTEGER:
         case PropertyType::BIGINT:
         case PropertyType::REAL: {
-            openIndexRecordPositive(txn, indexInfo).destroy();
-            openIndexRecordNegative(txn, indexInfo).destroy();
+            openIndexRecordNumeric(txn, indexInfo).destroy();
             break;
         }
         case PropertyType::TEXT: {
@@ -129,6 +99,37 @@ namespace index {
         }
     }
 
+    void IndexUtils::initialize(const Transaction *txn,
+        const std::vector<PropertyAccessInfo>& propertyInfos,
+        const IndexAccessInfo& indexInfo,
+        const ClassId& superClassId,
+        const ClassType& classType)
+    {
+        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, indexInfo.classId, superClassId);
+        require(!propertyIdMapInfo.empty());
+        auto indexAccess = openIndexRecordString(txn, indexInfo);
+        auto dataRecord = DataRecord(txn->_txnBase, indexInfo.classId, classType);
+        IndexEntrySorter<std::string, std::string> sorter { INDEX_BUILD_MEMORY_LIMIT };
+        std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
+            [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
+                auto const record = RecordParser::parseRawData(
+                    result, propertyIdMapInfo, classType == ClassType::EDGE, txn->_txnCtx->isVersionEnabled());
+                auto key = getCompositeKey(indexInfo, propertyInfos, record, positionId);
+                if (!key.empty()) {
+                    sorter.add(key, getCompositeValue(indexInfo, propertyInfos, record, positionId));
+                }
+            };
+        dataRecord.resultSetIter(callback);
+        appendIndexRecords(indexAccess, sorter);
+    }
+
+    void IndexUtils::drop(const Transaction *txn,
+        const std::vector<PropertyAccessInfo>& propertyInfos,
+        const IndexAccessInfo& indexInfo)
+    {
+        openIndexRecordString(txn, indexInfo).destroy();
+    }
+
     void IndexUtils::drop(const Transaction *txn,
         const ClassId& classId,
         const PropertyNameMapInfo& propertyNameMapInfo)
@@ -139,6 +140,40 @@ namespace index {
                 drop(txn, property.second, indexInfo);
             }
         }
+        for (const auto& compositeIndexInfo : getCompositeIndexInfos(txn, classId, propertyNameMapInfo)) {
+            drop(txn, compositeIndexInfo.second, compositeIndexInfo.first);
+        }
+        for (const auto& textIndexInfo : getTextIndexInfos(txn, classId, propertyNameMapInfo)) {
+            dropText(txn, textIndexInfo.first);
+        }
+    }
+
+    void IndexUtils::initializeText(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const ClassId& superClassId,
+        const ClassType& classType)
+    {
+        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, indexInfo.classId, superClassId);
+        require(!propertyIdMapInfo.empty());
+        auto indexAccess = openIndexRecordString(txn, indexInfo);
+        auto dataRecord = DataRecord(txn->_txnBase, indexInfo.classId, classType);
+        IndexEntrySorter<std::string> sorter { INDEX_BUILD_MEMORY_LIMIT };
+        std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
+            [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
+                auto value = RecordParser::parseRawDataPropertyValue(
+                    result, propertyInfo.id, classType, txn->_txnCtx->isVersionEnabled());
+                for (const auto& gram : getTextGrams(Bytes { value.first, value.second }.toText())) {
+                    sorter.add(gram, encodePosting(positionId));
+                }
+            };
+        dataRecord.resultSetIter(callback);
+        appendIndexRecords(indexAccess, sorter);
+    }
+
+    void IndexUtils::dropText(const Transaction *txn, const IndexAccessInfo& indexInfo)
+    {
+        openIndexRecordString(txn, indexInfo).destroy();
     }
 
     void IndexUtils::insert(const Transaction *txn,
@@ -151,36 +186,20 @@ namespace index {
             try {
                 switch (propertyInfo.type) {
                 case PropertyType::UNSIGNED_TINYINT:
-                    insert(txn, indexInfo, posId, static_cast<uint64_t>(value.toTinyIntU()));
-                    break;
                 case PropertyType::UNSIGNED_SMALLINT:
-                    insert(txn, indexInfo, posId, static_cast<uint64_t>(value.toSmallIntU()));
-                    break;
                 case PropertyType::UNSIGNED_INTEGER:
-                    insert(txn, indexInfo, posId, static_cast<uint64_t>(value.toIntU()));
-                    break;
                 case PropertyType::UNSIGNED_BIGINT:
-                    insert(txn, indexInfo, posId, value.toBigIntU());
-                    break;
                 case PropertyType::TINYINT:
-                    insertSignedNumeric(txn, indexInfo, posId, static_cast<int64_t>(value.toTinyInt()));
-                    break;
                 case PropertyType::SMALLINT:
-                    insertSignedNumeric(txn, indexInfo, posId, static_cast<int64_t>(value.toSmallInt()));
-                    break;
                 case PropertyType::INTEGER:
-                    insertSignedNumeric(txn, indexInfo, posId, static_cast<int64_t>(value.toInt()));
-                    break;
                 case PropertyType::BIGINT:
-                    insertSignedNumeric(txn, indexInfo, posId, value.toBigInt());
-                    break;
                 case PropertyType::REAL:
-                    insertSignedNumeric(txn, indexInfo, posId, value.toReal());
+                    insert(txn, indexInfo, posId, getNumericKey(propertyInfo.type, value));
                     break;
                 case PropertyType::TEXT: {
                     auto valueString = value.toText();
                     if (!valueString.empty()) {
-                        insert(txn, indexInfo, posId, valueString);
+                        insert(txn, indexInfo, posId, getTextKey(getCollatedText(indexInfo, valueString)));
                     }
                     break;
                 }
@@ -219,36 +238,20 @@ namespace index {
         if (!value.empty()) {
             switch (propertyInfo.type) {
             case PropertyType::UNSIGNED_TINYINT:
-                removeByCursor(txn, indexInfo, posId, static_cast<uint64_t>(value.toTinyIntU()));
-                break;
             case PropertyType::UNSIGNED_SMALLINT:
-                removeByCursor(txn, indexInfo, posId, static_cast<uint64_t>(value.toSmallIntU()));
-                break;
             case PropertyType::UNSIGNED_INTEGER:
-                removeByCursor(txn, indexInfo, posId, static_cast<uint64_t>(value.toIntU()));
-                break;
             case PropertyType::UNSIGNED_BIGINT:
-                removeByCursor(txn, indexInfo, posId, value.toBigIntU());
-                break;
             case PropertyType::TINYINT:
-                removeByCursorWithSignNumeric(txn, indexInfo, posId, static_cast<int64_t>(value.toTinyInt()));
-                break;
             case PropertyType::SMALLINT:
-                removeByCursorWithSignNumeric(txn, indexInfo, posId, static_cast<int64_t>(value.toSmallInt()));
-                break;
             case PropertyType::INTEGER:
-                removeByCursorWithSignNumeric(txn, indexInfo, posId, static_cast<int64_t>(value.toInt()));
-                break;
             case PropertyType::BIGINT:
-                removeByCursorWithSignNumeric(txn, indexInfo, posId, value.toBigInt());
-                break;
             case PropertyType::REAL:
-                removeByCursorWithSignNumeric(txn, indexInfo, posId, value.toReal());
+                removeByCursor(txn, indexInfo, posId, getNumericKey(propertyInfo.type, value));
                 break;
             case PropertyType::TEXT: {
                 auto valueString = value.toText();
                 if (!valueString.empty()) {
-                    removeByCursor(txn, indexInfo, posId, valueString);
+                    removeByCursor(txn, indexInfo, posId, getTextKey(getCollatedText(indexInfo, valueString)));
                 }
                 break;
             }
@@ -271,397 +274,2161 @@ namespace index {
         }
     }
 
-    std::pair<bool, IndexAccessInfo> IndexUtils::hasIndex(const Transaction *txn,
-        const ClassAccessInfo& classInfo,
-        const PropertyAccessInfo& propertyInfo,
-        const Condition& condition)
+    void IndexUtils::insert(const Transaction *txn,
+        const RecordDescriptor& recordDescriptor,
+        const Record& record,
+        const CompositeIndexInfos& compositeIndexInfos)
     {
-        if (isValidComparator(condition)) {
-            // check if NOT is not used for EQUAL
-            if (condition.comp == Condition::Comparator::EQUAL && condition.isNegative) {
-                return std::make_pair(false, IndexAccessInfo {});
+        for (const auto& info : compositeIndexInfos) {
+            auto key = getCompositeKey(info.first, info.second, record, recordDescriptor.rid.second);
+            if (!key.empty()) {
+                try {
+                    auto value = getCompositeValue(info.first, info.second, record, recordDescriptor.rid.second);
+                    openIndexRecordString(txn, info.first).create(key, getIndexValue(value));
+                } catch (const Error& err) {
+                    if (err.code() == MDB_KEYEXIST) {
+                        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_UNIQUE_CONSTRAINT);
+                    } else {
+                        throw NOGDB_FATAL_ERROR(err);
+                    }
+                }
             }
-            auto indexInfo = txn->_adapter->dbIndex()->getInfo(classInfo.id, propertyInfo.id);
-            return std::make_pair(indexInfo.id != IndexId {}, indexInfo);
         }
-        return std::make_pair(false, IndexAccessInfo {});
     }
 
-    PropertyNameMapIndex IndexUtils::getIndexInfos(const Transaction *txn,
+    void IndexUtils::remove(const Transaction *txn,
         const RecordDescriptor& recordDescriptor,
         const Record& record,
-        const PropertyNameMapInfo& propertyNameMapInfo)
+        const CompositeIndexInfos& compositeIndexInfos)
     {
-        auto result = std::map<std::string, std::pair<PropertyAccessInfo, IndexAccessInfo>> {};
-        for (const auto& property : record.getAll()) {
-            if (property.second.empty())
-                continue;
-            auto foundProperty = propertyNameMapInfo.find(property.first);
-            if (foundProperty == propertyNameMapInfo.cend()) {
-                throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_NOEXST_PROPERTY);
-            } else {
-                auto indexInfo =
-                    txn->_adapter->dbIndex()->getInfo(recordDescriptor.rid.first, foundProperty->second.id);
-                if (indexInfo.id != IndexId {}) {
-                    result.emplace(property.first, std::make_pair(foundProperty->second, indexInfo));
-                }
+        for (const auto& info : compositeIndexInfos) {
+            auto key = getCompositeKey(info.first, info.second, record, recordDescriptor.rid.second);
+            if (!key.empty()) {
+                removeByCursor(txn, info.first, recordDescriptor.rid.second, key);
             }
         }
-        return result;
     }
 
-    std::pair<bool, PropertyIdMapIndex> IndexUtils::hasIndex(const Transaction *txn,
-        const ClassAccessInfo& classInfo,
-        const PropertyNameMapInfo& propertyInfos,
-        const MultiCondition& conditions)
+    CompositeIndexInfos IndexUtils::getCompositeIndexInfos(const Transaction *txn,
+        const ClassId& classId,
+        const PropertyNameMapInfo& propertyNameMapInfo)
     {
-        if (conditions.cmpFunctions.empty()) {
-            auto isFoundAll = true;
-            auto result = PropertyIdMapIndex{};
-            auto conditionPropNames = std::unordered_set<std::string>{};
-            for (const auto &condition : conditions.conditions) {
-                if (auto conditionPtr = condition.lock()) {
-                    auto propertyName = conditionPtr->getCondition().propName;
-                    if (conditionPropNames.find(propertyName) == conditionPropNames.cend()) {
-                        auto propertyInfo = propertyInfos.find(propertyName);
-                        if (propertyInfo == propertyInfos.cend())
-                            continue;
-                        conditionPropNames.emplace(propertyName);
-                        auto searchIndexResult =
-                            hasIndex(txn, classInfo, propertyInfo->second,conditionPtr->getCondition());
-                        if (searchIndexResult.first) {
-                            auto propertyId = txn->_adapter->dbProperty()->getId(classInfo.id, propertyName);
-                            result.emplace(propertyId, searchIndexResult.second);
-                        } else {
-                            isFoundAll = false;
-                            break;
-                        }
-                    }
-                } else {
-                    isFoundAll = false;
+        auto result = CompositeIndexInfos {};
+        for (const auto& indexInfo : txn->_adapter->dbCompositeIndex()->getInfos(classId)) {
+            // the key columns are followed by the included columns
+            auto propertyIds = indexInfo.propertyIds;
+            propertyIds.insert(
+                propertyIds.cend(), indexInfo.includedPropertyIds.cbegin(), indexInfo.includedPropertyIds.cend());
+            auto propertyInfos = std::vector<PropertyAccessInfo> {};
+            for (const auto& propertyId : propertyIds) {
+                auto foundProperty = std::find_if(propertyNameMapInfo.cbegin(), propertyNameMapInfo.cend(),
+                    [&propertyId](const PropertyNameMapInfo::value_type& property) {
+                        return property.second.id == propertyId;
+                    });
+                if (foundProperty == propertyNameMapInfo.cend()) {
                     break;
                 }
+                propertyInfos.emplace_back(foundProperty->second);
+            }
+            if (propertyInfos.size() == propertyIds.size()) {
+                result.emplace_back(indexInfo, propertyInfos);
             }
-            return std::make_pair(isFoundAll, (isFoundAll) ? result : PropertyIdMapIndex{});
-        } else {
-            return std::make_pair(false, PropertyIdMapIndex{});
         }
+        return result;
     }
 
-    std::vector<RecordDescriptor> IndexUtils::getRecord(const Transaction *txn,
-        const PropertyAccessInfo& propertyInfo,
-        const IndexAccessInfo& indexInfo,
-        const Condition& condition,
-        bool isNegative)
+    void IndexUtils::insert(const Transaction *txn,
+        const RecordDescriptor& recordDescriptor,
+        const Record& record,
+        const TextIndexInfos& textIndexInfos)
     {
-        auto isApplyNegative = condition.isNegative ^ isNegative;
-        switch (condition.comp) {
-        case Condition::Comparator::EQUAL: {
-            if (!isApplyNegative) {
-                auto result = getEqual(txn, propertyInfo, indexInfo, condition.valueBytes);
-                sortByRdesc(result);
-                return result;
-            } else {
-                auto lessResult = getLessThan(txn, propertyInfo, indexInfo, condition.valueBytes);
-                auto greaterResult = getGreaterThan(txn, propertyInfo, indexInfo, condition.valueBytes);
-                lessResult.insert(lessResult.end(), greaterResult.cbegin(), greaterResult.cend());
-                sortByRdesc(lessResult);
-                return lessResult;
-            }
-        }
-        case Condition::Comparator::LESS_EQUAL: {
-            if (!isApplyNegative) {
-                auto result = getLessOrEqual(txn, propertyInfo, indexInfo, condition.valueBytes);
-                sortByRdesc(result);
-                return result;
-            } else {
-                auto result = getGreaterThan(txn, propertyInfo, indexInfo, condition.valueBytes);
-                sortByRdesc(result);
-                return result;
+        auto posting = getIndexValue(encodePosting(recordDescriptor.rid.second));
+        for (const auto& info : textIndexInfos) {
+            auto indexAccess = openIndexRecordString(txn, info.first);
+            for (const auto& gram : getTextGrams(record.get(info.second.name).toText())) {
+                indexAccess.create(gram, posting);
             }
         }
-        case Condition::Comparator::LESS: {
-            if (!isApplyNegative) {
-                auto result = getLessThan(txn, propertyInfo, indexInfo, condition.valueBytes);
-                sortByRdesc(result);
-                return result;
-            } else {
-                auto result = getGreaterOrEqual(txn, propertyInfo, indexInfo, condition.valueBytes);
-                sortByRdesc(result);
-                return result;
+    }
+
+    void IndexUtils::remove(const Transaction *txn,
+        const RecordDescriptor& recordDescriptor,
+        const Record& record,
+        const TextIndexInfos& textIndexInfos)
+    {
+        auto posting = encodePosting(recordDescriptor.rid.second);
+        for (const auto& info : textIndexInfos) {
+            auto indexAccessCursor = openIndexRecordString(txn, info.first).getCursor();
+            for (const auto& gram : getTextGrams(record.get(info.second.name).toText())) {
+                auto keyValue = indexAccessCursor.findRange(gram, posting);
+                if (!keyValue.empty() && keyValue.key.data.string() == gram
+                    && keyValue.val.data.numeric<PositionId>() == posting) {
+                    indexAccessCursor.del();
+                }
             }
         }
-        case Condition::Comparator::GREATER_EQUAL: {
-            if (!isApplyNegative) {
-                auto result = getGreaterOrEqual(txn, propertyInfo, indexInfo, condition.valueBytes);
-                sortByRdesc(result);
-                return result;
-            } else {
-                auto result = getLessThan(txn, propertyInfo, indexInfo, condition.valueBytes);
-                sortByRdesc(result);
-                return result;
+    }
+
+    TextIndexInfos IndexUtils::getTextIndexInfos(const Transaction *txn,
+        const ClassId& classId,
+        const PropertyNameMapInfo& propertyNameMapInfo)
+    {
+        auto result = TextIndexInfos {};
+        for (const auto& indexInfo : txn->_adapter->dbTextIndex()->getInfos(classId)) {
+            auto foundProperty = std::find_if(propertyNameMapInfo.cbegin(), propertyNameMapInfo.cend(),
+                [&indexInfo](const PropertyNameMapInfo::value_type& property) {
+                    return property.second.id == indexInfo.propertyId;
+                });
+            if (foundProperty != propertyNameMapInfo.cend()) {
+                result.emplace_back(indexInfo, foundProperty->second);
             }
         }
-        case Condition::Comparator::GREATER: {
-            if (!isApplyNegative) {
-                auto result = getGreaterThan(txn, propertyInfo, indexInfo, condition.valueBytes);
-                sortByRdesc(result);
-                return result;
-            } else {
-                auto result = getLessOrEqual(txn, propertyInfo, indexInfo, condition.valueBytes);
-                sortByRdesc(result);
-                return result;
-            }
+        return result;
+    }
+
+    void IndexUtils::initializePolymorphic(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo)
+    {
+        auto classInfos = std::vector<ClassAccessInfo> { SchemaUtils::getExistingClass(txn, indexInfo.classId) };
+        for (const auto& subClassInfo : SchemaUtils::getSubClassInfos(txn, indexInfo.classId)) {
+            classInfos.emplace_back(subClassInfo.second);
         }
-        case Condition::Comparator::BETWEEN_NO_BOUND: {
-            if (!isApplyNegative) {
-                auto result = getBetween(
-                    txn,propertyInfo, indexInfo, condition.valueSet[0], condition.valueSet[1], { false, false });
-                sortByRdesc(result);
-                return result;
-            } else {
-                auto lessResult = getLessOrEqual(txn, propertyInfo, indexInfo, condition.valueSet[0]);
-                auto greaterResult = getGreaterOrEqual(txn, propertyInfo, indexInfo, condition.valueSet[1]);
-                lessResult.insert(lessResult.end(), greaterResult.cbegin(), greaterResult.cend());
-                sortByRdesc(lessResult);
-                return lessResult;
-            }
+        auto indexAccess = openIndexRecordString(txn, indexInfo);
+        IndexEntrySorter<std::string, std::string> sorter { INDEX_BUILD_MEMORY_LIMIT };
+        for (const auto& classInfo : classInfos) {
+            auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
+            std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
+                [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
+                    auto value = RecordParser::parseRawDataPropertyValue(
+                        result, propertyInfo.id, classInfo.type, txn->_txnCtx->isVersionEnabled());
+                    auto key = getPolymorphicKey(propertyInfo.type, Bytes { value.first, value.second });
+                    if (!key.empty()) {
+                        sorter.add(key, getPolymorphicValue(RecordId { classInfo.id, positionId }));
+                    }
+                };
+            dataRecord.resultSetIter(callback);
         }
-        case Condition::Comparator::BETWEEN: {
-            if (!isApplyNegative) {
-                auto result = getBetween(
-                    txn, propertyInfo, indexInfo, condition.valueSet[0], condition.valueSet[1], { true, true });
-                sortByRdesc(result);
-                return result;
-            } else {
-                auto lessResult = getLessThan(txn, propertyInfo, indexInfo, condition.valueSet[0]);
-                auto greaterResult = getGreaterThan(txn, propertyInfo, indexInfo, condition.valueSet[1]);
-                lessResult.insert(lessResult.end(), greaterResult.cbegin(), greaterResult.cend());
-                sortByRdesc(lessResult);
-                return lessResult;
+        appendIndexRecords(indexAccess, sorter);
+    }
+
+    void IndexUtils::dropPolymorphic(const Transaction *txn, const IndexAccessInfo& indexInfo)
+    {
+        openIndexRecordString(txn, indexInfo).destroy();
+    }
+
+    void IndexUtils::insertPolymorphic(const Transaction *txn,
+        const RecordDescriptor& recordDescriptor,
+        const Record& record,
+        const PolymorphicIndexInfos& polymorphicIndexInfos)
+    {
+        auto value = getIndexValue(getPolymorphicValue(recordDescriptor.rid));
+        for (const auto& info : polymorphicIndexInfos) {
+            auto key = getPolymorphicKey(info.second.type, record.get(info.second.name));
+            if (!key.empty()) {
+                openIndexRecordString(txn, info.first).create(key, value);
             }
         }
-        case Condition::Comparator::BETWEEN_NO_UPPER: {
-            if (!isApplyNegative) {
-                auto result = getBetween(
-                    txn, propertyInfo, indexInfo, condition.valueSet[0], condition.valueSet[1], { true, false });
-                sortByRdesc(result);
-                return result;
-            } else {
-                auto lessResult = getLessThan(txn, propertyInfo, indexInfo, condition.valueSet[0]);
-                auto greaterResult = getGreaterOrEqual(txn, propertyInfo, indexInfo, condition.valueSet[1]);
-                lessResult.insert(lessResult.end(), greaterResult.cbegin(), greaterResult.cend());
-                sortByRdesc(lessResult);
-                return lessResult;
+    }
+
+    void IndexUtils::removePolymorphic(const Transaction *txn,
+        const RecordDescriptor& recordDescriptor,
+        const Record& record,
+        const PolymorphicIndexInfos& polymorphicIndexInfos)
+    {
+        auto value = getPolymorphicValue(recordDescriptor.rid);
+        auto valueBytes = std::array<char, sizeof(ClassId) + sizeof(PositionId)> {};
+        std::memcpy(valueBytes.data(), value.data(), valueBytes.size());
+        for (const auto& info : polymorphicIndexInfos) {
+            auto key = getPolymorphicKey(info.second.type, record.get(info.second.name));
+            if (!key.empty()) {
+                auto indexAccessCursor = openIndexRecordString(txn, info.first).getCursor();
+                auto keyValue = indexAccessCursor.findRange(key, valueBytes);
+                if (!keyValue.empty() && keyValue.key.data.string() == key && keyValue.val.data.string() == value) {
+                    indexAccessCursor.del();
+                }
             }
         }
-        case Condition::Comparator::BETWEEN_NO_LOWER: {
-            if (!isApplyNegative) {
-                auto result = getBetween(
-                    txn, propertyInfo, indexInfo, condition.valueSet[0], condition.valueSet[1], { false, true });
-                sortByRdesc(result);
-                return result;
-            } else {
-                auto lessResult = getLessOrEqual(txn, propertyInfo, indexInfo, condition.valueSet[0]);
-                auto greaterResult = getGreaterThan(txn, propertyInfo, indexInfo, condition.valueSet[1]);
-                lessResult.insert(lessResult.end(), greaterResult.cbegin(), greaterResult.cend());
-                sortByRdesc(lessResult);
-                return lessResult;
+    }
+
+    PolymorphicIndexInfos IndexUtils::getPolymorphicIndexInfos(const Transaction *txn,
+        const ClassId& classId,
+        const PropertyNameMapInfo& propertyNameMapInfo)
+    {
+        auto result = PolymorphicIndexInfos {};
+        for (auto currentClassId = classId; currentClassId != ClassId {};
+             currentClassId = txn->_adapter->dbClass()->getSuperClassId(currentClassId)) {
+            for (const auto& indexInfo : txn->_adapter->dbPolymorphicIndex()->getInfos(currentClassId)) {
+                auto foundProperty = std::find_if(propertyNameMapInfo.cbegin(), propertyNameMapInfo.cend(),
+                    [&indexInfo](const PropertyNameMapInfo::value_type& property) {
+                        return property.second.id == indexInfo.propertyId;
+                    });
+                if (foundProperty != propertyNameMapInfo.cend()) {
+                    result.emplace_back(indexInfo, foundProperty->second);
+                }
             }
         }
-        default:
-            break;
-        }
-        return std::vector<RecordDescriptor> {};
+        return result;
     }
 
-  size_t IndexUtils::getCountRecord(const Transaction *txn,
-      const PropertyAccessInfo& propertyInfo,
-      const IndexAccessInfo& indexInfo,
-      const Condition& condition,
-      bool isNegative)
-  {
-    auto isApplyNegative = condition.isNegative ^ isNegative;
-    switch (condition.comp) {
-      case Condition::Comparator::EQUAL: {
-        if (!isApplyNegative) {
-          return getEqual(txn, propertyInfo, indexInfo, condition.valueBytes).size();
-        } else {
-          auto lessResult = getLessThan(txn, propertyInfo, indexInfo, condition.valueBytes);
-          auto greaterResult = getGreaterThan(txn, propertyInfo, indexInfo, condition.valueBytes);
-          return lessResult.size() + greaterResult.size();
-        }
-      }
-      case Condition::Comparator::LESS_EQUAL: {
-        if (!isApplyNegative) {
-          return getLessOrEqual(txn, propertyInfo, indexInfo, condition.valueBytes).size();
-        } else {
-          return getGreaterThan(txn, propertyInfo, indexInfo, condition.valueBytes).size();
-        }
-      }
-      case Condition::Comparator::LESS: {
-        if (!isApplyNegative) {
-          return getLessThan(txn, propertyInfo, indexInfo, condition.valueBytes).size();
-        } else {
-          return getGreaterOrEqual(txn, propertyInfo, indexInfo, condition.valueBytes).size();
-        }
-      }
-      case Condition::Comparator::GREATER_EQUAL: {
-        if (!isApplyNegative) {
-          return getGreaterOrEqual(txn, propertyInfo, indexInfo, condition.valueBytes).size();
-        } else {
-          return getLessThan(txn, propertyInfo, indexInfo, condition.valueBytes).size();
-        }
-      }
-      case Condition::Comparator::GREATER: {
-        if (!isApplyNegative) {
-          return getGreaterThan(txn, propertyInfo, indexInfo, condition.valueBytes).size();
-        } else {
-          return getLessOrEqual(txn, propertyInfo, indexInfo, condition.valueBytes).size();
+    IndexConjunct IndexUtils::getPolymorphicConjunct(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const Condition& condition)
+    {
+        auto conjunct = IndexConjunct {};
+        auto foundProperty = propertyInfos.find(condition.propName);
+        if (foundProperty == propertyInfos.cend() || condition.isNegative || isInList(condition)
+            || !isIndexable(foundProperty->second, condition)) {
+            return conjunct;
         }
-      }
-      case Condition::Comparator::BETWEEN_NO_BOUND: {
-        if (!isApplyNegative) {
-          return getBetween(
-              txn, propertyInfo, indexInfo, condition.valueSet[0], condition.valueSet[1], { false, false }).size();
-        } else {
-          auto lessResult = getLessOrEqual(txn, propertyInfo, indexInfo, condition.valueSet[0]);
-          auto greaterResult = getGreaterOrEqual(txn, propertyInfo, indexInfo, condition.valueSet[1]);
-          return lessResult.size() + greaterResult.size();
-        }
-      }
-      case Condition::Comparator::BETWEEN: {
-        if (!isApplyNegative) {
-          return getBetween(
-              txn, propertyInfo, indexInfo, condition.valueSet[0], condition.valueSet[1], { true, true }).size();
-        } else {
-          auto lessResult = getLessThan(txn, propertyInfo, indexInfo, condition.valueSet[0]);
-          auto greaterResult = getGreaterThan(txn, propertyInfo, indexInfo, condition.valueSet[1]);
-          return lessResult.size() + greaterResult.size();
-        }
-      }
-      case Condition::Comparator::BETWEEN_NO_UPPER: {
-        if (!isApplyNegative) {
-          return getBetween(
-              txn, propertyInfo, indexInfo, condition.valueSet[0], condition.valueSet[1], { true, false }).size();
-        } else {
-          auto lessResult = getLessThan(txn, propertyInfo, indexInfo, condition.valueSet[0]);
-          auto greaterResult = getGreaterOrEqual(txn, propertyInfo, indexInfo, condition.valueSet[1]);
-          return lessResult.size() + greaterResult.size();
-        }
-      }
-      case Condition::Comparator::BETWEEN_NO_LOWER: {
-        if (!isApplyNegative) {
-          return getBetween(
-              txn, propertyInfo, indexInfo, condition.valueSet[0], condition.valueSet[1], { false, true }).size();
-        } else {
-          auto lessResult = getLessOrEqual(txn, propertyInfo, indexInfo, condition.valueSet[0]);
-          auto greaterResult = getGreaterThan(txn, propertyInfo, indexInfo, condition.valueSet[1]);
-          return lessResult.size() + greaterResult.size();
+        auto indexInfo = txn->_adapter->dbPolymorphicIndex()->getInfo(classInfo.id, foundProperty->second.id);
+        if (indexInfo.id == IndexId {}) {
+            return conjunct;
         }
-      }
-      default:
-        break;
+        conjunct.condition = &condition;
+        conjunct.propertyInfo = foundProperty->second;
+        conjunct.indexInfo = indexInfo;
+        conjunct.keyConditions.emplace_back(&condition);
+        conjunct.keyPropertyInfos.emplace_back(foundProperty->second);
+        // the values of a polymorphic index are not positions of one class whose records could be checked,
+        // so the estimate also counts the other long texts which share the prefix of a long text bound
+        auto lowerKey = std::string {};
+        auto upperKey = std::string {};
+        auto isIncludeBound = std::make_pair(true, true);
+        getCompositeKeyRange(conjunct, lowerKey, upperKey, isIncludeBound);
+        conjunct.estimatedCount = getCountKeyRange(txn, indexInfo, lowerKey, upperKey, isIncludeBound);
+        return conjunct;
     }
-    return size_t {0};
-  }
 
-    std::vector<RecordDescriptor> IndexUtils::getRecord(const Transaction *txn,
+    IndexConjunct IndexUtils::getPolymorphicConjunct(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
         const PropertyNameMapInfo& propertyInfos,
-        const PropertyIdMapIndex& propertyIndexInfo,
         const MultiCondition& conditions)
     {
-        return getRecordFromMultiCondition(txn, propertyInfos, propertyIndexInfo, conditions.root.get(), false);
+        // only conjuncts reached through non-negated AND nodes must hold for every result
+        auto conjunctConditions = std::vector<const Condition*> {};
+        getConjunctConditions(conditions.root, conjunctConditions);
+        auto result = IndexConjunct {};
+        for (const auto& condition : conjunctConditions) {
+            auto conjunct = getPolymorphicConjunct(txn, classInfo, propertyInfos, *condition);
+            if (!conjunct.keyConditions.empty()
+                && (result.keyConditions.empty() || conjunct.estimatedCount < result.estimatedCount)) {
+                result = conjunct;
+            }
+        }
+        return result;
     }
 
-    size_t IndexUtils::getCountRecord(const Transaction *txn,
-        const PropertyNameMapInfo& propertyInfos,
+    std::vector<RecordDescriptor> IndexUtils::getPolymorphicRecord(const Transaction *txn,
+        const IndexConjunct& conjunct)
+    {
+        auto result = std::vector<RecordDescriptor> {};
+        if (conjunct.keyConditions.empty()) {
+            return result;
+        }
+        auto lowerKey = std::string {};
+        auto upperKey = std::string {};
+        auto isIncludeBound = std::make_pair(true, true);
+        // a range around a long text may hold more records, which are dropped when the condition is checked
+        getCompositeKeyRange(conjunct, lowerKey, upperKey, isIncludeBound);
+
+        auto cursorHandler = openIndexRecordString(txn, conjunct.indexInfo).getCursor();
+        for (auto keyValue = cursorHandler.findRange(lowerKey);
+             !keyValue.empty();
+             keyValue = cursorHandler.getNext()) {
+            auto key = keyValue.key.data.string();
+            if (!isIncludeBound.first && key.compare(0, lowerKey.size(), lowerKey) == 0)
+                continue;
+            auto upperCompare = key.compare(0, upperKey.size(), upperKey);
+            if (upperCompare > 0 || (upperCompare == 0 && !isIncludeBound.second))
+                break;
+            result.emplace_back(RecordDescriptor { parsePolymorphicValue(keyValue.val.data.string()) });
+        }
+        sortByRdesc(result);
+        return result;
+    }
+
+    void IndexUtils::update(const Transaction *txn,
+        const RecordDescriptor& recordDescriptor,
+        const Record& existingRecord,
+        const Record& record,
+        const PropertyNameMapInfo& propertyNameMapInfo)
+    {
+        auto changedProperties = std::set<std::string> {};
+        for (const auto& property : propertyNameMapInfo) {
+            auto existingValue = existingRecord.get(property.first);
+            auto value = record.get(property.first);
+            if (existingValue.size() != value.size()
+                || (!value.empty() && std::memcmp(existingValue.getRaw(), value.getRaw(), value.size()) != 0)) {
+                changedProperties.insert(property.first);
+            }
+        }
+        if (changedProperties.empty()) {
+            return;
+        }
+        auto isChanged = [&](const std::string& propertyName) {
+            return changedProperties.find(propertyName) != changedProperties.cend();
+        };
+        // a record enters or leaves a partial index when a property of its predicate is changed
+        auto isPredicateChanged = [&](const IndexAccessInfo& indexInfo) {
+            for (const auto& predicateCondition : getPredicateConditions(indexInfo, propertyNameMapInfo)) {
+                if (isChanged(predicateCondition.first.name)) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        auto getChangedIndexInfos = [&](const Record& changedRecord) {
+            auto indexInfos = getIndexInfos(txn, recordDescriptor, changedRecord, propertyNameMapInfo);
+            for (auto it = indexInfos.begin(); it != indexInfos.end();) {
+                it = (isChanged(it->first) || isPredicateChanged(it->second.second)) ? std::next(it)
+                                                                                   : indexInfos.erase(it);
+            }
+            return indexInfos;
+        };
+        auto compositeIndexInfos = CompositeIndexInfos {};
+        for (const auto& compositeIndexInfo :
+            getCompositeIndexInfos(txn, recordDescriptor.rid.first, propertyNameMapInfo)) {
+            if (std::any_of(compositeIndexInfo.second.cbegin(), compositeIndexInfo.second.cend(),
+                    [&](const PropertyAccessInfo& propertyInfo) { return isChanged(propertyInfo.name); })) {
+                compositeIndexInfos.emplace_back(compositeIndexInfo);
+            }
+        }
+        auto textIndexInfos = TextIndexInfos {};
+        for (const auto& textIndexInfo : getTextIndexInfos(txn, recordDescriptor.rid.first, propertyNameMapInfo)) {
+            if (isChanged(textIndexInfo.second.name)) {
+                textIndexInfos.emplace_back(textIndexInfo);
+            }
+        }
+        auto polymorphicIndexInfos = PolymorphicIndexInfos {};
+        for (const auto& polymorphicIndexInfo :
+            getPolymorphicIndexInfos(txn, recordDescriptor.rid.first, propertyNameMapInfo)) {
+            if (isChanged(polymorphicIndexInfo.second.name)) {
+                polymorphicIndexInfos.emplace_back(polymorphicIndexInfo);
+            }
+        }
+        // remove index if applied in existing record, including properties which are emptied by the update
+        remove(txn, recordDescriptor, existingRecord, getChangedIndexInfos(existingRecord));
+        remove(txn, recordDescriptor, existingRecord, compositeIndexInfos);
+        remove(txn, recordDescriptor, existingRecord, textIndexInfos);
+        removePolymorphic(txn, recordDescriptor, existingRecord, polymorphicIndexInfos);
+        // add index if applied in new record
+        insert(txn, recordDescriptor, record, getChangedIndexInfos(record));
+        insert(txn, recordDescriptor, record, compositeIndexInfos);
+        insert(txn, recordDescriptor, record, textIndexInfos);
+        insertPolymorphic(txn, recordDescriptor, record, polymorphicIndexInfos);
+    }
+
+    RecordDescriptor IndexUtils::getUniqueRecord(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyNameMapInfo,
+        const std::string& propertyName,
+        const Record& record)
+    {
+        auto foundProperty = propertyNameMapInfo.find(propertyName);
+        if (foundProperty == propertyNameMapInfo.cend()) {
+            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_NOEXST_PROPERTY);
+        }
+        auto value = record.get(propertyName);
+        if (value.empty()) {
+            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_NOEXST_PROPERTY);
+        }
+        auto indexInfo = txn->_adapter->dbIndex()->getInfo(classInfo.id, foundProperty->second.id);
+        // a unique partial index only holds the records which satisfy its predicate
+        if (indexInfo.id == IndexId {} || !indexInfo.isUnique
+            || !isInPredicate(getPredicateConditions(indexInfo, propertyNameMapInfo), record)) {
+            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_NOEXST_INDEX);
+        }
+        auto result = getRecord(txn, foundProperty->second, indexInfo, Condition(propertyName).eq(value));
+        return result.empty() ? RecordDescriptor {} : result.front();
+    }
+
+    std::string IndexUtils::getPredicate(const PropertyNameMapInfo& propertyInfos,
+        const std::vector<const Condition*>& conditions)
+    {
+        auto predicate = std::string {};
+        auto append = [&](const void* data, size_t size) {
+            predicate.append(static_cast<const char*>(data), size);
+        };
+        auto appendValue = [&](const Bytes& value) {
+            auto size = static_cast<uint32_t>(value.size());
+            append(&size, sizeof(uint32_t));
+            append(value.getRaw(), value.size());
+        };
+        // {propertyId<uint16>}{comparator<uint8>}{flags<uint8>}{value}{numValues<uint16>}[{value}]...
+        // for each condition, where a value is {size<uint32>}{bytes}
+        for (const auto& condition : conditions) {
+            auto foundProperty = propertyInfos.find(condition->propName);
+            if (foundProperty == propertyInfos.cend()) {
+                throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_NOEXST_PROPERTY);
+            }
+            // a predicate which cannot be evaluated on its property would fail every later write of the class
+            if (!RecordCompare::isComparable(foundProperty->second.type, *condition)) {
+                throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_COMPARATOR);
+            }
+            auto comparator = static_cast<uint8_t>(condition->comp);
+            auto flags = static_cast<uint8_t>((condition->isIgnoreCase ? 1 : 0) | (condition->isNegative ? 2 : 0));
+            append(&foundProperty->second.id, sizeof(PropertyId));
+            append(&comparator, sizeof(uint8_t));
+            append(&flags, sizeof(uint8_t));
+            appendValue(condition->valueBytes);
+            auto numValues = static_cast<uint16_t>(condition->valueSet.size());
+            append(&numValues, sizeof(uint16_t));
+            for (const auto& value : condition->valueSet) {
+                appendValue(value);
+            }
+        }
+        return predicate;
+    }
+
+    std::vector<const Condition*> IndexUtils::getPredicateConditions(const MultiCondition& predicate)
+    {
+        auto conditions = std::vector<const Condition*> {};
+        if (!predicate.cmpFunctions.empty() || !getConjunctConditions(predicate.root, conditions)) {
+            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_COMPARATOR);
+        }
+        return conditions;
+    }
+
+    bool IndexUtils::isUsedByPredicate(const Transaction *txn, const ClassId& classId, const PropertyId& propertyId)
+    {
+        for (const auto& indexInfo : txn->_adapter->dbIndex()->getInfos(classId)) {
+            for (const auto& predicateCondition : parsePredicate(indexInfo.predicate)) {
+                if (predicateCondition.first == propertyId) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    std::vector<std::pair<PropertyId, Condition>> IndexUtils::parsePredicate(const std::string& predicate)
+    {
+        auto result = std::vector<std::pair<PropertyId, Condition>> {};
+        auto offset = size_t { 0 };
+        auto retrieve = [&](void* data, size_t size) {
+            std::memcpy(data, predicate.data() + offset, size);
+            offset += size;
+        };
+        auto retrieveValue = [&]() {
+            auto size = uint32_t {};
+            retrieve(&size, sizeof(uint32_t));
+            auto value = Bytes { reinterpret_cast<const unsigned char*>(predicate.data() + offset), size };
+            offset += size;
+            return value;
+        };
+        while (offset < predicate.size()) {
+            auto propertyId = PropertyId {};
+            auto comparator = uint8_t {};
+            auto flags = uint8_t {};
+            retrieve(&propertyId, sizeof(PropertyId));
+            retrieve(&comparator, sizeof(uint8_t));
+            retrieve(&flags, sizeof(uint8_t));
+            auto condition = Condition { std::string {} };
+            condition.comp = static_cast<Condition::Comparator>(comparator);
+            condition.isIgnoreCase = (flags & 1) != 0;
+            condition.isNegative = (flags & 2) != 0;
+            condition.valueBytes = retrieveValue();
+            auto numValues = uint16_t {};
+            retrieve(&numValues, sizeof(uint16_t));
+            for (auto i = uint16_t { 0 }; i < numValues; ++i) {
+                condition.valueSet.emplace_back(retrieveValue());
+            }
+            result.emplace_back(propertyId, std::move(condition));
+        }
+        return result;
+    }
+
+    std::vector<std::pair<PropertyAccessInfo, Condition>> IndexUtils::getPredicateConditions(
+        const IndexAccessInfo& indexInfo,
+        const PropertyNameMapInfo& propertyInfos)
+    {
+        auto result = std::vector<std::pair<PropertyAccessInfo, Condition>> {};
+        for (auto& predicateCondition : parsePredicate(indexInfo.predicate)) {
+            auto foundProperty = std::find_if(propertyInfos.cbegin(), propertyInfos.cend(),
+                [&](const std::pair<const std::string, PropertyAccessInfo>& property) {
+                    return property.second.id == predicateCondition.first;
+                });
+            require(foundProperty != propertyInfos.cend());
+            predicateCondition.second.propName = foundProperty->first;
+            result.emplace_back(foundProperty->second, std::move(predicateCondition.second));
+        }
+        return result;
+    }
+
+    bool IndexUtils::isInPredicate(const std::vector<std::pair<PropertyAccessInfo, Condition>>& predicateConditions,
+        const Record& record)
+    {
+        return std::all_of(predicateConditions.cbegin(), predicateConditions.cend(),
+            [&](const std::pair<PropertyAccessInfo, Condition>& predicateCondition) {
+                return RecordCompare::compareRecordByCondition(
+                    record, predicateCondition.first.type, predicateCondition.second);
+            });
+    }
+
+    bool IndexUtils::isPredicateImplied(const IndexAccessInfo& indexInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const std::vector<const Condition*>& conditions)
+    {
+        for (const auto& predicateCondition : parsePredicate(indexInfo.predicate)) {
+            auto isImplied = std::any_of(conditions.cbegin(), conditions.cend(), [&](const Condition* condition) {
+                auto foundProperty = propertyInfos.find(condition->propName);
+                return foundProperty != propertyInfos.cend() && foundProperty->second.id == predicateCondition.first
+                    && isSameCondition(*condition, predicateCondition.second);
+            });
+            if (!isImplied) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool IndexUtils::isSameCondition(const Condition& lhs, const Condition& rhs)
+    {
+        auto isSameValue = [](const Bytes& lhsValue, const Bytes& rhsValue) {
+            return lhsValue.size() == rhsValue.size()
+                && (lhsValue.empty() || std::memcmp(lhsValue.getRaw(), rhsValue.getRaw(), lhsValue.size()) == 0);
+        };
+        return lhs.comp == rhs.comp && lhs.isIgnoreCase == rhs.isIgnoreCase && lhs.isNegative == rhs.isNegative
+            && isSameValue(lhs.valueBytes, rhs.valueBytes) && lhs.valueSet.size() == rhs.valueSet.size()
+            && std::equal(lhs.valueSet.cbegin(), lhs.valueSet.cend(), rhs.valueSet.cbegin(), isSameValue);
+    }
+
+    std::pair<bool, IndexAccessInfo> IndexUtils::hasIndex(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyAccessInfo& propertyInfo,
+        const Condition& condition)
+    {
+        return hasIndex(txn, classInfo, propertyInfo, condition,
+            PropertyNameMapInfo { { condition.propName, propertyInfo } },
+            std::vector<const Condition*> { &condition });
+    }
+
+    std::pair<bool, IndexAccessInfo> IndexUtils::hasIndex(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyAccessInfo& propertyInfo,
+        const Condition& condition,
+        const PropertyNameMapInfo& propertyInfos,
+        const std::vector<const Condition*>& conjunctConditions)
+    {
+        if (isTextPattern(condition)) {
+            if (propertyInfo.type == PropertyType::TEXT && !condition.isNegative && isPrefixLookup(condition)) {
+                auto indexInfo = txn->_adapter->dbIndex()->getInfo(classInfo.id, propertyInfo.id);
+                if (indexInfo.id != IndexId {} && isCollated(indexInfo.collation, condition)) {
+                    return std::make_pair(isPredicateImplied(indexInfo, propertyInfos, conjunctConditions), indexInfo);
+                }
+            }
+            if (propertyInfo.type == PropertyType::TEXT && !condition.isNegative && !condition.isIgnoreCase
+                && !getPatternGrams(condition).empty()) {
+                auto indexInfo = txn->_adapter->dbTextIndex()->getInfo(classInfo.id, propertyInfo.id);
+                return std::make_pair(indexInfo.id != IndexId {}, indexInfo);
+            }
+            return std::make_pair(false, IndexAccessInfo {});
+        }
+        // check if NOT is not used for EQUAL or IN
+        if ((isValidComparator(condition) || isInList(condition))
+            && !((condition.comp == Condition::Comparator::EQUAL || isInList(condition)) && condition.isNegative)) {
+            auto indexInfo = txn->_adapter->dbIndex()->getInfo(classInfo.id, propertyInfo.id);
+            return std::make_pair(indexInfo.id != IndexId {}
+                    && isIndexable(propertyInfo, condition, indexInfo.collation)
+                    && isPredicateImplied(indexInfo, propertyInfos, conjunctConditions),
+                indexInfo);
+        }
+        return std::make_pair(false, IndexAccessInfo {});
+    }
+
+    bool IndexUtils::isIndexable(const PropertyAccessInfo& propertyInfo,
+        const Condition& condition,
+        IndexCollation collation)
+    {
+        if (!isValidComparator(condition) && !isInList(condition)) {
+            return false;
+        }
+        // text keys are compared in the collation of their index and NaN bounds cannot be looked up in a REAL index
+        if (propertyInfo.type == PropertyType::TEXT && !isCollated(collation, condition)) {
+            return false;
+        }
+        if (propertyInfo.type == PropertyType::REAL) {
+            auto isNotANumber = [](const Bytes& value) {
+                return !value.empty() && std::isnan(value.toReal());
+            };
+            if (isNotANumber(condition.valueBytes)
+                || std::any_of(condition.valueSet.cbegin(), condition.valueSet.cend(), isNotANumber)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    PropertyNameMapIndex IndexUtils::getIndexInfos(const Transaction *txn,
+        const RecordDescriptor& recordDescriptor,
+        const Record& record,
+        const PropertyNameMapInfo& propertyNameMapInfo)
+    {
+        auto result = std::map<std::string, std::pair<PropertyAccessInfo, IndexAccessInfo>> {};
+        for (const auto& property : record.getAll()) {
+            if (property.second.empty())
+                continue;
+            auto foundProperty = propertyNameMapInfo.find(property.first);
+            if (foundProperty == propertyNameMapInfo.cend()) {
+                throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_NOEXST_PROPERTY);
+            } else {
+                auto indexInfo =
+                    txn->_adapter->dbIndex()->getInfo(recordDescriptor.rid.first, foundProperty->second.id);
+                if (indexInfo.id != IndexId {}
+                    && isInPredicate(getPredicateConditions(indexInfo, propertyNameMapInfo), record)) {
+                    result.emplace(property.first, std::make_pair(foundProperty->second, indexInfo));
+                }
+            }
+        }
+        return result;
+    }
+
+    std::pair<bool, PropertyIdMapIndex> IndexUtils::hasIndex(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const MultiCondition& conditions)
+    {
+        // records without a property are missing from the complements of its index, but a negated node
+        // which they satisfy includes them, so that such a node is left to an index plan or a scan
+        if (conditions.cmpFunctions.empty() && !hasNegatedCondition(conditions.root)) {
+            auto conjunctConditions = std::vector<const Condition*> {};
+            if (getConjunctConditions(conditions.root, conjunctConditions)) {
+                for (const auto& indexInfo : txn->_adapter->dbCompositeIndex()->getInfos(classInfo.id)) {
+                    auto conjunct = getCompositeConjunct(propertyInfos, indexInfo, conjunctConditions);
+                    if (conjunct.keyConditions.size() == conjunctConditions.size()) {
+                        auto result = PropertyIdMapIndex {};
+                        for (const auto& propertyInfo : conjunct.keyPropertyInfos) {
+                            result.emplace(propertyInfo.id, indexInfo);
+                        }
+                        return std::make_pair(true, result);
+                    }
+                }
+            } else {
+                // a partial index narrows a condition down to its predicate, which is only harmless
+                // if the predicate is one of the conjuncts of the whole multi-condition
+                conjunctConditions.clear();
+            }
+
+            auto isFoundAll = true;
+            auto result = PropertyIdMapIndex{};
+            auto conditionPropNames = std::unordered_set<std::string>{};
+            for (const auto &condition : conditions.conditions) {
+                if (auto conditionPtr = condition.lock()) {
+                    auto propertyName = conditionPtr->getCondition().propName;
+                    if (conditionPropNames.find(propertyName) == conditionPropNames.cend()) {
+                        auto propertyInfo = propertyInfos.find(propertyName);
+                        if (propertyInfo == propertyInfos.cend())
+                            continue;
+                        conditionPropNames.emplace(propertyName);
+                        auto searchIndexResult = hasIndex(txn, classInfo, propertyInfo->second,
+                            conditionPtr->getCondition(), propertyInfos, conjunctConditions);
+                        // a text index cannot give the complement of a pattern below a negated node,
+                        // so its lookups are only intersected as conjuncts of an index plan
+                        if (searchIndexResult.first && !isTextPattern(conditionPtr->getCondition())) {
+                            // keyed by the id of the property as it is resolved, which may belong to a superclass
+                            result.emplace(propertyInfo->second.id, searchIndexResult.second);
+                        } else {
+                            isFoundAll = false;
+                            break;
+                        }
+                    }
+                } else {
+                    isFoundAll = false;
+                    break;
+                }
+            }
+            return std::make_pair(isFoundAll, (isFoundAll) ? result : PropertyIdMapIndex{});
+        } else {
+            return std::make_pair(false, PropertyIdMapIndex{});
+        }
+    }
+
+    std::vector<RecordDescriptor> IndexUtils::getRecord(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const Condition& condition,
+        bool isNegative)
+    {
+        if (isTextPattern(condition)) {
+            require(!(condition.isNegative ^ isNegative));
+            if (isPrefixLookup(condition) && !isTextIndex(txn, indexInfo)) {
+                auto result = getPrefix(txn, propertyInfo, indexInfo, condition);
+                sortByRdesc(result);
+                return result;
+            }
+            return getTextIndexRecord(txn, propertyInfo, indexInfo, condition);
+        }
+        if (isInList(condition)) {
+            auto result = getIn(txn, propertyInfo, indexInfo, condition.valueSet, condition.isNegative ^ isNegative);
+            sortByRdesc(result);
+            return result;
+        }
+        auto lowerBound = (const Bytes*) nullptr;
+        auto upperBound = (const Bytes*) nullptr;
+        auto isIncludeBound = std::make_pair(true, true);
+        if (!isValidComparator(condition)) {
+            return std::vector<RecordDescriptor> {};
+        }
+        getBounds(condition, lowerBound, upperBound, isIncludeBound);
+
+        auto result = std::vector<RecordDescriptor> {};
+        if (!(condition.isNegative ^ isNegative)) {
+            result = (condition.comp == Condition::Comparator::EQUAL)
+                ? getEqual(txn, propertyInfo, indexInfo, condition.valueBytes)
+                : getRange(txn, propertyInfo, indexInfo, lowerBound, upperBound, isIncludeBound);
+        } else {
+            // the complement of a range is what lies below its lower bound and above its upper bound
+            if (lowerBound != nullptr) {
+                result = getRange(txn, propertyInfo, indexInfo, nullptr, lowerBound, { true, !isIncludeBound.first });
+            }
+            if (upperBound != nullptr) {
+                auto greaterResult =
+                    getRange(txn, propertyInfo, indexInfo, upperBound, nullptr, { !isIncludeBound.second, true });
+                result.insert(result.end(), greaterResult.cbegin(), greaterResult.cend());
+            }
+            // NaN fails every comparison, so it satisfies every negated one
+            if (propertyInfo.type == PropertyType::REAL) {
+                auto notANumberResult = getNotANumber(txn, indexInfo);
+                result.insert(result.end(), notANumberResult.cbegin(), notANumberResult.cend());
+            }
+        }
+        sortByRdesc(result);
+        return result;
+    }
+
+    size_t IndexUtils::getCountRecord(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const Condition& condition,
+        bool isNegative)
+    {
+        if (isTextPattern(condition)) {
+            require(!(condition.isNegative ^ isNegative));
+            if (isPrefixLookup(condition) && !isTextIndex(txn, indexInfo)) {
+                return getCountPrefix(txn, propertyInfo, indexInfo, condition);
+            }
+            return getTextIndexRecord(txn, propertyInfo, indexInfo, condition).size();
+        }
+        auto lowerBound = (const Bytes*) nullptr;
+        auto upperBound = (const Bytes*) nullptr;
+        auto isIncludeBound = std::make_pair(true, true);
+        if (!isValidComparator(condition) && !isInList(condition)) {
+            return size_t { 0 };
+        }
+        getBounds(condition, lowerBound, upperBound, isIncludeBound);
+
+        auto count = (isInList(condition))
+            ? getCountIn(txn, propertyInfo, indexInfo, condition.valueSet)
+            : (condition.comp == Condition::Comparator::EQUAL)
+            ? getCountEqual(txn, propertyInfo, indexInfo, condition.valueBytes)
+            : getCountRange(txn, propertyInfo, indexInfo, lowerBound, upperBound, isIncludeBound);
+        // every indexed value outside of the range, NaN included, satisfies the negated condition
+        return (!(condition.isNegative ^ isNegative)) ? count : getCountIndexEntry(txn, propertyInfo, indexInfo) - count;
+    }
+
+    std::vector<RecordDescriptor> IndexUtils::getRecord(const Transaction *txn,
+        const PropertyNameMapInfo& propertyInfos,
+        const PropertyIdMapIndex& propertyIndexInfo,
+        const MultiCondition& conditions)
+    {
+        if (!propertyIndexInfo.empty() && propertyIndexInfo.cbegin()->second.isComposite()) {
+            auto conjunctConditions = std::vector<const Condition*> {};
+            getConjunctConditions(conditions.root, conjunctConditions);
+            return getCompositeRecord(txn,
+                getCompositeConjunct(propertyInfos, propertyIndexInfo.cbegin()->second, conjunctConditions));
+        }
+        return getRecordDescriptors(propertyIndexInfo.cbegin()->second.classId,
+            getRecordFromMultiCondition(txn, propertyInfos, propertyIndexInfo, conditions.root.get(), false));
+    }
+
+    size_t IndexUtils::getCountRecord(const Transaction *txn,
+        const PropertyNameMapInfo& propertyInfos,
         const PropertyIdMapIndex& propertyIndexInfo,
         const MultiCondition& conditions)
     {
-      return getRecordFromMultiCondition(txn, propertyInfos, propertyIndexInfo, conditions.root.get(), false).size();
+        if (!propertyIndexInfo.empty() && propertyIndexInfo.cbegin()->second.isComposite()) {
+            auto conjunctConditions = std::vector<const Condition*> {};
+            getConjunctConditions(conditions.root, conjunctConditions);
+            return getCountCompositeRecord(txn,
+                getCompositeConjunct(propertyInfos, propertyIndexInfo.cbegin()->second, conjunctConditions));
+        }
+        return getRecordFromMultiCondition(txn, propertyInfos, propertyIndexInfo, conditions.root.get(), false).size();
+    }
+
+    IndexPlan IndexUtils::getIndexPlan(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const MultiCondition& conditions,
+        bool searchIndexOnly)
+    {
+        auto indexPlan = IndexPlan {};
+        auto conjuncts = std::vector<IndexConjunct> {};
+        getIndexConjuncts(txn, classInfo, propertyInfos, conditions.root, conjuncts);
+        if (conjuncts.empty()) {
+            return indexPlan;
+        }
+        std::stable_sort(conjuncts.begin(), conjuncts.end(),
+            [](const IndexConjunct& lhs, const IndexConjunct& rhs) {
+                return lhs.estimatedCount < rhs.estimatedCount;
+            });
+
+        auto classCount = DataRecord(txn->_txnBase, classInfo.id, classInfo.type).count();
+        auto candidates = static_cast<double>(std::min(conjuncts.front().estimatedCount, classCount));
+        auto indexCost = conjuncts.front().estimatedCount * INDEX_ENTRY_COST;
+        auto chosen = std::vector<IndexConjunct> { conjuncts.front() };
+        for (auto it = conjuncts.cbegin() + 1; it != conjuncts.cend() && classCount > 0; ++it) {
+            // reading another index pays off only if it is cheaper than fetching the candidates it prunes
+            auto entryCost = it->estimatedCount * INDEX_ENTRY_COST;
+            if (entryCost >= candidates * RECORD_FETCH_COST) {
+                break;
+            }
+            indexCost += entryCost;
+            candidates = candidates * it->estimatedCount / classCount;
+            chosen.emplace_back(*it);
+        }
+
+        auto planCost = indexCost + candidates * RECORD_FETCH_COST;
+        auto scanCost = classCount * RECORD_SCAN_COST;
+        if (planCost < scanCost || searchIndexOnly) {
+            indexPlan.conjuncts = std::move(chosen);
+            indexPlan.estimatedCount = static_cast<size_t>(candidates);
+        }
+        indexPlan.classCount = classCount;
+        return indexPlan;
+    }
+
+    bool IndexFilterCursor::fetch(std::vector<RecordDescriptor>& recordDescriptors, size_t limit)
+    {
+        auto batch = std::vector<RecordDescriptor> {};
+        auto hasMore = _indexCursor->fetch(batch, limit);
+        IndexUtils::filterByText(_txn, _propertyInfo, _indexInfo, batch, [&](const Bytes& value) {
+            return RecordCompare::compareBytesValue(value, PropertyType::TEXT, _condition);
+        });
+        recordDescriptors.insert(recordDescriptors.end(), batch.cbegin(), batch.cend());
+        return hasMore;
+    }
+
+    ResultSetCursor IndexUtils::getCursor(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const Condition& condition)
+    {
+        auto resultSetCursor = ResultSetCursor { *txn };
+        // the keys beginning with a literal prefix are walked in order unless the prefix is longer than a key
+        if (isTextPattern(condition) && !condition.isNegative && isPrefixLookup(condition) && !isTextIndex(txn, indexInfo)) {
+            auto prefix = getCollatedText(indexInfo, getLiteralPrefix(condition));
+            auto prefixEnd = getPrefixEnd(prefix);
+            if (isHashedTextKey(prefix)) {
+                resultSetCursor.metadata = getRecord(txn, propertyInfo, indexInfo, condition);
+                return resultSetCursor;
+            }
+            auto indexCursor = new IndexRangeCursor<std::string> {
+                txn->_txnBase, indexInfo, getIndexFlags(indexInfo, true),
+                &prefix, prefixEnd.empty() ? nullptr : &prefixEnd, std::make_pair(true, false) };
+            if (isExactPrefix(condition)) {
+                resultSetCursor.indexCursor.reset(indexCursor);
+            } else {
+                resultSetCursor.indexCursor.reset(new IndexFilterCursor { txn, propertyInfo, indexInfo, condition, indexCursor });
+            }
+            return resultSetCursor;
+        }
+        if (condition.isNegative || !isValidComparator(condition)) {
+            resultSetCursor.metadata = getRecord(txn, propertyInfo, indexInfo, condition);
+            return resultSetCursor;
+        }
+        auto lowerBound = (const Bytes*) nullptr;
+        auto upperBound = (const Bytes*) nullptr;
+        auto isIncludeBound = std::make_pair(true, true);
+        getBounds(condition, lowerBound, upperBound, isIncludeBound);
+
+        switch (propertyInfo.type) {
+        case PropertyType::UNSIGNED_TINYINT:
+        case PropertyType::UNSIGNED_SMALLINT:
+        case PropertyType::UNSIGNED_INTEGER:
+        case PropertyType::UNSIGNED_BIGINT:
+        case PropertyType::TINYINT:
+        case PropertyType::SMALLINT:
+        case PropertyType::INTEGER:
+        case PropertyType::BIGINT: {
+            auto lower = (lowerBound != nullptr) ? getNumericKey(propertyInfo.type, *lowerBound) : uint64_t {};
+            auto upper = (upperBound != nullptr) ? getNumericKey(propertyInfo.type, *upperBound) : uint64_t {};
+            resultSetCursor.indexCursor.reset(new IndexRangeCursor<uint64_t> {
+                txn->_txnBase, indexInfo, getIndexFlags(indexInfo, false),
+                (lowerBound != nullptr) ? &lower : nullptr,
+                (upperBound != nullptr) ? &upper : nullptr,
+                isIncludeBound });
+            break;
+        }
+        case PropertyType::REAL: {
+            if ((lowerBound != nullptr && std::isnan(lowerBound->toReal()))
+                || (upperBound != nullptr && std::isnan(upperBound->toReal()))) {
+                break;
+            }
+            auto lower = (lowerBound != nullptr) ?
+                encodeKey(lowerBound->toReal()) : encodeKey(-std::numeric_limits<double>::infinity());
+            auto upper = (upperBound != nullptr) ?
+                encodeKey(upperBound->toReal()) : encodeKey(std::numeric_limits<double>::infinity());
+            resultSetCursor.indexCursor.reset(new IndexRangeCursor<uint64_t> {
+                txn->_txnBase, indexInfo, getIndexFlags(indexInfo, false), &lower, &upper,
+                std::make_pair(lowerBound == nullptr || isIncludeBound.first,
+                    upperBound == nullptr || isIncludeBound.second) });
+            break;
+        }
+        case PropertyType::TEXT: {
+            auto lower = (lowerBound != nullptr) ? getCollatedText(indexInfo, lowerBound->toText()) : std::string {};
+            auto upper = (upperBound != nullptr) ? getCollatedText(indexInfo, upperBound->toText()) : std::string {};
+            // the entries around a long bound have to be checked against their records first
+            if (isHashedTextKey(lower) || isHashedTextKey(upper)) {
+                resultSetCursor.metadata = getRecord(txn, propertyInfo, indexInfo, condition);
+                break;
+            }
+            resultSetCursor.indexCursor.reset(new IndexRangeCursor<std::string> {
+                txn->_txnBase, indexInfo, getIndexFlags(indexInfo, true),
+                (lowerBound != nullptr && !lower.empty()) ? &lower : nullptr,
+                (upperBound != nullptr) ? &upper : nullptr,
+                isIncludeBound });
+            break;
+        }
+        default:
+            break;
+        }
+        return resultSetCursor;
+    }
+
+    std::vector<RecordDescriptor> IndexUtils::getRecord(const Transaction *txn, const IndexConjunct& conjunct)
+    {
+        if (conjunct.indexInfo.isComposite()) {
+            return getCompositeRecord(txn, conjunct);
+        }
+        return getRecord(txn, conjunct.propertyInfo, conjunct.indexInfo, *conjunct.condition);
+    }
+
+    std::vector<RecordDescriptor> IndexUtils::getRecord(const Transaction *txn,
+        const IndexPlan& indexPlan,
+        uint64_t* indexEntries)
+    {
+        if (indexPlan.conjuncts.empty()) {
+            return std::vector<RecordDescriptor> {};
+        }
+        auto result = PositionBitmap {};
+        for (auto it = indexPlan.conjuncts.cbegin(); it != indexPlan.conjuncts.cend(); ++it) {
+            auto records = getRecord(txn, *it);
+            if (indexEntries != nullptr) {
+                *indexEntries += records.size();
+            }
+            result = (it == indexPlan.conjuncts.cbegin()) ? getPositionBitmap(records) : result & getPositionBitmap(records);
+            if (result.empty()) {
+                break;
+            }
+        }
+        return getRecordDescriptors(indexPlan.conjuncts.front().indexInfo.classId, result);
+    }
+
+    size_t IndexUtils::getEstimateCount(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const Condition& condition)
+    {
+        if (isTextPattern(condition)) {
+            if (isPrefixLookup(condition) && !isTextIndex(txn, indexInfo)) {
+                return getEstimatePrefix(txn, indexInfo, condition);
+            }
+            return getTextIndexEstimate(txn, indexInfo, condition);
+        }
+        if (condition.comp == Condition::Comparator::EQUAL && !condition.isNegative) {
+            return getCountEqual(txn, propertyInfo, indexInfo, condition.valueBytes);
+        }
+        if (isInList(condition) && !condition.isNegative) {
+            return getCountIn(txn, propertyInfo, indexInfo, condition.valueSet);
+        }
+        auto entryCount = getCountIndexEntry(txn, propertyInfo, indexInfo);
+        auto selectivity = DEFAULT_RANGE_SELECTIVITY;
+        auto statistics = StatisticsUtils::getStatistics(txn, indexInfo.classId, propertyInfo.id);
+        if (!statistics.histogram.empty()) {
+            switch (condition.comp) {
+            case Condition::Comparator::GREATER:
+                selectivity = StatisticsUtils::estimateRange(statistics, &condition.valueBytes, nullptr, false, false);
+                break;
+            case Condition::Comparator::GREATER_EQUAL:
+                selectivity = StatisticsUtils::estimateRange(statistics, &condition.valueBytes, nullptr, true, false);
+                break;
+            case Condition::Comparator::LESS:
+                selectivity = StatisticsUtils::estimateRange(statistics, nullptr, &condition.valueBytes, false, false);
+                break;
+            case Condition::Comparator::LESS_EQUAL:
+                selectivity = StatisticsUtils::estimateRange(statistics, nullptr, &condition.valueBytes, false, true);
+                break;
+            case Condition::Comparator::BETWEEN:
+            case Condition::Comparator::BETWEEN_NO_UPPER:
+            case Condition::Comparator::BETWEEN_NO_LOWER:
+            case Condition::Comparator::BETWEEN_NO_BOUND: {
+                auto includeLower = condition.comp == Condition::Comparator::BETWEEN
+                    || condition.comp == Condition::Comparator::BETWEEN_NO_UPPER;
+                auto includeUpper = condition.comp == Condition::Comparator::BETWEEN
+                    || condition.comp == Condition::Comparator::BETWEEN_NO_LOWER;
+                selectivity = StatisticsUtils::estimateRange(
+                    statistics, &condition.valueSet[0], &condition.valueSet[1], includeLower, includeUpper);
+                break;
+            }
+            case Condition::Comparator::EQUAL:
+                selectivity = StatisticsUtils::estimateEqual(statistics, condition.valueBytes);
+                break;
+            default:
+                break;
+            }
+            if (condition.isNegative) {
+                selectivity = 1.0 - selectivity;
+            }
+        }
+        // index entries only cover non-null values, which is also what the statistics fractions refer to
+        return static_cast<size_t>(entryCount * selectivity) + 1;
+    }
+
+    void IndexUtils::getIndexConjuncts(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const std::shared_ptr<MultiCondition::ExprNode>& exprNode,
+        std::vector<IndexConjunct>& conjuncts)
+    {
+        // only conjuncts reached through non-negated AND nodes must hold for every result
+        auto conjunctConditions = std::vector<const Condition*> {};
+        getConjunctConditions(exprNode, conjunctConditions);
+        for (const auto& condition : conjunctConditions) {
+            auto foundProperty = propertyInfos.find(condition->propName);
+            if (foundProperty == propertyInfos.cend()) {
+                continue;
+            }
+            auto searchIndexResult =
+                hasIndex(txn, classInfo, foundProperty->second, *condition, propertyInfos, conjunctConditions);
+            if (searchIndexResult.first) {
+                auto conjunct = IndexConjunct {};
+                conjunct.condition = condition;
+                conjunct.propertyInfo = foundProperty->second;
+                conjunct.indexInfo = searchIndexResult.second;
+                conjunct.estimatedCount = getEstimateCount(txn, foundProperty->second, searchIndexResult.second, *condition);
+                conjuncts.emplace_back(conjunct);
+            }
+        }
+        for (const auto& indexInfo : txn->_adapter->dbCompositeIndex()->getInfos(classInfo.id)) {
+            auto conjunct = getCompositeConjunct(propertyInfos, indexInfo, conjunctConditions);
+            if (!conjunct.keyConditions.empty()) {
+                conjunct.estimatedCount = getCountCompositeRecord(txn, conjunct);
+                conjuncts.emplace_back(conjunct);
+            }
+        }
+    }
+
+    bool IndexUtils::getConjunctConditions(const std::shared_ptr<MultiCondition::ExprNode>& exprNode,
+        std::vector<const Condition*>& conditions)
+    {
+        if (!exprNode) {
+            return true;
+        }
+        if (exprNode->checkIfCondition()) {
+            conditions.emplace_back(&((MultiCondition::ConditionNode*)exprNode.get())->getCondition());
+            return true;
+        } else if (!exprNode->checkIfCmpFunction()) {
+            auto compositeNodePtr = (MultiCondition::CompositeNode*)exprNode.get();
+            if (compositeNodePtr->getOperator() == MultiCondition::Operator::AND && !compositeNodePtr->getIsNegative()) {
+                auto isLeftConjunction = getConjunctConditions(compositeNodePtr->getLeftNode(), conditions);
+                auto isRightConjunction = getConjunctConditions(compositeNodePtr->getRightNode(), conditions);
+                return isLeftConjunction && isRightConjunction;
+            }
+        }
+        return false;
+    }
+
+    bool IndexUtils::hasNegatedCondition(const std::shared_ptr<MultiCondition::ExprNode>& exprNode,
+        bool isParentNegative)
+    {
+        if (!exprNode || exprNode->checkIfCmpFunction()) {
+            return false;
+        }
+        if (exprNode->checkIfCondition()) {
+            return isParentNegative;
+        }
+        auto compositeNodePtr = (MultiCondition::CompositeNode*)exprNode.get();
+        auto isNegative = compositeNodePtr->getIsNegative() ^ isParentNegative;
+        return hasNegatedCondition(compositeNodePtr->getLeftNode(), isNegative)
+            || hasNegatedCondition(compositeNodePtr->getRightNode(), isNegative);
+    }
+
+    void IndexUtils::getBounds(const Condition& condition,
+        const Bytes*& lowerBound,
+        const Bytes*& upperBound,
+        std::pair<bool, bool>& isIncludeBound)
+    {
+        switch (condition.comp) {
+        case Condition::Comparator::EQUAL:
+            lowerBound = upperBound = &condition.valueBytes;
+            break;
+        case Condition::Comparator::LESS_EQUAL:
+            upperBound = &condition.valueBytes;
+            break;
+        case Condition::Comparator::LESS:
+            upperBound = &condition.valueBytes;
+            isIncludeBound.second = false;
+            break;
+        case Condition::Comparator::GREATER_EQUAL:
+            lowerBound = &condition.valueBytes;
+            break;
+        case Condition::Comparator::GREATER:
+            lowerBound = &condition.valueBytes;
+            isIncludeBound.first = false;
+            break;
+        case Condition::Comparator::BETWEEN_NO_BOUND:
+            isIncludeBound = std::make_pair(false, false);
+            break;
+        case Condition::Comparator::BETWEEN:
+            break;
+        case Condition::Comparator::BETWEEN_NO_UPPER:
+            isIncludeBound.second = false;
+            break;
+        case Condition::Comparator::BETWEEN_NO_LOWER:
+            isIncludeBound.first = false;
+            break;
+        default:
+            break;
+        }
+        if (condition.comp >= Condition::Comparator::BETWEEN && condition.comp <= Condition::Comparator::BETWEEN_NO_BOUND) {
+            lowerBound = &condition.valueSet[0];
+            upperBound = &condition.valueSet[1];
+        }
+    }
+
+    size_t IndexUtils::getCountEqual(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const Bytes& value)
+    {
+        if (propertyInfo.type == PropertyType::REAL && std::isnan(value.toReal())) {
+            return size_t {0};
+        }
+        switch (propertyInfo.type) {
+        case PropertyType::UNSIGNED_TINYINT:
+        case PropertyType::UNSIGNED_SMALLINT:
+        case PropertyType::UNSIGNED_INTEGER:
+        case PropertyType::UNSIGNED_BIGINT:
+        case PropertyType::TINYINT:
+        case PropertyType::SMALLINT:
+        case PropertyType::INTEGER:
+        case PropertyType::BIGINT:
+        case PropertyType::REAL:
+            return countExactMatchIndex(openIndexRecordNumeric(txn, indexInfo).getCursor(),
+                getNumericKey(propertyInfo.type, value), indexInfo.isUnique);
+        case PropertyType::TEXT: {
+            auto valueString = getCollatedText(indexInfo, value.toText());
+            if (valueString.empty()) {
+                return size_t {0};
+            }
+            if (isHashedTextKey(getTextKey(valueString))) {
+                return getEqual(txn, propertyInfo, indexInfo, value).size();
+            }
+            return countExactMatchIndex(
+                openIndexRecordString(txn, indexInfo).getCursor(), valueString, indexInfo.isUnique);
+        }
+        default:
+            break;
+        }
+        return size_t {0};
+    }
+
+    size_t IndexUtils::getCountIndexEntry(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo)
+    {
+        switch (propertyInfo.type) {
+        case PropertyType::TEXT:
+            return openIndexRecordString(txn, indexInfo).count();
+        default:
+            return openIndexRecordNumeric(txn, indexInfo).count();
+        }
+    }
+
+    bool IndexUtils::isUpgradeNeeded(const Transaction *txn)
+    {
+        return txn->_adapter->dbInfo()->getIndexKeyVersion() < INDEX_KEY_VERSION;
+    }
+
+    void IndexUtils::upgrade(const Transaction *txn)
+    {
+        auto dbInfo = txn->_adapter->dbInfo();
+        auto version = dbInfo->getIndexKeyVersion();
+        if (version >= INDEX_KEY_VERSION) {
+            return;
+        }
+        for (const auto& classInfo : txn->_adapter->dbClass()->getAllInfos()) {
+            auto propertyInfos = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
+            for (const auto& indexInfo : txn->_adapter->dbIndex()->getInfos(classInfo.id)) {
+                auto foundProperty = propertyInfos.find(indexInfo.propertyId);
+                require(foundProperty != propertyInfos.cend());
+                auto& propertyInfo = foundProperty->second;
+                switch (propertyInfo.type) {
+                case PropertyType::TINYINT:
+                case PropertyType::SMALLINT:
+                case PropertyType::INTEGER:
+                case PropertyType::BIGINT:
+                case PropertyType::REAL: {
+                    // version 0 kept the negative values of these types apart under their raw keys
+                    if (version >= 1) {
+                        break;
+                    }
+                    auto uniqueFlag = (indexInfo.isUnique) ? INDEX_TYPE_UNIQUE : INDEX_TYPE_NON_UNIQUE;
+                    auto indexFlags = INDEX_TYPE_NEGATIVE | INDEX_TYPE_NUMERIC | uniqueFlag;
+                    IndexRecord { txn->_txnBase, indexInfo.id, (unsigned int)indexFlags }.destroy();
+                    openIndexRecordNumeric(txn, indexInfo).clear();
+                    createNumeric(txn, propertyInfo, indexInfo, classInfo.superClassId, classInfo.type);
+                    break;
+                }
+                case PropertyType::TEXT: {
+                    // before version 2 every text was indexed under its raw value
+                    if (version >= 2) {
+                        break;
+                    }
+                    openIndexRecordString(txn, indexInfo).clear();
+                    createString(txn, propertyInfo, indexInfo, classInfo.superClassId, classInfo.type);
+                    break;
+                }
+                default:
+                    break;
+                }
+            }
+            // before version 3 the texts in composite and polymorphic keys were kept whole
+            if (version >= 3) {
+                continue;
+            }
+            auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(txn, classInfo.id, classInfo.superClassId);
+            for (const auto& compositeIndexInfo : getCompositeIndexInfos(txn, classInfo.id, propertyNameMapInfo)) {
+                openIndexRecordString(txn, compositeIndexInfo.first).clear();
+                initialize(txn, compositeIndexInfo.second, compositeIndexInfo.first, classInfo.superClassId, classInfo.type);
+            }
+            for (const auto& indexInfo : txn->_adapter->dbPolymorphicIndex()->getInfos(classInfo.id)) {
+                auto foundProperty = propertyInfos.find(indexInfo.propertyId);
+                require(foundProperty != propertyInfos.cend());
+                openIndexRecordString(txn, indexInfo).clear();
+                initializePolymorphic(txn, foundProperty->second, indexInfo);
+            }
+        }
+        dbInfo->setIndexKeyVersion(INDEX_KEY_VERSION);
+    }
+
+    uint64_t IndexUtils::getNumericKey(const PropertyType& type, const Bytes& value)
+    {
+        switch (type) {
+        case PropertyType::UNSIGNED_TINYINT:
+            return static_cast<uint64_t>(value.toTinyIntU());
+        case PropertyType::UNSIGNED_SMALLINT:
+            return static_cast<uint64_t>(value.toSmallIntU());
+        case PropertyType::UNSIGNED_INTEGER:
+            return static_cast<uint64_t>(value.toIntU());
+        case PropertyType::UNSIGNED_BIGINT:
+            return value.toBigIntU();
+        case PropertyType::TINYINT:
+            return encodeKey(static_cast<int64_t>(value.toTinyInt()));
+        case PropertyType::SMALLINT:
+            return encodeKey(static_cast<int64_t>(value.toSmallInt()));
+        case PropertyType::INTEGER:
+            return encodeKey(static_cast<int64_t>(value.toInt()));
+        case PropertyType::BIGINT:
+            return encodeKey(value.toBigInt());
+        case PropertyType::REAL:
+            return encodeKey(value.toReal());
+        default:
+            require(false);
+            return uint64_t {0};
+        }
+    }
+
+    IndexRecord IndexUtils::openIndexRecordNumeric(const Transaction *txn, const IndexAccessInfo& indexInfo)
+    {
+        auto indexAccess = IndexRecord { txn->_txnBase, indexInfo.id, getIndexFlags(indexInfo, false) };
+        return indexAccess;
+    }
+
+    IndexRecord IndexUtils::openIndexRecordString(const Transaction *txn, const IndexAccessInfo& indexInfo)
+    {
+        auto indexAccess = IndexRecord { txn->_txnBase, indexInfo.id, getIndexFlags(indexInfo, true) };
+        return indexAccess;
+    }
+
+    unsigned int IndexUtils::getIndexFlags(const IndexAccessInfo& indexInfo, bool isString)
+    {
+        auto uniqueFlag = (indexInfo.isUnique) ? INDEX_TYPE_UNIQUE : INDEX_TYPE_NON_UNIQUE;
+        auto typeFlag = (isString) ? INDEX_TYPE_STRING : INDEX_TYPE_NUMERIC;
+        return (unsigned int)(INDEX_TYPE_POSITIVE | typeFlag | uniqueFlag);
+    }
+
+    void IndexUtils::createNumeric(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const ClassId& superClassId,
+        const ClassType& classType)
+    {
+        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, indexInfo.classId, superClassId);
+        require(!propertyIdMapInfo.empty());
+        auto predicateConditions = getPredicateConditions(indexInfo,
+            SchemaUtils::getPropertyNameMapInfo(txn, indexInfo.classId, superClassId));
+        auto indexAccess = openIndexRecordNumeric(txn, indexInfo);
+        auto dataRecord = DataRecord(txn->_txnBase, indexInfo.classId, classType);
+        IndexEntrySorter<uint64_t> sorter { INDEX_BUILD_MEMORY_LIMIT };
+        std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
+            [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
+                auto const record = RecordParser::parseRawData(
+                    result, propertyIdMapInfo, classType == ClassType::EDGE, txn->_txnCtx->isVersionEnabled());
+                auto bytesValue = record.get(propertyInfo.name);
+                if (!bytesValue.empty() && isInPredicate(predicateConditions, record)) {
+                    sorter.add(getNumericKey(propertyInfo.type, bytesValue), positionId);
+                }
+            };
+        dataRecord.resultSetIter(callback);
+        appendIndexRecords(indexAccess, sorter);
+    }
+
+    void IndexUtils::createString(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const ClassId& superClassId,
+        const ClassType& classType)
+    {
+        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, indexInfo.classId, superClassId);
+        require(!propertyIdMapInfo.empty());
+        auto predicateConditions = getPredicateConditions(indexInfo,
+            SchemaUtils::getPropertyNameMapInfo(txn, indexInfo.classId, superClassId));
+        auto indexAccess = openIndexRecordString(txn, indexInfo);
+        auto dataRecord = DataRecord(txn->_txnBase, indexInfo.classId, classType);
+        IndexEntrySorter<std::string> sorter { INDEX_BUILD_MEMORY_LIMIT };
+        std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
+            [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
+                auto const record = RecordParser::parseRawData(
+                    result, propertyIdMapInfo, classType == ClassType::EDGE, txn->_txnCtx->isVersionEnabled());
+                auto value = record.get(propertyInfo.name).toText();
+                if (!value.empty() && isInPredicate(predicateConditions, record)) {
+                    sorter.add(getTextKey(getCollatedText(indexInfo, value)), positionId);
+                }
+            };
+        dataRecord.resultSetIter(callback);
+        appendIndexRecords(indexAccess, sorter);
+    }
+
+    std::string IndexUtils::getTextKey(const std::string& value)
+    {
+        if (value.size() <= INDEX_TEXT_KEY_PREFIX_LENGTH) {
+            return value;
+        }
+        auto hash = INDEX_TEXT_HASH_OFFSET_BASIS;
+        for (auto c : value) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * INDEX_TEXT_HASH_PRIME;
+        }
+        auto key = value.substr(0, INDEX_TEXT_KEY_PREFIX_LENGTH);
+        for (auto shift = 56; shift >= 0; shift -= 8) {
+            key.push_back(static_cast<char>((hash >> shift) & 0xff));
+        }
+        return key;
+    }
+
+    std::string IndexUtils::getCollatedText(const IndexAccessInfo& indexInfo, const std::string& value)
+    {
+        switch (indexInfo.collation) {
+        case IndexCollation::ASCII_CASE_FOLD:
+            return utils::string::foldCase(value);
+        case IndexCollation::UNICODE_CASE_FOLD:
+            return utils::string::foldCaseUnicode(value);
+        default:
+            return value;
+        }
+    }
+
+    bool IndexUtils::isCollated(IndexCollation collation, const Condition& condition)
+    {
+        switch (collation) {
+        case IndexCollation::ASCII_CASE_FOLD:
+            return condition.isIgnoreCase;
+        case IndexCollation::UNICODE_CASE_FOLD: {
+            auto isAscii = [](const Bytes& value) { return utils::string::isAscii(value.toText()); };
+            return condition.isIgnoreCase && isAscii(condition.valueBytes)
+                && std::all_of(condition.valueSet.cbegin(), condition.valueSet.cend(), isAscii);
+        }
+        default:
+            return !condition.isIgnoreCase;
+        }
+    }
+
+    std::string IndexUtils::getLiteralPrefix(const Condition& condition)
+    {
+        switch (condition.comp) {
+        case Condition::Comparator::BEGIN_WITH:
+            return condition.valueBytes.toText();
+        case Condition::Comparator::LIKE:
+            return utils::string::likePrefix(condition.valueBytes.toText());
+        default:
+            return std::string {};
+        }
+    }
+
+    bool IndexUtils::isExactPrefix(const Condition& condition)
+    {
+        if (condition.comp != Condition::Comparator::LIKE) {
+            return true;
+        }
+        auto pattern = condition.valueBytes.toText();
+        auto prefixLength = utils::string::likePrefix(pattern).size();
+        return prefixLength < pattern.size() && pattern.find_first_not_of('%', prefixLength) == std::string::npos;
+    }
+
+    std::string IndexUtils::getPrefixEnd(std::string prefix)
+    {
+        while (!prefix.empty() && static_cast<unsigned char>(prefix.back()) == 0xff) {
+            prefix.pop_back();
+        }
+        if (!prefix.empty()) {
+            prefix.back() = static_cast<char>(static_cast<unsigned char>(prefix.back()) + 1);
+        }
+        return prefix;
+    }
+
+    bool IndexUtils::isTextIndex(const Transaction *txn, const IndexAccessInfo& indexInfo)
+    {
+        return txn->_adapter->dbTextIndex()->getInfo(indexInfo.classId, indexInfo.propertyId).id == indexInfo.id;
+    }
+
+    std::vector<RecordDescriptor> IndexUtils::getPrefix(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const Condition& condition)
+    {
+        auto prefix = getCollatedText(indexInfo, getLiteralPrefix(condition));
+        auto prefixEnd = getPrefixEnd(prefix);
+        auto result = getTextRange(txn, propertyInfo, indexInfo,
+            &prefix, prefixEnd.empty() ? nullptr : &prefixEnd, std::make_pair(true, false));
+        if (!isExactPrefix(condition)) {
+            filterByText(txn, propertyInfo, indexInfo, result, [&](const Bytes& value) {
+                return RecordCompare::compareBytesValue(value, PropertyType::TEXT, condition);
+            });
+        }
+        return result;
+    }
+
+    size_t IndexUtils::getCountPrefix(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const Condition& condition)
+    {
+        auto prefix = getCollatedText(indexInfo, getLiteralPrefix(condition));
+        if (isHashedTextKey(prefix) || !isExactPrefix(condition)) {
+            return getPrefix(txn, propertyInfo, indexInfo, condition).size();
+        }
+        auto prefixEnd = getPrefixEnd(prefix);
+        return rangeCountIndex(openIndexRecordString(txn, indexInfo).getCursor(),
+            &prefix, prefixEnd.empty() ? nullptr : &prefixEnd, std::make_pair(true, false), indexInfo.isUnique);
+    }
+
+    size_t IndexUtils::getEstimatePrefix(const Transaction *txn,
+        const IndexAccessInfo& indexInfo,
+        const Condition& condition)
+    {
+        // the keys sharing the part of the prefix which fits in a key bound the matches from above
+        auto prefix = getCollatedText(indexInfo, getLiteralPrefix(condition)).substr(0, INDEX_TEXT_KEY_PREFIX_LENGTH);
+        auto prefixEnd = getPrefixEnd(prefix);
+        return rangeCountIndex(openIndexRecordString(txn, indexInfo).getCursor(),
+            &prefix, prefixEnd.empty() ? nullptr : &prefixEnd, std::make_pair(true, false), indexInfo.isUnique);
+    }
+
+    void IndexUtils::filterByText(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        std::vector<RecordDescriptor>& recordDescriptors,
+        const std::function<bool(const Bytes&)>& predicate)
+    {
+        auto classInfo = txn->_adapter->dbClass()->getInfo(indexInfo.classId);
+        auto dataRecord = DataRecord(txn->_txnBase, indexInfo.classId, classInfo.type);
+        auto isVersionEnabled = txn->_txnCtx->isVersionEnabled();
+        recordDescriptors.erase(
+            std::remove_if(recordDescriptors.begin(), recordDescriptors.end(),
+                [&](const RecordDescriptor& recordDescriptor) {
+                    auto result = dataRecord.getResult(recordDescriptor.rid.second);
+                    auto value = RecordParser::parseRawDataPropertyValue(
+                        result, propertyInfo.id, classInfo.type, isVersionEnabled);
+                    if (indexInfo.collation != IndexCollation::BINARY) {
+                        return !predicate(Bytes { getCollatedText(indexInfo, Bytes { value.first, value.second }.toText()) });
+                    }
+                    return !predicate(Bytes { value.first, value.second });
+                }),
+            recordDescriptors.end());
+    }
+
+    std::vector<RecordDescriptor> IndexUtils::getTextRange(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const std::string* lower,
+        const std::string* upper,
+        const std::pair<bool, bool>& isIncludeBound)
+    {
+        auto isLongLower = lower != nullptr && isHashedTextKey(*lower);
+        auto isLongUpper = upper != nullptr && isHashedTextKey(*upper);
+        if (!isLongLower && !isLongUpper) {
+            return rangeSearchIndex(openIndexRecordString(txn, indexInfo).getCursor(), indexInfo.classId,
+                lower, upper, isIncludeBound);
+        }
+        auto isInRange = [&](const Bytes& bytes) {
+            auto value = bytes.toText();
+            return (lower == nullptr || value > *lower || (isIncludeBound.first && value == *lower))
+                && (upper == nullptr || value < *upper || (isIncludeBound.second && value == *upper));
+        };
+        // all keys sharing a prefix lie between the prefix and the prefix followed by the largest hash
+        auto getPrefixRange = [&](const std::string& prefix) {
+            auto last = prefix + std::string(sizeof(uint64_t), '\xff');
+            auto records = rangeSearchIndex(openIndexRecordString(txn, indexInfo).getCursor(), indexInfo.classId,
+                &prefix, &last, std::make_pair(true, true));
+            filterByText(txn, propertyInfo, indexInfo, records, isInRange);
+            return records;
+        };
+        auto result = std::vector<RecordDescriptor> {};
+        auto middleLower = (lower != nullptr) ? *lower : std::string {};
+        auto middleUpper = (upper != nullptr) ? *upper : std::string {};
+        auto isIncludeMiddle = isIncludeBound;
+        if (isLongLower) {
+            auto prefix = lower->substr(0, INDEX_TEXT_KEY_PREFIX_LENGTH);
+            result = getPrefixRange(prefix);
+            middleLower = prefix + std::string(sizeof(uint64_t), '\xff');
+            isIncludeMiddle.first = false;
+        }
+        auto upperPrefix = std::string {};
+        if (isLongUpper) {
+            upperPrefix = upper->substr(0, INDEX_TEXT_KEY_PREFIX_LENGTH);
+            middleUpper = upperPrefix;
+            isIncludeMiddle.second = false;
+        }
+        auto middle = rangeSearchIndex(openIndexRecordString(txn, indexInfo).getCursor(), indexInfo.classId,
+            (lower != nullptr) ? &middleLower : nullptr,
+            (upper != nullptr) ? &middleUpper : nullptr,
+            isIncludeMiddle);
+        result.insert(result.end(), middle.cbegin(), middle.cend());
+        if (isLongUpper && !(isLongLower && lower->compare(0, INDEX_TEXT_KEY_PREFIX_LENGTH, upperPrefix) == 0)) {
+            auto records = getPrefixRange(upperPrefix);
+            result.insert(result.end(), records.cbegin(), records.cend());
+        }
+        return result;
+    }
+
+    std::vector<std::string> IndexUtils::getTextGrams(const std::string& value)
+    {
+        auto grams = std::vector<std::string> {};
+        for (auto i = size_t { 0 }; i + TEXT_INDEX_GRAM_LENGTH <= value.size(); ++i) {
+            grams.emplace_back(value.substr(i, TEXT_INDEX_GRAM_LENGTH));
+        }
+        std::sort(grams.begin(), grams.end());
+        grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+        return grams;
+    }
+
+    std::vector<std::string> IndexUtils::getPatternGrams(const Condition& condition)
+    {
+        auto pattern = condition.valueBytes.toText();
+        // the wildcards of a like pattern split it into literal parts which every match contains
+        auto literals = std::vector<std::string> {};
+        if (condition.comp == Condition::Comparator::LIKE) {
+            auto begin = size_t { 0 };
+            for (auto end = pattern.find_first_of("%_"); end != std::string::npos; end = pattern.find_first_of("%_", begin)) {
+                literals.emplace_back(pattern.substr(begin, end - begin));
+                begin = end + 1;
+            }
+            literals.emplace_back(pattern.substr(begin));
+        } else {
+            literals.emplace_back(pattern);
+        }
+        auto grams = std::vector<std::string> {};
+        for (const auto& literal : literals) {
+            auto literalGrams = getTextGrams(literal);
+            grams.insert(grams.end(), literalGrams.cbegin(), literalGrams.cend());
+        }
+        std::sort(grams.begin(), grams.end());
+        grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+        return grams;
+    }
+
+    std::vector<RecordDescriptor> IndexUtils::getTextIndexRecord(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const Condition& condition)
+    {
+        auto result = std::vector<RecordDescriptor> {};
+        auto postingLists = std::vector<std::pair<size_t, std::string>> {};
+        for (const auto& gram : getPatternGrams(condition)) {
+            auto cursorHandler = openIndexRecordString(txn, indexInfo).getCursor();
+            if (cursorHandler.find(gram).empty()) {
+                return result;
+            }
+            postingLists.emplace_back(cursorHandler.count(), gram);
+        }
+        if (postingLists.empty()) {
+            return result;
+        }
+        std::sort(postingLists.begin(), postingLists.end());
+        auto cursorHandlers = std::vector<storage_engine::lmdb::Cursor> {};
+        for (auto i = size_t { 0 }; i < postingLists.size(); ++i) {
+            cursorHandlers.emplace_back(openIndexRecordString(txn, indexInfo).getCursor());
+        }
+        // every list is sought to the candidate of the shortest one and a list which is past it
+        // moves the shortest one to its own position
+        auto keyValue = cursorHandlers[0].find(postingLists[0].second);
+        while (!keyValue.empty()) {
+            auto posting = keyValue.val.data.numeric<PositionId>();
+            auto nextPosting = posting;
+            for (auto i = size_t { 1 }; i < postingLists.size() && nextPosting == posting; ++i) {
+                auto found = cursorHandlers[i].findRange(postingLists[i].second, posting);
+                if (found.empty()) {
+                    keyValue = storage_engine::lmdb::CursorResult {};
+                    break;
+                }
+                nextPosting = found.val.data.numeric<PositionId>();
+            }
+            if (keyValue.empty()) {
+                break;
+            } else if (nextPosting == posting) {
+                result.emplace_back(RecordDescriptor { indexInfo.classId, decodePosting(posting) });
+                keyValue = cursorHandlers[0].getNextDup();
+            } else {
+                keyValue = cursorHandlers[0].findRange(postingLists[0].second, nextPosting);
+            }
+        }
+        // the n-grams of a pattern do not fix their order or the position of the pattern
+        filterByText(txn, propertyInfo, indexInfo, result, [&](const Bytes& value) {
+            return !value.empty() && RecordCompare::compareBytesValue(value, PropertyType::TEXT, condition);
+        });
+        return result;
+    }
+
+    size_t IndexUtils::getTextIndexEstimate(const Transaction *txn,
+        const IndexAccessInfo& indexInfo,
+        const Condition& condition)
+    {
+        auto estimate = std::numeric_limits<size_t>::max();
+        auto cursorHandler = openIndexRecordString(txn, indexInfo).getCursor();
+        for (const auto& gram : getPatternGrams(condition)) {
+            estimate = std::min(estimate, cursorHandler.find(gram).empty() ? size_t { 0 } : cursorHandler.count());
+        }
+        return (estimate == std::numeric_limits<size_t>::max()) ? size_t { 0 } : estimate;
+    }
+
+    void IndexUtils::insert(const Transaction *txn,
+        const IndexAccessInfo& indexInfo,
+        PositionId positionId,
+        const std::string& value)
+    {
+        auto indexAccess = openIndexRecordString(txn, indexInfo);
+        auto indexRecord = Blob(sizeof(PositionId)).append(&positionId, sizeof(PositionId));
+        indexAccess.create(value, indexRecord);
+    }
+
+    void IndexUtils::removeByCursor(const Transaction *txn,
+        const IndexAccessInfo& indexInfo,
+        PositionId positionId,
+        const std::string& value)
+    {
+        auto indexAccessCursor = openIndexRecordString(txn, indexInfo).getCursor();
+        for (auto keyValue = indexAccessCursor.find(value);
+             !keyValue.empty();
+             keyValue = indexAccessCursor.getNext()) {
+            auto key = keyValue.key.data.string();
+            if (value == key) {
+                auto valueAsPositionId = keyValue.val.data.numeric<PositionId>();
+                if (positionId == valueAsPositionId) {
+                    indexAccessCursor.del();
+                    break;
+                }
+            } else {
+                break;
+            }
+        }
+    }
+
+    IndexConjunct IndexUtils::getCoveringConjunct(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const std::vector<const Condition*>& conditions,
+        const std::vector<std::string>& propertyNames)
+    {
+        auto isCovered = [&](const IndexAccessInfo& indexInfo, const std::string& propertyName) {
+            auto foundProperty = propertyInfos.find(propertyName);
+            if (foundProperty == propertyInfos.cend()) {
+                return false;
+            }
+            const auto& propertyInfo = foundProperty->second;
+            const auto& includedPropertyIds = indexInfo.includedPropertyIds;
+            if (std::find(includedPropertyIds.cbegin(), includedPropertyIds.cend(), propertyInfo.id)
+                != includedPropertyIds.cend()) {
+                return true;
+            }
+            return propertyInfo.type != PropertyType::REAL
+                && std::find(indexInfo.propertyIds.cbegin(), indexInfo.propertyIds.cend(), propertyInfo.id)
+                != indexInfo.propertyIds.cend();
+        };
+        for (const auto& indexInfo : txn->_adapter->dbCompositeIndex()->getInfos(classInfo.id)) {
+            if (!std::all_of(propertyNames.cbegin(), propertyNames.cend(), [&](const std::string& propertyName) {
+                    return isCovered(indexInfo, propertyName);
+                })) {
+                continue;
+            }
+            auto conjunct = getCompositeConjunct(propertyInfos, indexInfo, conditions);
+            if (!conjunct.keyConditions.empty() && conjunct.keyConditions.size() == conditions.size()) {
+                return conjunct;
+            }
+        }
+        return IndexConjunct {};
+    }
+
+    IndexConjunct IndexUtils::getCoveringConjunct(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const MultiCondition& conditions,
+        const std::vector<std::string>& propertyNames)
+    {
+        auto conjunctConditions = std::vector<const Condition*> {};
+        if (conditions.cmpFunctions.empty() && getConjunctConditions(conditions.root, conjunctConditions)) {
+            return getCoveringConjunct(txn, classInfo, propertyInfos, conjunctConditions, propertyNames);
+        }
+        return IndexConjunct {};
+    }
+
+    ResultSet IndexUtils::getCoveringResultSet(const Transaction *txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const IndexConjunct& conjunct,
+        const std::vector<std::string>& propertyNames)
+    {
+        auto resultSet = ResultSet {};
+        if (conjunct.keyConditions.empty()) {
+            return resultSet;
+        }
+        const auto& indexInfo = conjunct.indexInfo;
+        // the key and included columns in the order of their values in an index entry
+        auto columnNames = std::vector<std::string> {};
+        auto keyTypes = std::vector<PropertyType> {};
+        auto columnIds = indexInfo.propertyIds;
+        columnIds.insert(columnIds.cend(), indexInfo.includedPropertyIds.cbegin(), indexInfo.includedPropertyIds.cend());
+        for (const auto& propertyId : columnIds) {
+            auto foundProperty = std::find_if(propertyInfos.cbegin(), propertyInfos.cend(),
+                [&propertyId](const PropertyNameMapInfo::value_type& property) {
+                    return property.second.id == propertyId;
+                });
+            require(foundProperty != propertyInfos.cend());
+            columnNames.emplace_back(foundProperty->first);
+            if (keyTypes.size() < indexInfo.propertyIds.size()) {
+                keyTypes.emplace_back(foundProperty->second.type);
+            }
+        }
+
+        auto lowerKey = std::string {};
+        auto upperKey = std::string {};
+        auto isIncludeBound = std::make_pair(true, true);
+        auto isExact = getCompositeKeyRange(conjunct, lowerKey, upperKey, isIncludeBound);
+        auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
+        auto isVersionEnabled = txn->_txnCtx->isVersionEnabled();
+        auto cursorHandler = openIndexRecordString(txn, indexInfo).getCursor();
+        for (auto keyValue = cursorHandler.findRange(lowerKey);
+             !keyValue.empty();
+             keyValue = cursorHandler.getNext()) {
+            auto key = keyValue.key.data.string();
+            if (!isIncludeBound.first && key.compare(0, lowerKey.size(), lowerKey) == 0)
+                continue;
+            auto upperCompare = key.compare(0, upperKey.size(), upperKey);
+            if (upperCompare > 0 || (upperCompare == 0 && !isIncludeBound.second))
+                break;
+            auto values = std::vector<Bytes> {};
+            auto offset = size_t { 0 };
+            for (const auto& type : keyTypes) {
+                values.emplace_back(retrieveKeyComponent(key, offset, type));
+            }
+            auto value = keyValue.val.data.string();
+            auto positionId = PositionId {};
+            std::memcpy(&positionId, value.data(), sizeof(PositionId));
+            offset = sizeof(PositionId);
+            while (offset < value.size()) {
+                auto size = uint32_t {};
+                std::memcpy(&size, value.data() + offset, sizeof(uint32_t));
+                offset += sizeof(uint32_t);
+                values.emplace_back(reinterpret_cast<const unsigned char*>(value.data() + offset), size);
+                offset += size;
+            }
+            // a long text is only kept in its record, which also tells if it is in a range around a long text
+            auto hashedColumns = std::vector<size_t> {};
+            for (auto column = size_t { 0 }; column < keyTypes.size(); ++column) {
+                if (keyTypes[column] == PropertyType::TEXT && values[column].size() > INDEX_TEXT_KEY_PREFIX_LENGTH) {
+                    hashedColumns.emplace_back(column);
+                }
+            }
+            if (!isExact || !hashedColumns.empty()) {
+                auto result = dataRecord.getResult(positionId);
+                if (!isExact && !isInKeyRange(conjunct, result, classInfo.type, isVersionEnabled)) {
+                    continue;
+                }
+                for (const auto& column : hashedColumns) {
+                    auto text = RecordParser::parseRawDataPropertyValue(
+                        result, indexInfo.propertyIds[column], classInfo.type, isVersionEnabled);
+                    values[column] = Bytes { text.first, text.second };
+                }
+            }
+            auto properties = Record::PropertyToBytesMap {};
+            for (const auto& propertyName : propertyNames) {
+                auto column = std::find(columnNames.cbegin(), columnNames.cend(), propertyName) - columnNames.cbegin();
+                if (!values[column].empty()) {
+                    properties[propertyName] = values[column];
+                }
+            }
+            auto recordId = RecordId { classInfo.id, positionId };
+            auto record = Record { properties };
+            record.setBasicInfo(CLASS_NAME_PROPERTY, classInfo.name)
+                .setBasicInfo(RECORD_ID_PROPERTY, rid2str(recordId))
+                .setBasicInfo(DEPTH_PROPERTY, 0U)
+                .setBasicInfo(VERSION_PROPERTY, VersionId { 0 });
+            resultSet.emplace_back(Result { RecordDescriptor { classInfo.id, positionId }, record });
+        }
+        std::sort(resultSet.begin(), resultSet.end(), [](const Result& lhs, const Result& rhs) {
+            return lhs.descriptor.rid < rhs.descriptor.rid;
+        });
+        return resultSet;
+    }
+
+    std::string IndexUtils::getCompositeKey(const IndexAccessInfo& indexInfo,
+        const std::vector<PropertyAccessInfo>& propertyInfos,
+        const Record& record,
+        const PositionId& positionId)
+    {
+        auto key = std::string {};
+        auto hasMissingValue = false;
+        for (auto i = size_t { 0 }; i < indexInfo.propertyIds.size(); ++i) {
+            const auto& propertyInfo = propertyInfos[i];
+            auto value = record.get(propertyInfo.name);
+            if (value.empty() || (propertyInfo.type == PropertyType::TEXT && value.toText().empty())) {
+                if (key.empty()) {
+                    return key;
+                }
+                key.push_back('\x00');
+                hasMissingValue = true;
+            } else {
+                appendKeyComponent(key, propertyInfo.type, value);
+            }
+        }
+        if (indexInfo.isUnique && hasMissingValue) {
+            key.append(reinterpret_cast<const char*>(&positionId), sizeof(PositionId));
+        }
+        return key;
+    }
+
+    std::string IndexUtils::getPolymorphicKey(const PropertyType& type, const Bytes& value)
+    {
+        auto key = std::string {};
+        if (!value.empty() && !(type == PropertyType::TEXT && value.toText().empty())) {
+            appendKeyComponent(key, type, value);
+        }
+        return key;
+    }
+
+    void IndexUtils::appendKeyComponent(std::string& key, const PropertyType& type, const Bytes& value)
+    {
+        key.push_back('\x01');
+        if (type == PropertyType::TEXT) {
+            appendEscapedText(key, getTextKey(value.toText()));
+            key.append(2, '\x00');
+        } else {
+            auto numericKey = getNumericKey(type, value);
+            for (auto shift = 56; shift >= 0; shift -= 8) {
+                key.push_back(static_cast<char>((numericKey >> shift) & 0xff));
+            }
+        }
+    }
+
+    void IndexUtils::appendEscapedText(std::string& key, const std::string& text)
+    {
+        for (const auto& c : text) {
+            key.push_back(c);
+            if (c == '\x00') {
+                key.push_back('\xff');
+            }
+        }
+    }
+
+    std::string IndexUtils::getCompositeValue(const IndexAccessInfo& indexInfo,
+        const std::vector<PropertyAccessInfo>& propertyInfos,
+        const Record& record,
+        const PositionId& positionId)
+    {
+        auto value = std::string(reinterpret_cast<const char*>(&positionId), sizeof(PositionId));
+        for (auto i = indexInfo.propertyIds.size(); i < propertyInfos.size(); ++i) {
+            auto bytes = record.get(propertyInfos[i].name);
+            auto size = static_cast<uint32_t>(bytes.size());
+            value.append(reinterpret_cast<const char*>(&size), sizeof(uint32_t));
+            if (size > 0) {
+                value.append(reinterpret_cast<const char*>(bytes.getRaw()), size);
+            }
+        }
+        return value;
+    }
+
+    Bytes IndexUtils::retrieveKeyComponent(const std::string& key, size_t& offset, const PropertyType& type)
+    {
+        if (key[offset++] == '\x00') {
+            return Bytes {};
+        }
+        if (type == PropertyType::TEXT) {
+            auto text = std::string {};
+            while (!(key[offset] == '\x00' && key[offset + 1] == '\x00')) {
+                text.push_back(key[offset]);
+                offset += (key[offset] == '\x00') ? 2 : 1;
+            }
+            offset += 2;
+            return Bytes { reinterpret_cast<const unsigned char*>(text.data()), text.size() };
+        }
+        auto numericKey = uint64_t {};
+        for (auto i = 0; i < 8; ++i) {
+            numericKey = numericKey << 8 | static_cast<unsigned char>(key[offset++]);
+        }
+        switch (type) {
+        case PropertyType::UNSIGNED_TINYINT:
+            return Bytes { static_cast<uint8_t>(numericKey) };
+        case PropertyType::UNSIGNED_SMALLINT:
+            return Bytes { static_cast<uint16_t>(numericKey) };
+        case PropertyType::UNSIGNED_INTEGER:
+            return Bytes { static_cast<uint32_t>(numericKey) };
+        case PropertyType::UNSIGNED_BIGINT:
+            return Bytes { numericKey };
+        case PropertyType::TINYINT:
+            return Bytes { static_cast<int8_t>(static_cast<int64_t>(numericKey ^ INDEX_KEY_SIGN_BIT)) };
+        case PropertyType::SMALLINT:
+            return Bytes { static_cast<int16_t>(static_cast<int64_t>(numericKey ^ INDEX_KEY_SIGN_BIT)) };
+        case PropertyType::INTEGER:
+            return Bytes { static_cast<int32_t>(static_cast<int64_t>(numericKey ^ INDEX_KEY_SIGN_BIT)) };
+        case PropertyType::BIGINT:
+            return Bytes { static_cast<int64_t>(numericKey ^ INDEX_KEY_SIGN_BIT) };
+        case PropertyType::REAL: {
+            auto bits = (numericKey & INDEX_KEY_SIGN_BIT) ? (numericKey ^ INDEX_KEY_SIGN_BIT) : ~numericKey;
+            auto value = double {};
+            std::memcpy(&value, &bits, sizeof(value));
+            return Bytes { value };
+        }
+        default:
+            require(false);
+            return Bytes {};
+        }
     }
 
-    IndexRecord IndexUtils::openIndexRecordPositive(const Transaction *txn, const IndexAccessInfo& indexInfo)
+    IndexConjunct IndexUtils::getCompositeConjunct(const PropertyNameMapInfo& propertyInfos,
+        const IndexAccessInfo& indexInfo,
+        const std::vector<const Condition*>& conditions)
     {
-        auto uniqueFlag = (indexInfo.isUnique) ? INDEX_TYPE_UNIQUE : INDEX_TYPE_NON_UNIQUE;
-        auto indexFlags = INDEX_TYPE_POSITIVE | INDEX_TYPE_NUMERIC | uniqueFlag;
-        auto indexAccess = IndexRecord { txn->_txnBase, indexInfo.id, (unsigned int)indexFlags };
-        return indexAccess;
+        auto conjunct = IndexConjunct {};
+        conjunct.indexInfo = indexInfo;
+        for (const auto& propertyId : indexInfo.propertyIds) {
+            auto foundProperty = std::find_if(propertyInfos.cbegin(), propertyInfos.cend(),
+                [&propertyId](const PropertyNameMapInfo::value_type& property) {
+                    return property.second.id == propertyId;
+                });
+            if (foundProperty == propertyInfos.cend()) {
+                break;
+            }
+            const auto& propertyInfo = foundProperty->second;
+            auto findKeyCondition = [&](bool isEqual) {
+                return std::find_if(conditions.cbegin(), conditions.cend(), [&](const Condition* condition) {
+                    return condition->propName == propertyInfo.name
+                        && !condition->isNegative
+                        && (condition->comp == Condition::Comparator::EQUAL) == isEqual
+                        && !isInList(*condition)
+                        && isIndexable(propertyInfo, *condition);
+                });
+            };
+            auto foundCondition = findKeyCondition(true);
+            auto isRange = (foundCondition == conditions.cend());
+            if (isRange) {
+                foundCondition = findKeyCondition(false);
+                if (foundCondition == conditions.cend()) {
+                    break;
+                }
+            }
+            conjunct.keyConditions.emplace_back(*foundCondition);
+            conjunct.keyPropertyInfos.emplace_back(propertyInfo);
+            // a range can only be walked on the last column used
+            if (isRange) {
+                break;
+            }
+        }
+        if (!conjunct.keyConditions.empty()) {
+            conjunct.condition = conjunct.keyConditions.front();
+            conjunct.propertyInfo = conjunct.keyPropertyInfos.front();
+        }
+        return conjunct;
     }
 
-    IndexRecord IndexUtils::openIndexRecordNegative(const Transaction *txn, const IndexAccessInfo& indexInfo)
+    bool IndexUtils::getCompositeKeyRange(const IndexConjunct& conjunct,
+        std::string& lowerKey,
+        std::string& upperKey,
+        std::pair<bool, bool>& isIncludeBound)
     {
-        auto uniqueFlag = (indexInfo.isUnique) ? INDEX_TYPE_UNIQUE : INDEX_TYPE_NON_UNIQUE;
-        auto indexFlags = INDEX_TYPE_NEGATIVE | INDEX_TYPE_NUMERIC | uniqueFlag;
-        auto indexAccess = IndexRecord { txn->_txnBase, indexInfo.id, (unsigned int)indexFlags };
-        return indexAccess;
+        auto isLongText = [](const PropertyType& type, const Bytes& value) {
+            return type == PropertyType::TEXT && value.size() > INDEX_TEXT_KEY_PREFIX_LENGTH;
+        };
+        auto isExact = true;
+        auto prefix = std::string {};
+        auto rangeIndex = conjunct.keyConditions.size() - 1;
+        for (auto i = size_t { 0 }; i < rangeIndex; ++i) {
+            const auto& value = conjunct.keyConditions[i]->valueBytes;
+            isExact = isExact && !isLongText(conjunct.keyPropertyInfos[i].type, value);
+            appendKeyComponent(prefix, conjunct.keyPropertyInfos[i].type, value);
+        }
+        lowerKey = prefix;
+        upperKey = prefix;
+        const auto& condition = *conjunct.keyConditions[rangeIndex];
+        const auto& type = conjunct.keyPropertyInfos[rangeIndex].type;
+        if (condition.comp == Condition::Comparator::EQUAL) {
+            isExact = isExact && !isLongText(type, condition.valueBytes);
+            appendKeyComponent(lowerKey, type, condition.valueBytes);
+            upperKey = lowerKey;
+        } else {
+            auto lowerBound = (const Bytes*) nullptr;
+            auto upperBound = (const Bytes*) nullptr;
+            getBounds(condition, lowerBound, upperBound, isIncludeBound);
+            // NaN keys lie beyond the infinities and never satisfy a comparison
+            auto negativeInfinity = Bytes { -std::numeric_limits<double>::infinity() };
+            auto positiveInfinity = Bytes { std::numeric_limits<double>::infinity() };
+            if (type == PropertyType::REAL) {
+                if (lowerBound == nullptr) {
+                    lowerBound = &negativeInfinity;
+                    isIncludeBound.first = true;
+                }
+                if (upperBound == nullptr) {
+                    upperBound = &positiveInfinity;
+                    isIncludeBound.second = true;
+                }
+            }
+            // the long texts sharing the prefix of a long bound sort by their hash, so all of them are walked
+            if (lowerBound != nullptr && isLongText(type, *lowerBound)) {
+                lowerKey.push_back('\x01');
+                appendEscapedText(lowerKey, lowerBound->toText().substr(0, INDEX_TEXT_KEY_PREFIX_LENGTH));
+                lowerKey.append(2, '\x00');
+                isIncludeBound.first = true;
+                isExact = false;
+            } else if (lowerBound != nullptr) {
+                appendKeyComponent(lowerKey, type, *lowerBound);
+            } else {
+                lowerKey.push_back('\x01');
+            }
+            if (upperBound != nullptr && isLongText(type, *upperBound)) {
+                upperKey.push_back('\x01');
+                appendEscapedText(upperKey, upperBound->toText().substr(0, INDEX_TEXT_KEY_PREFIX_LENGTH));
+                upperKey.push_back('\xff');
+                isIncludeBound.second = true;
+                isExact = false;
+            } else if (upperBound != nullptr) {
+                appendKeyComponent(upperKey, type, *upperBound);
+            } else {
+                upperKey.push_back('\x02');
+            }
+        }
+        return isExact;
     }
 
-    IndexRecord IndexUtils::openIndexRecordString(const Transaction *txn, const IndexAccessInfo& indexInfo)
+    std::vector<RecordDescriptor> IndexUtils::getCompositeRecord(const Transaction *txn, const IndexConjunct& conjunct)
     {
-        auto uniqueFlag = (indexInfo.isUnique) ? INDEX_TYPE_UNIQUE : INDEX_TYPE_NON_UNIQUE;
-        auto indexFlags = INDEX_TYPE_POSITIVE | INDEX_TYPE_STRING | uniqueFlag;
-        auto indexAccess = IndexRecord { txn->_txnBase, indexInfo.id, (unsigned int)indexFlags };
-        return indexAccess;
+        auto result = std::vector<RecordDescriptor> {};
+        if (conjunct.keyConditions.empty()) {
+            return result;
+        }
+        auto lowerKey = std::string {};
+        auto upperKey = std::string {};
+        auto isIncludeBound = std::make_pair(true, true);
+        auto isExact = getCompositeKeyRange(conjunct, lowerKey, upperKey, isIncludeBound);
+
+        auto cursorHandler = openIndexRecordString(txn, conjunct.indexInfo).getCursor();
+        for (auto keyValue = cursorHandler.findRange(lowerKey);
+             !keyValue.empty();
+             keyValue = cursorHandler.getNext()) {
+            auto key = keyValue.key.data.string();
+            if (!isIncludeBound.first && key.compare(0, lowerKey.size(), lowerKey) == 0)
+                continue;
+            auto upperCompare = key.compare(0, upperKey.size(), upperKey);
+            if (upperCompare > 0 || (upperCompare == 0 && !isIncludeBound.second))
+                break;
+            auto positionId = keyValue.val.data.numeric<PositionId>();
+            result.emplace_back(RecordDescriptor { conjunct.indexInfo.classId, positionId });
+        }
+        if (!isExact) {
+            filterByKeyConditions(txn, conjunct, result);
+        }
+        sortByRdesc(result);
+        return result;
     }
 
-    void IndexUtils::createString(const Transaction *txn,
-        const PropertyAccessInfo& propertyInfo,
-        const IndexAccessInfo& indexInfo,
-        const ClassId& superClassId,
-        const ClassType& classType)
+    bool IndexUtils::isInKeyRange(const IndexConjunct& conjunct,
+        const storage_engine::lmdb::Result& result,
+        const ClassType& classType,
+        bool isVersionEnabled)
     {
-        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, indexInfo.classId, superClassId);
-        require(!propertyIdMapInfo.empty());
-        auto indexAccess = openIndexRecordString(txn, indexInfo);
-        auto dataRecord = DataRecord(txn->_txnBase, indexInfo.classId, classType);
-        std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
-            [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
-                auto const record = RecordParser::parseRawData(
-                    result, propertyIdMapInfo, classType == ClassType::EDGE, txn->_txnCtx->isVersionEnabled());
-                auto value = record.get(propertyInfo.name).toText();
-                if (!value.empty()) {
-                    auto indexRecord = Blob(sizeof(PositionId)).append(&positionId, sizeof(PositionId));
-                    indexAccess.create(value, indexRecord);
-                }
-            };
-        dataRecord.resultSetIter(callback);
+        for (auto i = size_t { 0 }; i < conjunct.keyConditions.size(); ++i) {
+            const auto& propertyInfo = conjunct.keyPropertyInfos[i];
+            auto value = RecordParser::parseRawDataPropertyValue(result, propertyInfo.id, classType, isVersionEnabled);
+            if (value.second == 0
+                || !RecordCompare::compareBytesValue(
+                       Bytes { value.first, value.second }, propertyInfo.type, *conjunct.keyConditions[i])) {
+                return false;
+            }
+        }
+        return true;
     }
 
-    void IndexUtils::insert(const Transaction *txn,
-        const IndexAccessInfo& indexInfo,
-        PositionId positionId,
-        const std::string& value)
+    void IndexUtils::filterByKeyConditions(const Transaction *txn,
+        const IndexConjunct& conjunct,
+        std::vector<RecordDescriptor>& recordDescriptors)
     {
-        auto indexAccess = openIndexRecordString(txn, indexInfo);
-        auto indexRecord = Blob(sizeof(PositionId)).append(&positionId, sizeof(PositionId));
-        indexAccess.create(value, indexRecord);
+        auto classInfo = txn->_adapter->dbClass()->getInfo(conjunct.indexInfo.classId);
+        auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
+        auto isVersionEnabled = txn->_txnCtx->isVersionEnabled();
+        recordDescriptors.erase(
+            std::remove_if(recordDescriptors.begin(), recordDescriptors.end(),
+                [&](const RecordDescriptor& recordDescriptor) {
+                    return !isInKeyRange(
+                        conjunct, dataRecord.getResult(recordDescriptor.rid.second), classInfo.type, isVersionEnabled);
+                }),
+            recordDescriptors.end());
     }
 
-    void IndexUtils::removeByCursor(const Transaction *txn,
+    size_t IndexUtils::getCountCompositeRecord(const Transaction *txn, const IndexConjunct& conjunct)
+    {
+        if (conjunct.keyConditions.empty()) {
+            return size_t { 0 };
+        }
+        auto lowerKey = std::string {};
+        auto upperKey = std::string {};
+        auto isIncludeBound = std::make_pair(true, true);
+        if (!getCompositeKeyRange(conjunct, lowerKey, upperKey, isIncludeBound)) {
+            return getCompositeRecord(txn, conjunct).size();
+        }
+        return getCountKeyRange(txn, conjunct.indexInfo, lowerKey, upperKey, isIncludeBound);
+    }
+
+    size_t IndexUtils::getCountKeyRange(const Transaction *txn,
         const IndexAccessInfo& indexInfo,
-        PositionId positionId,
-        const std::string& value)
+        const std::string& lowerKey,
+        const std::string& upperKey,
+        const std::pair<bool, bool>& isIncludeBound)
     {
-        auto indexAccessCursor = openIndexRecordPositive(txn, indexInfo).getCursor();
-        for (auto keyValue = indexAccessCursor.find(value);
+        auto count = size_t { 0 };
+        auto cursorHandler = openIndexRecordString(txn, indexInfo).getCursor();
+        for (auto keyValue = cursorHandler.findRange(lowerKey);
              !keyValue.empty();
-             keyValue = indexAccessCursor.getNext()) {
+             keyValue = cursorHandler.getNextNoDup()) {
             auto key = keyValue.key.data.string();
-            if (value == key) {
-                auto valueAsPositionId = keyValue.val.data.numeric<PositionId>();
-                if (positionId == valueAsPositionId) {
-                    indexAccessCursor.del();
-                    break;
-                }
-            } else {
+            if (!isIncludeBound.first && key.compare(0, lowerKey.size(), lowerKey) == 0)
+                continue;
+            auto upperCompare = key.compare(0, upperKey.size(), upperKey);
+            if (upperCompare > 0 || (upperCompare == 0 && !isIncludeBound.second))
                 break;
-            }
+            count += (indexInfo.isUnique) ? 1 : cursorHandler.count();
         }
+        return count;
     }
 
-    std::vector<RecordDescriptor> IndexUtils::getRecordFromMultiCondition(const Transaction *txn,
+    PositionBitmap IndexUtils::getRecordFromMultiCondition(const Transaction *txn,
         const PropertyNameMapInfo& propertyInfos,
         const PropertyIdMapIndex& propertyIndexInfo,
         const MultiCondition::CompositeNode* compositeNode,
@@ -671,32 +2438,21 @@ namespace index {
         auto& rightNode = compositeNode->getRightNode();
         auto& leftNode = compositeNode->getLeftNode();
         auto isApplyNegative = compositeNode->getIsNegative() ^ isParentNegative;
-        auto result = std::vector<RecordDescriptor> {};
         auto rightNodeResult = getMultiConditionResult(txn, propertyInfos, propertyIndexInfo, rightNode, isApplyNegative);
-        auto leftNodeResult = getMultiConditionResult(txn, propertyInfos, propertyIndexInfo, leftNode, isApplyNegative);
-
-        static const auto cmpRecordDescriptor =
-            [](const RecordDescriptor& lhs, const RecordDescriptor& rhs) noexcept
-        {
-            return lhs.rid < rhs.rid;
-        };
-
         if ((opt == MultiCondition::Operator::AND && !isApplyNegative) ||
             (opt == MultiCondition::Operator::OR && isApplyNegative)) {
-            // AND action
-            std::set_intersection(rightNodeResult.begin(), rightNodeResult.end(),
-                leftNodeResult.begin(), leftNodeResult.end(),
-                std::back_inserter(result), cmpRecordDescriptor);
+            // AND action, where the other branch cannot add anything to an empty one
+            if (rightNodeResult.empty()) {
+                return rightNodeResult;
+            }
+            return rightNodeResult & getMultiConditionResult(txn, propertyInfos, propertyIndexInfo, leftNode, isApplyNegative);
         } else {
             // OR action
-            std::set_union(rightNodeResult.begin(), rightNodeResult.end(),
-                leftNodeResult.begin(), leftNodeResult.end(),
-                std::back_inserter(result), cmpRecordDescriptor);
+            return rightNodeResult | getMultiConditionResult(txn, propertyInfos, propertyIndexInfo, leftNode, isApplyNegative);
         }
-        return result;
     };
 
-    std::vector<RecordDescriptor> IndexUtils::getMultiConditionResult(const Transaction *txn,
+    PositionBitmap IndexUtils::getMultiConditionResult(const Transaction *txn,
         const PropertyNameMapInfo& propertyInfos,
         const PropertyIdMapIndex& propertyIndexInfo,
         const std::shared_ptr<MultiCondition::ExprNode>& exprNode,
@@ -713,233 +2469,325 @@ namespace index {
             auto& propertyInfo = foundProperty->second;
             auto foundIndexInfo = propertyIndexInfo.find(propertyInfo.id);
             require(foundIndexInfo != propertyIndexInfo.cend());
-            return getRecord(txn, propertyInfo, foundIndexInfo->second, condition, isNegative);
+            return getPositionBitmap(getRecord(txn, propertyInfo, foundIndexInfo->second, condition, isNegative));
         }
     };
 
-    std::vector<RecordDescriptor> IndexUtils::getLessOrEqual(const Transaction *txn,
-        const PropertyAccessInfo& propertyInfo,
-        const IndexAccessInfo& indexInfo,
-        const Bytes& value)
-    {
-        return getLessCommon(txn, propertyInfo, indexInfo, value, true);
-    }
-
-    std::vector<RecordDescriptor> IndexUtils::getLessThan(const Transaction *txn,
-        const PropertyAccessInfo& propertyInfo,
-        const IndexAccessInfo& indexInfo,
-        const Bytes& value)
-    {
-        return getLessCommon(txn, propertyInfo, indexInfo, value, false);
-    }
-
     std::vector<RecordDescriptor> IndexUtils::getEqual(const Transaction *txn,
         const PropertyAccessInfo& propertyInfo,
         const IndexAccessInfo& indexInfo,
         const Bytes& value)
     {
+        auto result = std::vector<RecordDescriptor> {};
+        // NaN values are indexed but never equal to anything
+        if (propertyInfo.type == PropertyType::REAL && std::isnan(value.toReal())) {
+            return result;
+        }
         switch (propertyInfo.type) {
         case PropertyType::UNSIGNED_TINYINT:
         case PropertyType::UNSIGNED_SMALLINT:
         case PropertyType::UNSIGNED_INTEGER:
-        case PropertyType::UNSIGNED_BIGINT: {
-            auto result = std::vector<RecordDescriptor> {};
-            auto indexAccessCursor = openIndexRecordPositive(txn, indexInfo).getCursor();
-            if (propertyInfo.type == PropertyType::UNSIGNED_TINYINT) {
-                return exactMatchIndex(
-                    indexAccessCursor, indexInfo.classId, static_cast<uint64_t>(value.toTinyIntU()), result);
-            } else if (propertyInfo.type == PropertyType::UNSIGNED_SMALLINT) {
-                return exactMatchIndex(
-                    indexAccessCursor, indexInfo.classId, static_cast<uint64_t>(value.toSmallIntU()), result);
-            } else if (propertyInfo.type == PropertyType::UNSIGNED_INTEGER) {
-                return exactMatchIndex(
-                    indexAccessCursor, indexInfo.classId, static_cast<uint64_t>(value.toIntU()), result);
-            } else {
-                return exactMatchIndex(indexAccessCursor, indexInfo.classId, value.toBigIntU(), result);
-            }
-        }
+        case PropertyType::UNSIGNED_BIGINT:
         case PropertyType::TINYINT:
-            return getEqualNumeric(txn, static_cast<int64_t>(value.toTinyInt()), indexInfo);
         case PropertyType::SMALLINT:
-            return getEqualNumeric(txn, static_cast<int64_t>(value.toSmallInt()), indexInfo);
         case PropertyType::INTEGER:
-            return getEqualNumeric(txn, static_cast<int64_t>(value.toInt()), indexInfo);
         case PropertyType::BIGINT:
-            return getEqualNumeric(txn, value.toBigInt(), indexInfo);
         case PropertyType::REAL:
-            return getEqualNumeric(txn, value.toReal(), indexInfo);
+            return exactMatchIndex(openIndexRecordNumeric(txn, indexInfo).getCursor(),
+                indexInfo.classId, getNumericKey(propertyInfo.type, value), result);
         case PropertyType::TEXT: {
-            auto result = std::vector<RecordDescriptor> {};
-            return exactMatchIndex(
-                openIndexRecordString(txn, indexInfo).getCursor(), indexInfo.classId, value.toText(), result);
+            // empty texts are not indexed and cannot be looked up
+            auto valueString = getCollatedText(indexInfo, value.toText());
+            if (valueString.empty()) {
+                return result;
+            }
+            auto key = getTextKey(valueString);
+            result = exactMatchIndex(
+                openIndexRecordString(txn, indexInfo).getCursor(), indexInfo.classId, key, result);
+            if (isHashedTextKey(key)) {
+                filterByText(txn, propertyInfo, indexInfo, result,
+                    [&](const Bytes& text) { return text.toText() == valueString; });
+            }
+            return result;
         }
         default:
             break;
         }
-        return std::vector<RecordDescriptor> {};
-    }
-
-    std::vector<RecordDescriptor> IndexUtils::getGreaterOrEqual(const Transaction *txn,
-        const PropertyAccessInfo& propertyInfo,
-        const IndexAccessInfo& indexInfo,
-        const Bytes& value)
-    {
-        return getGreaterCommon(txn, propertyInfo, indexInfo, value, true);
+        return result;
     }
 
-    std::vector<RecordDescriptor> IndexUtils::getGreaterThan(const Transaction *txn,
+    std::vector<RecordDescriptor> IndexUtils::getRange(const Transaction *txn,
         const PropertyAccessInfo& propertyInfo,
         const IndexAccessInfo& indexInfo,
-        const Bytes& value)
+        const Bytes* lowerBound,
+        const Bytes* upperBound,
+        const std::pair<bool, bool>& isIncludeBound)
     {
-        return getGreaterCommon(txn, propertyInfo, indexInfo, value, false);
+        switch (propertyInfo.type) {
+        case PropertyType::UNSIGNED_TINYINT:
+        case PropertyType::UNSIGNED_SMALLINT:
+        case PropertyType::UNSIGNED_INTEGER:
+        case PropertyType::UNSIGNED_BIGINT:
+        case PropertyType::TINYINT:
+        case PropertyType::SMALLINT:
+        case PropertyType::INTEGER:
+        case PropertyType::BIGINT: {
+            auto lower = (lowerBound != nullptr) ? getNumericKey(propertyInfo.type, *lowerBound) : uint64_t {};
+            auto upper = (upperBound != nullptr) ? getNumericKey(propertyInfo.type, *upperBound) : uint64_t {};
+            return rangeSearchIndex(openIndexRecordNumeric(txn, indexInfo).getCursor(), indexInfo.classId,
+                (lowerBound != nullptr) ? &lower : nullptr,
+                (upperBound != nullptr) ? &upper : nullptr,
+                isIncludeBound);
+        }
+        case PropertyType::REAL: {
+            if ((lowerBound != nullptr && std::isnan(lowerBound->toReal()))
+                || (upperBound != nullptr && std::isnan(upperBound->toReal()))) {
+                return std::vector<RecordDescriptor> {};
+            }
+            // NaN keys lie outside of the infinities, so an unbounded side stops at the infinity
+            auto lower = (lowerBound != nullptr) ?
+                encodeKey(lowerBound->toReal()) : encodeKey(-std::numeric_limits<double>::infinity());
+            auto upper = (upperBound != nullptr) ?
+                encodeKey(upperBound->toReal()) : encodeKey(std::numeric_limits<double>::infinity());
+            return rangeSearchIndex(openIndexRecordNumeric(txn, indexInfo).getCursor(), indexInfo.classId,
+                &lower, &upper,
+                std::make_pair(lowerBound == nullptr || isIncludeBound.first,
+                    upperBound == nullptr || isIncludeBound.second));
+        }
+        case PropertyType::TEXT: {
+            auto lower = (lowerBound != nullptr) ? getCollatedText(indexInfo, lowerBound->toText()) : std::string {};
+            auto upper = (upperBound != nullptr) ? getCollatedText(indexInfo, upperBound->toText()) : std::string {};
+            // empty texts are not indexed, so an empty lower bound is the same as none
+            return getTextRange(txn, propertyInfo, indexInfo,
+                (lowerBound != nullptr && !lower.empty()) ? &lower : nullptr,
+                (upperBound != nullptr) ? &upper : nullptr,
+                isIncludeBound);
+        }
+        default:
+            break;
+        }
+        return std::vector<RecordDescriptor> {};
     }
 
-    std::vector<RecordDescriptor> IndexUtils::getBetween(const Transaction *txn,
+    size_t IndexUtils::getCountRange(const Transaction *txn,
         const PropertyAccessInfo& propertyInfo,
         const IndexAccessInfo& indexInfo,
-        const Bytes& lowerBound, const Bytes& upperBound,
+        const Bytes* lowerBound,
+        const Bytes* upperBound,
         const std::pair<bool, bool>& isIncludeBound)
     {
         switch (propertyInfo.type) {
         case PropertyType::UNSIGNED_TINYINT:
         case PropertyType::UNSIGNED_SMALLINT:
         case PropertyType::UNSIGNED_INTEGER:
-        case PropertyType::UNSIGNED_BIGINT: {
-            auto indexAccessCursor = openIndexRecordPositive(txn, indexInfo).getCursor();
-            if (propertyInfo.type == PropertyType::UNSIGNED_TINYINT) {
-                return betweenSearchIndex(indexAccessCursor, indexInfo.classId,
-                    static_cast<uint64_t>(lowerBound.toTinyIntU()),
-                    static_cast<uint64_t>(upperBound.toTinyIntU()),
-                    true, isIncludeBound);
-            } else if (propertyInfo.type == PropertyType::UNSIGNED_SMALLINT) {
-                return betweenSearchIndex(indexAccessCursor, indexInfo.classId,
-                    static_cast<uint64_t>(lowerBound.toSmallIntU()),
-                    static_cast<uint64_t>(upperBound.toSmallIntU()),
-                    true, isIncludeBound);
-            } else if (propertyInfo.type == PropertyType::UNSIGNED_INTEGER) {
-                return betweenSearchIndex(indexAccessCursor, indexInfo.classId,
-                    static_cast<uint64_t>(lowerBound.toIntU()),
-                    static_cast<uint64_t>(upperBound.toIntU()),
-                    true, isIncludeBound);
-            } else {
-                return betweenSearchIndex(indexAccessCursor, indexInfo.classId,
-                    lowerBound.toBigIntU(), upperBound.toBigIntU(),
-                    true, isIncludeBound);
-            }
-        }
+        case PropertyType::UNSIGNED_BIGINT:
         case PropertyType::TINYINT:
-            return getBetweenNumeric(txn, static_cast<int64_t>(lowerBound.toTinyInt()),
-                static_cast<int64_t>(upperBound.toTinyInt()),
-                indexInfo, isIncludeBound);
         case PropertyType::SMALLINT:
-            return getBetweenNumeric(txn, static_cast<int64_t>(lowerBound.toSmallInt()),
-                static_cast<int64_t>(upperBound.toSmallInt()),
-                indexInfo, isIncludeBound);
         case PropertyType::INTEGER:
-            return getBetweenNumeric(txn, static_cast<int64_t>(lowerBound.toInt()),
-                static_cast<int64_t>(upperBound.toInt()),
-                indexInfo, isIncludeBound);
-        case PropertyType::BIGINT:
-            return getBetweenNumeric(txn, lowerBound.toBigInt(), upperBound.toBigInt(), indexInfo, isIncludeBound);
-        case PropertyType::REAL:
-            return getBetweenNumeric(txn, lowerBound.toReal(), upperBound.toReal(), indexInfo, isIncludeBound);
+        case PropertyType::BIGINT: {
+            auto lower = (lowerBound != nullptr) ? getNumericKey(propertyInfo.type, *lowerBound) : uint64_t {};
+            auto upper = (upperBound != nullptr) ? getNumericKey(propertyInfo.type, *upperBound) : uint64_t {};
+            return rangeCountIndex(openIndexRecordNumeric(txn, indexInfo).getCursor(),
+                (lowerBound != nullptr) ? &lower : nullptr,
+                (upperBound != nullptr) ? &upper : nullptr,
+                isIncludeBound, indexInfo.isUnique);
+        }
+        case PropertyType::REAL: {
+            if ((lowerBound != nullptr && std::isnan(lowerBound->toReal()))
+                || (upperBound != nullptr && std::isnan(upperBound->toReal()))) {
+                return size_t { 0 };
+            }
+            auto lower = (lowerBound != nullptr) ?
+                encodeKey(lowerBound->toReal()) : encodeKey(-std::numeric_limits<double>::infinity());
+            auto upper = (upperBound != nullptr) ?
+                encodeKey(upperBound->toReal()) : encodeKey(std::numeric_limits<double>::infinity());
+            return rangeCountIndex(openIndexRecordNumeric(txn, indexInfo).getCursor(),
+                &lower, &upper,
+                std::make_pair(lowerBound == nullptr || isIncludeBound.first,
+                    upperBound == nullptr || isIncludeBound.second),
+                indexInfo.isUnique);
+        }
         case PropertyType::TEXT: {
-            return betweenSearchIndex(openIndexRecordString(txn, indexInfo).getCursor(), indexInfo.classId,
-                lowerBound.toText(), upperBound.toText(), isIncludeBound);
+            auto lower = (lowerBound != nullptr) ? getCollatedText(indexInfo, lowerBound->toText()) : std::string {};
+            auto upper = (upperBound != nullptr) ? getCollatedText(indexInfo, upperBound->toText()) : std::string {};
+            if (isHashedTextKey(lower) || isHashedTextKey(upper)) {
+                return getRange(txn, propertyInfo, indexInfo, lowerBound, upperBound, isIncludeBound).size();
+            }
+            return rangeCountIndex(openIndexRecordString(txn, indexInfo).getCursor(),
+                (lowerBound != nullptr && !lower.empty()) ? &lower : nullptr,
+                (upperBound != nullptr) ? &upper : nullptr,
+                isIncludeBound, indexInfo.isUnique);
         }
         default:
             break;
         }
-        return std::vector<RecordDescriptor> {};
+        return size_t { 0 };
+    }
+
+    std::vector<RecordDescriptor> IndexUtils::getNotANumber(const Transaction *txn, const IndexAccessInfo& indexInfo)
+    {
+        auto negativeInfinity = encodeKey(-std::numeric_limits<double>::infinity());
+        auto positiveInfinity = encodeKey(std::numeric_limits<double>::infinity());
+        auto result = rangeSearchIndex(openIndexRecordNumeric(txn, indexInfo).getCursor(), indexInfo.classId,
+            static_cast<const uint64_t*>(nullptr), &negativeInfinity, std::make_pair(true, false));
+        auto positiveNaN = rangeSearchIndex(openIndexRecordNumeric(txn, indexInfo).getCursor(), indexInfo.classId,
+            &positiveInfinity, static_cast<const uint64_t*>(nullptr), std::make_pair(false, true));
+        result.insert(result.end(), positiveNaN.cbegin(), positiveNaN.cend());
+        return result;
     }
 
-    std::vector<RecordDescriptor> IndexUtils::getLessCommon(const Transaction *txn,
+    std::vector<RecordDescriptor> IndexUtils::getIn(const Transaction *txn,
         const PropertyAccessInfo& propertyInfo,
         const IndexAccessInfo& indexInfo,
-        const Bytes& value, bool isEqual)
+        const std::vector<Bytes>& values,
+        bool isNegative)
     {
+        auto result = std::vector<RecordDescriptor> {};
         switch (propertyInfo.type) {
         case PropertyType::UNSIGNED_TINYINT:
         case PropertyType::UNSIGNED_SMALLINT:
         case PropertyType::UNSIGNED_INTEGER:
-        case PropertyType::UNSIGNED_BIGINT: {
-            auto indexAccessCursor = openIndexRecordPositive(txn, indexInfo).getCursor();
-            if (propertyInfo.type == PropertyType::UNSIGNED_TINYINT) {
-                return backwardSearchIndex(indexAccessCursor, indexInfo.classId,
-                    static_cast<uint64_t>(value.toTinyIntU()), true, isEqual);
-            } else if (propertyInfo.type == PropertyType::UNSIGNED_SMALLINT) {
-                return backwardSearchIndex(indexAccessCursor, indexInfo.classId,
-                    static_cast<uint64_t>(value.toSmallIntU()), true, isEqual);
-            } else if (propertyInfo.type == PropertyType::UNSIGNED_INTEGER) {
-                return backwardSearchIndex(indexAccessCursor, indexInfo.classId, static_cast<uint64_t>(value.toIntU()),
-                    true, isEqual);
-            } else {
-                return backwardSearchIndex(indexAccessCursor, indexInfo.classId, value.toBigIntU(), true, isEqual);
-            }
-        }
+        case PropertyType::UNSIGNED_BIGINT:
         case PropertyType::TINYINT:
-            return getLessNumeric(txn, static_cast<int64_t>(value.toTinyInt()), indexInfo, isEqual);
         case PropertyType::SMALLINT:
-            return getLessNumeric(txn, static_cast<int64_t>(value.toSmallInt()), indexInfo, isEqual);
         case PropertyType::INTEGER:
-            return getLessNumeric(txn, static_cast<int64_t>(value.toInt()), indexInfo, isEqual);
         case PropertyType::BIGINT:
-            return getLessNumeric(txn, value.toBigInt(), indexInfo, isEqual);
-        case PropertyType::REAL:
-            return getLessNumeric(txn, value.toReal(), indexInfo, isEqual);
+        case PropertyType::REAL: {
+            // NaN keys are walked over as any other key outside of the list by a negative walk
+            auto keys = getNumericKeys(propertyInfo.type, values);
+            inListSearchIndex(openIndexRecordNumeric(txn, indexInfo).getCursor(), indexInfo.classId, keys,
+                isDenseInList(txn, propertyInfo, indexInfo, keys), isNegative, result);
+            break;
+        }
         case PropertyType::TEXT: {
-            return backwardSearchIndex(
-                openIndexRecordString(txn, indexInfo).getCursor(), indexInfo.classId, value.toText(), true, isEqual);
+            // empty texts are not indexed, and the keys of long texts are shared by every text with the same hash
+            auto keys = std::vector<std::string> {};
+            auto hashedKeys = std::vector<std::string> {};
+            auto longValues = std::unordered_set<std::string> {};
+            for (const auto& value : values) {
+                auto valueString = getCollatedText(indexInfo, value.toText());
+                if (valueString.empty()) {
+                    continue;
+                }
+                auto key = getTextKey(valueString);
+                if (isHashedTextKey(key)) {
+                    hashedKeys.emplace_back(std::move(key));
+                    longValues.emplace(std::move(valueString));
+                } else {
+                    keys.emplace_back(std::move(key));
+                }
+            }
+            for (auto sortedKeys : { &keys, &hashedKeys }) {
+                std::sort(sortedKeys->begin(), sortedKeys->end());
+                sortedKeys->erase(std::unique(sortedKeys->begin(), sortedKeys->end()), sortedKeys->end());
+            }
+            inListSearchIndex(openIndexRecordString(txn, indexInfo).getCursor(), indexInfo.classId, keys,
+                isDenseInList(txn, propertyInfo, indexInfo, keys), isNegative, result);
+            if (hashedKeys.empty()) {
+                break;
+            }
+            auto longResult = std::vector<RecordDescriptor> {};
+            inListSearchIndex(openIndexRecordString(txn, indexInfo).getCursor(), indexInfo.classId, hashedKeys,
+                false, false, longResult);
+            filterByText(txn, propertyInfo, indexInfo, longResult,
+                [&](const Bytes& text) { return longValues.find(text.toText()) != longValues.cend(); });
+            if (!isNegative) {
+                result.insert(result.end(), longResult.cbegin(), longResult.cend());
+                break;
+            }
+            sortByRdesc(longResult);
+            result.erase(
+                std::remove_if(result.begin(), result.end(), [&](const RecordDescriptor& recordDescriptor) {
+                    return std::binary_search(longResult.cbegin(), longResult.cend(), recordDescriptor,
+                        [](const RecordDescriptor& lhs, const RecordDescriptor& rhs) { return lhs.rid < rhs.rid; });
+                }),
+                result.end());
+            break;
         }
         default:
-            return std::vector<RecordDescriptor> {};
+            break;
         }
+        return result;
     }
 
-    std::vector<RecordDescriptor> IndexUtils::getGreaterCommon(const Transaction *txn,
+    size_t IndexUtils::getCountIn(const Transaction *txn,
         const PropertyAccessInfo& propertyInfo,
         const IndexAccessInfo& indexInfo,
-        const Bytes& value,
-        bool isEqual)
+        const std::vector<Bytes>& values)
     {
         switch (propertyInfo.type) {
         case PropertyType::UNSIGNED_TINYINT:
         case PropertyType::UNSIGNED_SMALLINT:
         case PropertyType::UNSIGNED_INTEGER:
-        case PropertyType::UNSIGNED_BIGINT: {
-            auto indexAccessCursor = openIndexRecordPositive(txn, indexInfo).getCursor();
-            if (propertyInfo.type == PropertyType::UNSIGNED_TINYINT) {
-                return forwardSearchIndex(
-                    indexAccessCursor, indexInfo.classId, static_cast<uint64_t>(value.toTinyIntU()), true, isEqual);
-            } else if (propertyInfo.type == PropertyType::UNSIGNED_SMALLINT) {
-                return forwardSearchIndex(
-                    indexAccessCursor, indexInfo.classId, static_cast<uint64_t>(value.toSmallIntU()), true, isEqual);
-            } else if (propertyInfo.type == PropertyType::UNSIGNED_INTEGER) {
-                return forwardSearchIndex(
-                    indexAccessCursor, indexInfo.classId, static_cast<uint64_t>(value.toIntU()), true, isEqual);
-            } else {
-                return forwardSearchIndex(indexAccessCursor, indexInfo.classId, value.toBigIntU(), true, isEqual);
-            }
-        }
+        case PropertyType::UNSIGNED_BIGINT:
         case PropertyType::TINYINT:
-            return getGreaterNumeric(txn, static_cast<int64_t>(value.toTinyInt()), indexInfo, isEqual);
         case PropertyType::SMALLINT:
-            return getGreaterNumeric(txn, static_cast<int64_t>(value.toSmallInt()), indexInfo, isEqual);
         case PropertyType::INTEGER:
-            return getGreaterNumeric(txn, static_cast<int64_t>(value.toInt()), indexInfo, isEqual);
         case PropertyType::BIGINT:
-            return getGreaterNumeric(txn, value.toBigInt(), indexInfo, isEqual);
-        case PropertyType::REAL:
-            return getGreaterNumeric(txn, value.toReal(), indexInfo, isEqual);
+        case PropertyType::REAL: {
+            auto keys = getNumericKeys(propertyInfo.type, values);
+            return inListCountIndex(openIndexRecordNumeric(txn, indexInfo).getCursor(), keys,
+                isDenseInList(txn, propertyInfo, indexInfo, keys), indexInfo.isUnique);
+        }
         case PropertyType::TEXT: {
-            return forwardSearchIndex(
-                openIndexRecordString(txn, indexInfo).getCursor(), indexInfo.classId, value.toText(), isEqual);
+            auto keys = std::vector<std::string> {};
+            for (const auto& value : values) {
+                auto valueString = getCollatedText(indexInfo, value.toText());
+                if (valueString.empty()) {
+                    continue;
+                }
+                if (isHashedTextKey(getTextKey(valueString))) {
+                    return getIn(txn, propertyInfo, indexInfo, values, false).size();
+                }
+                keys.emplace_back(std::move(valueString));
+            }
+            std::sort(keys.begin(), keys.end());
+            keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+            return inListCountIndex(openIndexRecordString(txn, indexInfo).getCursor(), keys,
+                isDenseInList(txn, propertyInfo, indexInfo, keys), indexInfo.isUnique);
         }
         default:
             break;
         }
-        return std::vector<RecordDescriptor> {};
+        return size_t { 0 };
+    }
+
+    std::vector<uint64_t> IndexUtils::getNumericKeys(const PropertyType& type, const std::vector<Bytes>& values)
+    {
+        auto keys = std::vector<uint64_t> {};
+        keys.reserve(values.size());
+        for (const auto& value : values) {
+            if (value.empty() || (type == PropertyType::REAL && std::isnan(value.toReal()))) {
+                continue;
+            }
+            keys.emplace_back(getNumericKey(type, value));
+        }
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        return keys;
+    }
+
+    bool IndexUtils::isDenseInList(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const std::vector<uint64_t>& keys)
+    {
+        if (keys.empty()) {
+            return false;
+        }
+        // the keys of integers are dense in their own range, while those of reals are spread over all bits
+        if (propertyInfo.type != PropertyType::REAL && keys.back() - keys.front() < keys.size() * INDEX_IN_LIST_DENSITY) {
+            return true;
+        }
+        return keys.size() * INDEX_IN_LIST_DENSITY >= getCountIndexEntry(txn, propertyInfo, indexInfo);
+    }
+
+    bool IndexUtils::isDenseInList(const Transaction *txn,
+        const PropertyAccessInfo& propertyInfo,
+        const IndexAccessInfo& indexInfo,
+        const std::vector<std::string>& keys)
+    {
+        return !keys.empty() && keys.size() * INDEX_IN_LIST_DENSITY >= getCountIndexEntry(txn, propertyInfo, indexInfo);
     }
 
     std::vector<RecordDescriptor> IndexUtils::exactMatchIndex(const storage_engine::lmdb::Cursor& cursorHandler,
@@ -961,61 +2809,46 @@ namespace index {
         return std::move(result);
     };
 
-    std::vector<RecordDescriptor> IndexUtils::fullScanIndex(const storage_engine::lmdb::Cursor& cursorHandler,
-        const ClassId& classId)
-    {
-        auto result = std::vector<RecordDescriptor> {};
-        for (auto keyValue = cursorHandler.getNext();
-             !keyValue.empty();
-             keyValue = cursorHandler.getNext()) {
-            auto positionId = keyValue.val.data.numeric<PositionId>();
-            result.emplace_back(RecordDescriptor { classId, positionId });
-        }
-        return result;
-    };
-
-    std::vector<RecordDescriptor> IndexUtils::forwardSearchIndex(const storage_engine::lmdb::Cursor& cursorHandler,
+    std::vector<RecordDescriptor> IndexUtils::rangeSearchIndex(const storage_engine::lmdb::Cursor& cursorHandler,
         const ClassId& classId,
-        const std::string& value,
-        bool isInclude)
+        const std::string* lower,
+        const std::string* upper,
+        const std::pair<bool, bool>& isIncludeBound)
     {
         auto result = std::vector<RecordDescriptor> {};
-        for (auto keyValue = cursorHandler.findRange(value);
+        for (auto keyValue = (lower != nullptr) ? cursorHandler.findRange(*lower) : cursorHandler.getNext();
              !keyValue.empty();
              keyValue = cursorHandler.getNext()) {
-            if (!isInclude) {
-                auto key = keyValue.key.data.string();
-                if (key == value)
-                    continue;
-                else
-                    isInclude = true;
-            }
+            auto key = keyValue.key.data.string();
+            if (lower != nullptr && !isIncludeBound.first && key == *lower)
+                continue;
+            if (upper != nullptr && ((!isIncludeBound.second && key == *upper) || key > *upper))
+                break;
             auto positionId = keyValue.val.data.numeric<PositionId>();
             result.emplace_back(RecordDescriptor { classId, positionId });
         }
         return result;
     };
 
-    std::vector<RecordDescriptor> IndexUtils::betweenSearchIndex(const storage_engine::lmdb::Cursor& cursorHandler,
-        const ClassId& classId,
-        const std::string& lower,
-        const std::string& upper,
-        const std::pair<bool, bool>& isIncludeBound)
+    size_t IndexUtils::rangeCountIndex(const storage_engine::lmdb::Cursor& cursorHandler,
+        const std::string* lower,
+        const std::string* upper,
+        const std::pair<bool, bool>& isIncludeBound,
+        bool isUnique)
     {
-        auto result = std::vector<RecordDescriptor> {};
-        for (auto keyValue = cursorHandler.findRange(lower);
+        auto count = size_t { 0 };
+        for (auto keyValue = (lower != nullptr) ? cursorHandler.findRange(*lower) : cursorHandler.getNext();
              !keyValue.empty();
-             keyValue = cursorHandler.getNext()) {
+             keyValue = cursorHandler.getNextNoDup()) {
             auto key = keyValue.key.data.string();
-            if (!isIncludeBound.first && (key == lower))
+            if (lower != nullptr && !isIncludeBound.first && key == *lower)
                 continue;
-            if ((!isIncludeBound.second && (key == upper)) || (key > upper))
+            if (upper != nullptr && ((!isIncludeBound.second && key == *upper) || key > *upper))
                 break;
-            auto positionId = keyValue.val.data.numeric<PositionId>();
-            result.emplace_back(RecordDescriptor { classId, positionId });
+            count += (isUnique) ? 1 : cursorHandler.count();
         }
-        return result;
-    };
+        return count;
+    }
 
 }
-}
\ No newline at end of file
+}
@@ -22,16 +22,22 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cstring>
 #include <functional>
+#include <memory>
 #include <type_traits>
 #include <unordered_set>
 #include <vector>
 
 #include "datarecord_adapter.hpp"
 #include "index_adapter.hpp"
+#include "index_sorter.hpp"
 #include "lmdb_engine.hpp"
+#include "position_bitmap.hpp"
 #include "schema.hpp"
 #include "schema_adapter.hpp"
+#include "statistics.hpp"
 
 #include "nogdb/nogdb.h"
 #include "nogdb/nogdb_types.h"
@@ -42,9 +48,194 @@ namespace index {
     using namespace adapter::datarecord;
     using namespace schema;
     using parser::RecordParser;
+    using statistics::StatisticsUtils;
 
     typedef std::map<PropertyId, IndexAccessInfo> PropertyIdMapIndex;
     typedef std::map<std::string, std::pair<PropertyAccessInfo, IndexAccessInfo>> PropertyNameMapIndex;
+    typedef std::vector<std::pair<IndexAccessInfo, std::vector<PropertyAccessInfo>>> CompositeIndexInfos;
+    typedef std::vector<std::pair<IndexAccessInfo, PropertyAccessInfo>> TextIndexInfos;
+    typedef std::vector<std::pair<IndexAccessInfo, PropertyAccessInfo>> PolymorphicIndexInfos;
+
+    // relative costs used by the access-path selection of multi-conditions
+    constexpr double INDEX_ENTRY_COST = 1.0;
+    constexpr double RECORD_FETCH_COST = 4.0;
+    constexpr double RECORD_SCAN_COST = 3.0;
+    constexpr double DEFAULT_RANGE_SELECTIVITY = 1.0 / 3.0;
+
+    constexpr uint64_t INDEX_KEY_SIGN_BIT = uint64_t { 1 } << 63;
+
+    // FNV-1a parameters of the hash in the keys of long texts
+    constexpr uint64_t INDEX_TEXT_HASH_OFFSET_BASIS = 14695981039346656037ULL;
+    constexpr uint64_t INDEX_TEXT_HASH_PRIME = 1099511628211ULL;
+
+    // number of descriptors which a lazy index cursor reads per seek
+    constexpr size_t INDEX_CURSOR_FETCH_SIZE = 128;
+
+    // an IN-list with a value for at least one in this many keys of its range is merge-scanned instead of sought
+    constexpr size_t INDEX_IN_LIST_DENSITY = 8;
+
+    /**
+     * A lookup of one index. A composite index is looked up by the key conditions on its leading columns,
+     * in which case condition is the first of them.
+     */
+    struct IndexConjunct {
+        const Condition* condition { nullptr };
+        PropertyAccessInfo propertyInfo {};
+        IndexAccessInfo indexInfo {};
+        size_t estimatedCount { 0 };
+        std::vector<const Condition*> keyConditions {};
+        std::vector<PropertyAccessInfo> keyPropertyInfos {};
+    };
+
+    /**
+     * An access path for a multi-condition which cannot be answered by indexes alone.
+     * Index lookups of the chosen top-level conjuncts are intersected into candidates
+     * and the whole multi-condition is then checked against each candidate as a residual filter.
+     * No conjuncts means that a full scan is expected to be cheaper.
+     */
+    struct IndexPlan {
+        std::vector<IndexConjunct> conjuncts {};
+        size_t classCount { 0 };
+        size_t estimatedCount { 0 };
+    };
+
+    /**
+     * A source of record descriptors which are read from an index on demand, in index order.
+     */
+    class IndexCursor {
+    public:
+        virtual ~IndexCursor() noexcept = default;
+
+        // append at most limit descriptors, returning false once there are no more of them
+        virtual bool fetch(std::vector<RecordDescriptor>& recordDescriptors, size_t limit) = 0;
+    };
+
+    /**
+     * Walk an index range a batch at a time. Cursors of a write transaction are released when it ends,
+     * so the position of the last descriptor is kept instead of an open LMDB cursor and every batch
+     * seeks back to it. A null bound means that the range is unbounded on that side.
+     */
+    template <typename T>
+    class IndexRangeCursor : public IndexCursor {
+    public:
+        IndexRangeCursor(const storage_engine::LMDBTxn* txnBase,
+            const IndexAccessInfo& indexInfo,
+            unsigned int indexFlags,
+            const T* lower,
+            const T* upper,
+            const std::pair<bool, bool>& isIncludeBound)
+            : _txnBase { txnBase }
+            , _indexInfo { indexInfo }
+            , _indexFlags { indexFlags }
+            , _hasLower { lower != nullptr }
+            , _hasUpper { upper != nullptr }
+            , _lower { (lower != nullptr) ? *lower : T {} }
+            , _upper { (upper != nullptr) ? *upper : T {} }
+            , _isIncludeBound { isIncludeBound }
+        {
+        }
+
+        bool fetch(std::vector<RecordDescriptor>& recordDescriptors, size_t limit) override
+        {
+            auto cursorHandler = adapter::index::IndexRecord { _txnBase, _indexInfo.id, _indexFlags }.getCursor();
+            for (auto keyValue = seek(cursorHandler);
+                 !keyValue.empty();
+                 keyValue = cursorHandler.getNext()) {
+                auto key = getKey(keyValue);
+                if (!_hasLast && _hasLower && !_isIncludeBound.first && key == _lower)
+                    continue;
+                if (_hasUpper && ((!_isIncludeBound.second && key == _upper) || key > _upper))
+                    return false;
+                if (limit == 0)
+                    return true;
+                _last = key;
+                _lastPositionId = keyValue.val.data.template numeric<PositionId>();
+                _hasLast = true;
+                recordDescriptors.emplace_back(RecordDescriptor { _indexInfo.classId, _lastPositionId });
+                --limit;
+            }
+            return false;
+        }
+
+    private:
+        const storage_engine::LMDBTxn* _txnBase;
+        IndexAccessInfo _indexInfo;
+        unsigned int _indexFlags;
+        bool _hasLower;
+        bool _hasUpper;
+        T _lower;
+        T _upper;
+        std::pair<bool, bool> _isIncludeBound;
+        bool _hasLast { false };
+        T _last {};
+        PositionId _lastPositionId { 0 };
+
+        static uint64_t getKey(const storage_engine::lmdb::CursorResult& keyValue, const uint64_t*)
+        {
+            return keyValue.key.data.numeric<uint64_t>();
+        }
+
+        static std::string getKey(const storage_engine::lmdb::CursorResult& keyValue, const std::string*)
+        {
+            return keyValue.key.data.string();
+        }
+
+        T getKey(const storage_engine::lmdb::CursorResult& keyValue) const
+        {
+            return getKey(keyValue, static_cast<const T*>(nullptr));
+        }
+
+        // the entry after the last descriptor read, which may have been removed since then
+        storage_engine::lmdb::CursorResult seek(const storage_engine::lmdb::Cursor& cursorHandler) const
+        {
+            if (!_hasLast) {
+                return (_hasLower) ? cursorHandler.findRange(_lower) : cursorHandler.getNext();
+            }
+            if (!_indexInfo.isUnique) {
+                auto keyValue = cursorHandler.findRange(_last, _lastPositionId);
+                if (!keyValue.empty()) {
+                    if (keyValue.val.data.template numeric<PositionId>() == _lastPositionId) {
+                        return cursorHandler.getNext();
+                    }
+                    return keyValue;
+                }
+            }
+            auto keyValue = cursorHandler.findRange(_last);
+            if (!keyValue.empty() && getKey(keyValue) == _last) {
+                return (_indexInfo.isUnique) ? cursorHandler.getNext() : cursorHandler.getNextNoDup();
+            }
+            return keyValue;
+        }
+    };
+
+    /**
+     * Keep the descriptors read from another index cursor whose records match a text condition,
+     * for key ranges which only contain all matches, such as the prefix of a like pattern.
+     */
+    class IndexFilterCursor : public IndexCursor {
+    public:
+        IndexFilterCursor(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const Condition& condition,
+            IndexCursor* indexCursor)
+            : _txn { txn }
+            , _propertyInfo { propertyInfo }
+            , _indexInfo { indexInfo }
+            , _condition { condition }
+            , _indexCursor { indexCursor }
+        {
+        }
+
+        bool fetch(std::vector<RecordDescriptor>& recordDescriptors, size_t limit) override;
+
+    private:
+        const Transaction *_txn;
+        PropertyAccessInfo _propertyInfo;
+        IndexAccessInfo _indexInfo;
+        Condition _condition;
+        std::unique_ptr<IndexCursor> _indexCursor;
+    };
 
     struct IndexUtils {
 
@@ -58,6 +249,24 @@ namespace index {
             const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo);
 
+        static void initialize(const Transaction *txn,
+            const std::vector<PropertyAccessInfo>& propertyInfos,
+            const IndexAccessInfo& indexInfo,
+            const ClassId& superClassId,
+            const ClassType& classType);
+
+        static void drop(const Transaction *txn,
+            const std::vector<PropertyAccessInfo>& propertyInfos,
+            const IndexAccessInfo& indexInfo);
+
+        static void initializeText(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const ClassId& superClassId,
+            const ClassType& classType);
+
+        static void dropText(const Transaction *txn, const IndexAccessInfo& indexInfo);
+
         static void drop(const Transaction *txn,
             const ClassId& classId,
             const PropertyNameMapInfo& propertyNameMapInfo);
@@ -89,11 +298,131 @@ namespace index {
             const Record& record,
             const PropertyNameMapInfo& propertyNameMapInfo);
 
+        static void insert(const Transaction *txn,
+            const RecordDescriptor& recordDescriptor,
+            const Record& record,
+            const CompositeIndexInfos& compositeIndexInfos);
+
+        static void remove(const Transaction *txn,
+            const RecordDescriptor& recordDescriptor,
+            const Record& record,
+            const CompositeIndexInfos& compositeIndexInfos);
+
+        static CompositeIndexInfos getCompositeIndexInfos(const Transaction *txn,
+            const ClassId& classId,
+            const PropertyNameMapInfo& propertyNameMapInfo);
+
+        static void insert(const Transaction *txn,
+            const RecordDescriptor& recordDescriptor,
+            const Record& record,
+            const TextIndexInfos& textIndexInfos);
+
+        static void remove(const Transaction *txn,
+            const RecordDescriptor& recordDescriptor,
+            const Record& record,
+            const TextIndexInfos& textIndexInfos);
+
+        static TextIndexInfos getTextIndexInfos(const Transaction *txn,
+            const ClassId& classId,
+            const PropertyNameMapInfo& propertyNameMapInfo);
+
+        /**
+         * A polymorphic index is keyed as a composite index on one column, and each of its entries holds
+         * the record id of a record of its class or of any subclass as {classId<uint16>}{positionId<uint32>}
+         * in big-endian, so that the entries of a key are in the order of their record ids.
+         */
+        static void initializePolymorphic(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo);
+
+        static void dropPolymorphic(const Transaction *txn, const IndexAccessInfo& indexInfo);
+
+        static void insertPolymorphic(const Transaction *txn,
+            const RecordDescriptor& recordDescriptor,
+            const Record& record,
+            const PolymorphicIndexInfos& polymorphicIndexInfos);
+
+        static void removePolymorphic(const Transaction *txn,
+            const RecordDescriptor& recordDescriptor,
+            const Record& record,
+            const PolymorphicIndexInfos& polymorphicIndexInfos);
+
+        // the polymorphic indexes of the class and of all its superclasses, which all keep the records of the class
+        static PolymorphicIndexInfos getPolymorphicIndexInfos(const Transaction *txn,
+            const ClassId& classId,
+            const PropertyNameMapInfo& propertyNameMapInfo);
+
+        /**
+         * The lookup of a polymorphic index on the class for the top-level conjunct with the fewest
+         * index entries. No key conditions are returned if no conjunct can be looked up in one.
+         */
+        static IndexConjunct getPolymorphicConjunct(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const Condition& condition);
+
+        static IndexConjunct getPolymorphicConjunct(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const MultiCondition& conditions);
+
+        // the records of the class and its subclasses in the key range of a polymorphic conjunct, by record id
+        static std::vector<RecordDescriptor> getPolymorphicRecord(const Transaction *txn,
+            const IndexConjunct& conjunct);
+
+        /**
+         * Rewrite the index entries of a record which is updated from the existing record to the new one.
+         * Only the entries of the properties whose values are changed, and of the composite indexes over them,
+         * are removed and inserted again.
+         */
+        static void update(const Transaction *txn,
+            const RecordDescriptor& recordDescriptor,
+            const Record& existingRecord,
+            const Record& record,
+            const PropertyNameMapInfo& propertyNameMapInfo);
+
+        /**
+         * Seek the unique index on a property of a class for the value of the property in a record,
+         * returning an empty descriptor if no record has the value. The property must exist, have a value
+         * in the record and be indexed by a unique single-property index.
+         */
+        static RecordDescriptor getUniqueRecord(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyNameMapInfo,
+            const std::string& propertyName,
+            const Record& record);
+
+        /**
+         * Encode the conditions of the predicate of a partial index together with the ids of their properties,
+         * which must all exist in the class.
+         */
+        static std::string getPredicate(const PropertyNameMapInfo& propertyInfos,
+            const std::vector<const Condition*>& conditions);
+
+        /**
+         * The conditions of the predicate of a partial index, which must be a non-negated conjunction of conditions.
+         */
+        static std::vector<const Condition*> getPredicateConditions(const MultiCondition& predicate);
+
+        static bool isUsedByPredicate(const Transaction *txn, const ClassId& classId, const PropertyId& propertyId);
+
+        /**
+         * A beginWith condition or a like pattern with a literal prefix is looked up as a key range of the
+         * single-property index of its property if the collation of the index matches the case sensitivity
+         * of the condition. Otherwise, a contain, beginWith, endWith or like condition is looked up in the text
+         * index of its property if the condition is neither negated nor case insensitive and its pattern has n-grams.
+         * Other conditions are looked up in the single-property index if its collation matches the case
+         * sensitivity of the condition, unless it is a partial index whose predicate is not implied by the condition.
+         */
         static std::pair<bool, IndexAccessInfo> hasIndex(const Transaction *txn,
             const ClassAccessInfo& classInfo,
             const PropertyAccessInfo& propertyInfo,
             const Condition& condition);
 
+        /**
+         * A conjunction of conditions which make up the key range of one composite index is answered
+         * by that index alone, and all properties of the result are mapped to it.
+         */
         static std::pair<bool, PropertyIdMapIndex> hasIndex(const Transaction *txn,
             const ClassAccessInfo& classInfo,
             const PropertyNameMapInfo& propertyInfos,
@@ -121,72 +450,245 @@ namespace index {
             const PropertyIdMapIndex& propertyIndexInfo,
             const MultiCondition& conditions);
 
+        static IndexPlan getIndexPlan(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const MultiCondition& conditions,
+            bool searchIndexOnly = false);
+
+        /**
+         * A cursor which reads the records of a non-negated condition from the index on demand and in
+         * index order. Other conditions are read in full up front.
+         */
+        static ResultSetCursor getCursor(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const Condition& condition);
+
+        static std::vector<RecordDescriptor> getRecord(const Transaction *txn, const IndexConjunct& conjunct);
+
+        /**
+         * Intersect the records of all conjuncts of the plan. The number of index entries read
+         * is added to indexEntries if it is not null.
+         */
+        static std::vector<RecordDescriptor> getRecord(const Transaction *txn,
+            const IndexPlan& indexPlan,
+            uint64_t* indexEntries = nullptr);
+
+        static size_t getEstimateCount(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const Condition& condition);
+
+        /**
+         * A composite index covers a query if its key range answers every condition and it keeps every
+         * projected property as a key or included column. REAL key columns do not cover a projection
+         * as their keys lose the sign of a zero. No key conditions are returned if no index covers the query.
+         */
+        static IndexConjunct getCoveringConjunct(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const std::vector<const Condition*>& conditions,
+            const std::vector<std::string>& propertyNames);
+
+        static IndexConjunct getCoveringConjunct(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const MultiCondition& conditions,
+            const std::vector<std::string>& propertyNames);
+
+        // read the projected properties of the records in the key range from the index entries alone
+        static ResultSet getCoveringResultSet(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const IndexConjunct& conjunct,
+            const std::vector<std::string>& propertyNames);
+
+        /**
+         * Rebuild the indexes of a database written with an older index key encoding and
+         * record the current one. It does nothing if the database is up to date.
+         */
+        static void upgrade(const Transaction *txn);
+
+        static bool isUpgradeNeeded(const Transaction *txn);
+
     protected:
         static const std::vector<Condition::Comparator> validComparators;
 
     private:
+        friend class IndexFilterCursor;
 
-        static adapter::index::IndexRecord openIndexRecordPositive(const Transaction *txn,
-            const IndexAccessInfo& indexInfo);
-
-        static adapter::index::IndexRecord openIndexRecordNegative(const Transaction *txn,
+        static adapter::index::IndexRecord openIndexRecordNumeric(const Transaction *txn,
             const IndexAccessInfo& indexInfo);
 
         static adapter::index::IndexRecord openIndexRecordString(const Transaction *txn,
             const IndexAccessInfo& indexInfo);
 
-        template <typename T>
-        static void createNumeric(const Transaction *txn,
+        static unsigned int getIndexFlags(const IndexAccessInfo& indexInfo, bool isString);
+
+        /**
+         * Numeric values of all types are indexed in one integer-keyed DBI under keys which sort like the values.
+         * Signed integers have their sign bit flipped and doubles are mapped by the IEEE-754 total order,
+         * which keeps NaN keys below -inf or above +inf. A negative zero is indexed as zero.
+         */
+        static uint64_t getNumericKey(const PropertyType& type, const Bytes& value);
+
+        inline static uint64_t encodeKey(int64_t value)
+        {
+            return static_cast<uint64_t>(value) ^ INDEX_KEY_SIGN_BIT;
+        }
+
+        inline static uint64_t encodeKey(double value)
+        {
+            auto bits = uint64_t {};
+            value = (value == 0.0) ? 0.0 : value;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return (bits & INDEX_KEY_SIGN_BIT) ? ~bits : (bits | INDEX_KEY_SIGN_BIT);
+        }
+
+        /**
+         * A text of at most INDEX_TEXT_KEY_PREFIX_LENGTH bytes is its own key. A longer text is keyed by
+         * its prefix of that length followed by the big-endian FNV-1a hash of the whole text, which sorts
+         * it among the other keys as the text itself except against the long texts sharing its prefix.
+         * Entries under such keys are checked against the values in their records.
+         */
+        static std::string getTextKey(const std::string& value);
+
+        inline static bool isHashedTextKey(const std::string& key)
+        {
+            return key.size() > INDEX_TEXT_KEY_PREFIX_LENGTH;
+        }
+
+        // the text as it is kept in the keys of an index with the collation of the index
+        static std::string getCollatedText(const IndexAccessInfo& indexInfo, const std::string& value);
+
+        /**
+         * A text condition can be looked up in an index of the collation if it has ignoreCase exactly when
+         * the collation folds the case. A unicode case-folding index only gives the same results as the ascii
+         * folding of ignoreCase conditions if the values of the condition are ascii.
+         */
+        static bool isCollated(IndexCollation collation, const Condition& condition);
+
+        // the literal text which every match of a beginWith condition or a like pattern begins with
+        static std::string getLiteralPrefix(const Condition& condition);
+
+        // a condition with a literal prefix is looked up as the range of the keys beginning with it
+        inline static bool isPrefixLookup(const Condition& condition)
+        {
+            return !getLiteralPrefix(condition).empty();
+        }
+
+        // the keys beginning with the prefix of a beginWith condition or a like pattern such as 'abc%' are all matches
+        static bool isExactPrefix(const Condition& condition);
+
+        // the smallest key above all keys beginning with the prefix, or empty if there is none
+        static std::string getPrefixEnd(std::string prefix);
+
+        // a property has either a single-property index or a text index, whose ids are drawn from the same sequence
+        static bool isTextIndex(const Transaction *txn, const IndexAccessInfo& indexInfo);
+
+        /**
+         * Walk the keys in [prefix, prefix end) of a single-property index. The records of long texts,
+         * and of all keys of a like pattern with other literals after its prefix, are checked against the condition.
+         */
+        static std::vector<RecordDescriptor> getPrefix(const Transaction *txn,
             const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo,
-            const ClassId& superClassId,
-            const ClassType& classType,
-            T (*valueRetrieve)(const Bytes&))
-        {
-            auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, indexInfo.classId, superClassId);
-            require(!propertyIdMapInfo.empty());
-            auto indexAccess = openIndexRecordPositive(txn, indexInfo);
-            auto dataRecord = DataRecord(txn->_txnBase, indexInfo.classId, classType);
-            std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
-                [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
-                    auto const record = RecordParser::parseRawData(
-                        result, propertyIdMapInfo, classType == ClassType::EDGE, txn->_txnCtx->isVersionEnabled());
-                    auto bytesValue = record.get(propertyInfo.name);
-                    if (!bytesValue.empty()) {
-                        auto indexRecord = Blob(sizeof(PositionId)).append(&positionId, sizeof(PositionId));
-                        indexAccess.create(valueRetrieve(bytesValue), indexRecord);
-                    }
-                };
-            dataRecord.resultSetIter(callback);
+            const Condition& condition);
+
+        static size_t getCountPrefix(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const Condition& condition);
+
+        static size_t getEstimatePrefix(const Transaction *txn,
+            const IndexAccessInfo& indexInfo,
+            const Condition& condition);
+
+        // keep the descriptors of the records whose text values, in the collation of the index, are accepted by the predicate
+        static void filterByText(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            std::vector<RecordDescriptor>& recordDescriptors,
+            const std::function<bool(const Bytes&)>& predicate);
+
+        /**
+         * Walk a text index between bounds which may be longer than INDEX_TEXT_KEY_PREFIX_LENGTH.
+         * The keys sharing the prefix of a long bound are checked against their records while the keys
+         * in between are taken as they are.
+         */
+        static std::vector<RecordDescriptor> getTextRange(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const std::string* lower,
+            const std::string* upper,
+            const std::pair<bool, bool>& isIncludeBound);
+
+        inline static bool isTextPattern(const Condition& condition)
+        {
+            return condition.comp == Condition::Comparator::CONTAIN
+                || condition.comp == Condition::Comparator::BEGIN_WITH
+                || condition.comp == Condition::Comparator::END_WITH
+                || condition.comp == Condition::Comparator::LIKE;
         }
 
-        template <typename T>
-        static void createSignedNumeric(const Transaction *txn,
+        // an IN-list is looked up as point seeks rather than as a key range
+        inline static bool isInList(const Condition& condition)
+        {
+            return condition.comp == Condition::Comparator::IN && !condition.valueSet.empty();
+        }
+
+        // the distinct n-grams of a text in ascending order
+        static std::vector<std::string> getTextGrams(const std::string& value);
+
+        // the distinct n-grams which every text matching a pattern condition contains
+        static std::vector<std::string> getPatternGrams(const Condition& condition);
+
+        /**
+         * The posting list of an n-gram holds the position ids of its records as big-endian duplicates,
+         * which lmdb sorts in the order of the ids.
+         */
+        inline static PositionId encodePosting(const PositionId& positionId)
+        {
+            auto bytes = std::array<unsigned char, sizeof(PositionId)> {};
+            for (auto i = size_t { 0 }; i < sizeof(PositionId); ++i) {
+                bytes[i] = static_cast<unsigned char>(positionId >> (8 * (sizeof(PositionId) - 1 - i)));
+            }
+            auto posting = PositionId {};
+            std::memcpy(&posting, bytes.data(), sizeof(PositionId));
+            return posting;
+        }
+
+        inline static PositionId decodePosting(const PositionId& posting)
+        {
+            auto bytes = std::array<unsigned char, sizeof(PositionId)> {};
+            std::memcpy(bytes.data(), &posting, sizeof(PositionId));
+            auto positionId = PositionId {};
+            for (auto byte : bytes) {
+                positionId = static_cast<PositionId>(positionId << 8 | byte);
+            }
+            return positionId;
+        }
+
+        /**
+         * Intersect the posting lists of the n-grams of a pattern condition by leapfrogging over them
+         * from the shortest one and keep the candidates whose values match the condition.
+         */
+        static std::vector<RecordDescriptor> getTextIndexRecord(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo,
+            const Condition& condition);
+
+        // the length of the shortest posting list of the n-grams of a pattern condition
+        static size_t getTextIndexEstimate(const Transaction *txn,
+            const IndexAccessInfo& indexInfo,
+            const Condition& condition);
+
+        static void createNumeric(const Transaction *txn,
             const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo,
             const ClassId& superClassId,
-            const ClassType& classType,
-            T (*valueRetrieve)(const Bytes&))
-        {
-            auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, indexInfo.classId, superClassId);
-            require(!propertyIdMapInfo.empty());
-            auto indexPositiveAccess = openIndexRecordPositive(txn, indexInfo);
-            auto indexNegativeAccess = openIndexRecordNegative(txn, indexInfo);
-            auto dataRecord = DataRecord(txn->_txnBase, indexInfo.classId, classType);
-            std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
-                [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
-                    auto const record = RecordParser::parseRawData(
-                        result, propertyIdMapInfo, classType == ClassType::EDGE, txn->_txnCtx->isVersionEnabled());
-                    auto bytesValue = record.get(propertyInfo.name);
-                    if (!bytesValue.empty()) {
-                        auto indexRecord = Blob(sizeof(PositionId)).append(&positionId, sizeof(PositionId));
-                        auto value = valueRetrieve(bytesValue);
-                        (value >= 0) ? indexPositiveAccess.create(value, indexRecord)
-                                     : indexNegativeAccess.create(value, indexRecord);
-                    }
-                };
-            dataRecord.resultSetIter(callback);
-        }
+            const ClassType& classType);
 
         static void createString(const Transaction *txn,
             const PropertyAccessInfo& propertyInfo,
@@ -194,13 +696,178 @@ namespace index {
             const ClassId& superClassId,
             const ClassType& classType);
 
+        // write the sorted entries of a new index with appends, so that its pages are filled in order
+        template <typename K, typename V>
+        static void appendIndexRecords(adapter::index::IndexRecord& indexAccess, IndexEntrySorter<K, V>& sorter)
+        {
+            sorter.forEach([&](const K& key, const V& value, bool isSameKey) {
+                indexAccess.append(key, getIndexValue(value), isSameKey);
+            });
+        }
+
+        static Blob getIndexValue(const PositionId& positionId)
+        {
+            return Blob(sizeof(PositionId)).append(&positionId, sizeof(PositionId));
+        }
+
+        static Blob getIndexValue(const std::string& value)
+        {
+            return Blob(reinterpret_cast<const Blob::Byte*>(value.data()), value.size());
+        }
+
+        /**
+         * Composite index keys concatenate one component per column, so that their memcmp order is the
+         * order of the value tuples. A missing value is 0x00. Any other value is 0x01 followed by the
+         * big-endian numeric key or by the text key, as getTextKey gives it, with 0x00 escaped as 0x00 0xff
+         * and terminated by 0x00 0x00.
+         * Records without a value in the first column are not indexed and an empty string is returned.
+         * A unique key which has missing values is suffixed with the position id, as missing values never
+         * conflict with each other.
+         */
+        static std::string getCompositeKey(const IndexAccessInfo& indexInfo,
+            const std::vector<PropertyAccessInfo>& propertyInfos,
+            const Record& record,
+            const PositionId& positionId);
+
+        static void appendKeyComponent(std::string& key, const PropertyType& type, const Bytes& value);
+
+        static void appendEscapedText(std::string& key, const std::string& text);
+
+        // the key of a value in a polymorphic index, or an empty string if the value is missing
+        static std::string getPolymorphicKey(const PropertyType& type, const Bytes& value);
+
+        inline static std::string getPolymorphicValue(const RecordId& recordId)
+        {
+            auto value = std::string {};
+            for (auto shift = 8; shift >= 0; shift -= 8) {
+                value.push_back(static_cast<char>((recordId.first >> shift) & 0xff));
+            }
+            for (auto shift = 24; shift >= 0; shift -= 8) {
+                value.push_back(static_cast<char>((recordId.second >> shift) & 0xff));
+            }
+            return value;
+        }
+
+        inline static RecordId parsePolymorphicValue(const std::string& value)
+        {
+            auto bytes = reinterpret_cast<const unsigned char*>(value.data());
+            auto classId = static_cast<ClassId>(bytes[0] << 8 | bytes[1]);
+            auto positionId = PositionId { 0 };
+            for (auto i = size_t { 2 }; i < sizeof(ClassId) + sizeof(PositionId); ++i) {
+                positionId = static_cast<PositionId>(positionId << 8 | bytes[i]);
+            }
+            return RecordId { classId, positionId };
+        }
+
+        /**
+         * The value of a composite index entry is the position id followed by the values of the included
+         * properties, each one as {size<uint32>}{raw value} where a missing value has no bytes.
+         */
+        static std::string getCompositeValue(const IndexAccessInfo& indexInfo,
+            const std::vector<PropertyAccessInfo>& propertyInfos,
+            const Record& record,
+            const PositionId& positionId);
+
+        // read the key component at the offset back into the value it was made of, or no bytes if missing;
+        // a long text comes back as its prefix and hash
+        static Bytes retrieveKeyComponent(const std::string& key, size_t& offset, const PropertyType& type);
+
+        /**
+         * Match the top-level conjuncts against the columns of a composite index: equalities on a prefix
+         * of the columns, optionally followed by a range on the next one. No key conditions are returned
+         * if the first column is not constrained.
+         */
+        static IndexConjunct getCompositeConjunct(const PropertyNameMapInfo& propertyInfos,
+            const IndexAccessInfo& indexInfo,
+            const std::vector<const Condition*>& conditions);
+
+        /**
+         * Compute the keys between which the entries of a composite conjunct lie. It returns false if a key
+         * condition is on a text longer than INDEX_TEXT_KEY_PREFIX_LENGTH, in which case the entries may also
+         * hold records which do not satisfy the key conditions and have to be checked against them.
+         */
+        static bool getCompositeKeyRange(const IndexConjunct& conjunct,
+            std::string& lowerKey,
+            std::string& upperKey,
+            std::pair<bool, bool>& isIncludeBound);
+
+        // whether the values of a raw record satisfy every key condition of a composite conjunct
+        static bool isInKeyRange(const IndexConjunct& conjunct,
+            const storage_engine::lmdb::Result& result,
+            const ClassType& classType,
+            bool isVersionEnabled);
+
+        static void filterByKeyConditions(const Transaction *txn,
+            const IndexConjunct& conjunct,
+            std::vector<RecordDescriptor>& recordDescriptors);
+
+        static std::vector<RecordDescriptor> getCompositeRecord(const Transaction *txn, const IndexConjunct& conjunct);
+
+        static size_t getCountCompositeRecord(const Transaction *txn, const IndexConjunct& conjunct);
+
+        // the number of entries of a composite or polymorphic index between two keys
+        static size_t getCountKeyRange(const Transaction *txn,
+            const IndexAccessInfo& indexInfo,
+            const std::string& lowerKey,
+            const std::string& upperKey,
+            const std::pair<bool, bool>& isIncludeBound);
+
+        /**
+         * Collect the conditions which must all hold for a result. It returns false if the expression
+         * is anything else than a non-negated conjunction of conditions.
+         */
+        static bool getConjunctConditions(const std::shared_ptr<MultiCondition::ExprNode>& exprNode,
+            std::vector<const Condition*>& conditions);
+
+        /**
+         * Whether a condition of the expression is negated by the AND and OR nodes above it. Such a condition
+         * would be looked up as the complement of its index, which misses the records without the property.
+         */
+        static bool hasNegatedCondition(const std::shared_ptr<MultiCondition::ExprNode>& exprNode,
+            bool isParentNegative = false);
+
+        static bool isIndexable(const PropertyAccessInfo& propertyInfo,
+            const Condition& condition,
+            IndexCollation collation = IndexCollation::BINARY);
+
+        /**
+         * A partial index can only be used for a condition if every condition of its predicate
+         * is the same as one of the given conditions which hold for every result.
+         */
+        static std::pair<bool, IndexAccessInfo> hasIndex(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyAccessInfo& propertyInfo,
+            const Condition& condition,
+            const PropertyNameMapInfo& propertyInfos,
+            const std::vector<const Condition*>& conjunctConditions);
+
+        static std::vector<std::pair<PropertyId, Condition>> parsePredicate(const std::string& predicate);
+
+        static std::vector<std::pair<PropertyAccessInfo, Condition>> getPredicateConditions(
+            const IndexAccessInfo& indexInfo,
+            const PropertyNameMapInfo& propertyInfos);
+
+        static bool isInPredicate(const std::vector<std::pair<PropertyAccessInfo, Condition>>& predicateConditions,
+            const Record& record);
+
+        static bool isPredicateImplied(const IndexAccessInfo& indexInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const std::vector<const Condition*>& conditions);
+
+        static bool isSameCondition(const Condition& lhs, const Condition& rhs);
+
+        static void getBounds(const Condition& condition,
+            const Bytes*& lowerBound,
+            const Bytes*& upperBound,
+            std::pair<bool, bool>& isIncludeBound);
+
         template <typename T>
         static void insert(const Transaction *txn,
             const IndexAccessInfo& indexInfo,
             PositionId positionId,
             const T& value)
         {
-            auto indexAccess = openIndexRecordPositive(txn, indexInfo);
+            auto indexAccess = openIndexRecordNumeric(txn, indexInfo);
             auto indexRecord = Blob(sizeof(PositionId)).append(&positionId, sizeof(PositionId));
             indexAccess.create(value, indexRecord);
         }
@@ -210,22 +877,6 @@ namespace index {
             PositionId positionId,
             const std::string& value);
 
-        template <typename T>
-        static void insertSignedNumeric(const Transaction *txn,
-            const IndexAccessInfo& indexInfo,
-            PositionId positionId,
-            const T& value)
-        {
-            auto indexRecord = Blob(sizeof(PositionId)).append(&positionId, sizeof(PositionId));
-            if (value >= 0) {
-                auto indexPositiveAccess = openIndexRecordPositive(txn, indexInfo);
-                indexPositiveAccess.create(value, indexRecord);
-            } else {
-                auto indexNegativeAccess = openIndexRecordNegative(txn, indexInfo);
-                indexNegativeAccess.create(value, indexRecord);
-            }
-        }
-
         template <typename T>
         static void removeByCursorNumeric(const storage_engine::lmdb::Cursor& cursor,
             PositionId positionId,
@@ -253,7 +904,7 @@ namespace index {
             PositionId positionId,
             const T& value)
         {
-            auto indexAccessCursor = openIndexRecordPositive(txn, indexInfo).getCursor();
+            auto indexAccessCursor = openIndexRecordNumeric(txn, indexInfo).getCursor();
             removeByCursorNumeric(indexAccessCursor, positionId, value);
         }
 
@@ -262,19 +913,6 @@ namespace index {
             PositionId positionId,
             const std::string& value);
 
-        template <typename T>
-        static void removeByCursorWithSignNumeric(const Transaction *txn,
-            const IndexAccessInfo& indexInfo,
-            const PositionId& posId,
-            const T& value)
-        {
-            auto indexPositiveAccessCursor = openIndexRecordPositive(txn, indexInfo).getCursor();
-            auto indexNegativeAccessCursor = openIndexRecordNegative(txn, indexInfo).getCursor();
-            (value < 0) ?
-                removeByCursorNumeric(indexNegativeAccessCursor, posId, value) :
-                removeByCursorNumeric(indexPositiveAccessCursor, posId, value);
-        }
-
         inline static void sortByRdesc(std::vector<RecordDescriptor>& recordDescriptors)
         {
             std::sort(
@@ -282,8 +920,35 @@ namespace index {
                 [](const RecordDescriptor& lhs, const RecordDescriptor& rhs) noexcept {
                     return lhs.rid < rhs.rid;
                 });
+            // ranges of a negated condition overlap when its lower bound is above its upper bound
+            recordDescriptors.erase(
+                std::unique(recordDescriptors.begin(), recordDescriptors.end(),
+                    [](const RecordDescriptor& lhs, const RecordDescriptor& rhs) noexcept {
+                        return lhs.rid == rhs.rid;
+                    }),
+                recordDescriptors.end());
         };
 
+        inline static PositionBitmap getPositionBitmap(const std::vector<RecordDescriptor>& recordDescriptors)
+        {
+            auto positionBitmap = PositionBitmap {};
+            for (const auto& recordDescriptor : recordDescriptors) {
+                positionBitmap.add(recordDescriptor.rid.second);
+            }
+            return positionBitmap;
+        }
+
+        inline static std::vector<RecordDescriptor> getRecordDescriptors(const ClassId& classId,
+            const PositionBitmap& positionBitmap)
+        {
+            auto recordDescriptors = std::vector<RecordDescriptor> {};
+            recordDescriptors.reserve(positionBitmap.size());
+            positionBitmap.forEach([&](PositionId positionId) {
+                recordDescriptors.emplace_back(RecordDescriptor { classId, positionId });
+            });
+            return recordDescriptors;
+        }
+
         inline static bool isValidComparator(const Condition& condition)
         {
             return std::find(validComparators.cbegin(),
@@ -291,183 +956,104 @@ namespace index {
                 condition.comp) != validComparators.cend();
         }
 
-        static std::vector<RecordDescriptor> getRecordFromMultiCondition(const Transaction *txn,
+        /**
+         * The records of the branches are combined as bitmaps of their position ids. Negations are pushed
+         * down to the conditions, which look up the complements of their ranges, instead of being taken
+         * against every record of the class.
+         */
+        static PositionBitmap getRecordFromMultiCondition(const Transaction *txn,
             const PropertyNameMapInfo& propertyInfos,
             const PropertyIdMapIndex& propertyIndexInfo,
             const MultiCondition::CompositeNode* compositeNode,
             bool isParentNegative);
 
-        static std::vector<RecordDescriptor> getMultiConditionResult(const Transaction *txn,
+        static PositionBitmap getMultiConditionResult(const Transaction *txn,
             const PropertyNameMapInfo& propertyInfos,
             const PropertyIdMapIndex& propertyIndexInfo,
             const std::shared_ptr<MultiCondition::ExprNode>& exprNode,
             bool isNegative);
 
-        static std::vector<RecordDescriptor> getLessOrEqual(const Transaction *txn,
+        static std::vector<RecordDescriptor> getEqual(const Transaction *txn,
             const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo,
             const Bytes& value);
 
-        static std::vector<RecordDescriptor> getLessThan(const Transaction *txn,
+        /**
+         * Walk the index over the values between the bounds. A null bound means that the range is
+         * unbounded on that side. NaN values of a REAL index are never in range.
+         */
+        static std::vector<RecordDescriptor> getRange(const Transaction *txn,
             const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo,
-            const Bytes& value);
+            const Bytes* lowerBound,
+            const Bytes* upperBound,
+            const std::pair<bool, bool>& isIncludeBound);
 
-        static std::vector<RecordDescriptor> getEqual(const Transaction *txn,
+        static size_t getCountRange(const Transaction *txn,
             const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo,
-            const Bytes& value);
+            const Bytes* lowerBound,
+            const Bytes* upperBound,
+            const std::pair<bool, bool>& isIncludeBound);
 
-        static std::vector<RecordDescriptor> getGreaterOrEqual(const Transaction *txn,
-            const PropertyAccessInfo& propertyInfo,
-            const IndexAccessInfo& indexInfo,
-            const Bytes& value);
+        static std::vector<RecordDescriptor> getNotANumber(const Transaction *txn,
+            const IndexAccessInfo& indexInfo);
 
-        static std::vector<RecordDescriptor> getGreaterThan(const Transaction *txn,
+        /**
+         * Look the values of an IN-list up on one cursor. The distinct keys are sought in ascending order,
+         * or the index is walked once from the first to the last of them when the list is dense.
+         * The complement of a list is a walk over the whole index which skips the keys of the list.
+         */
+        static std::vector<RecordDescriptor> getIn(const Transaction *txn,
             const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo,
-            const Bytes& value);
+            const std::vector<Bytes>& values,
+            bool isNegative);
 
-        static std::vector<RecordDescriptor> getBetween(const Transaction *txn,
+        static size_t getCountIn(const Transaction *txn,
             const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo,
-            const Bytes& lowerBound,
-            const Bytes& upperBound,
-            const std::pair<bool, bool>& isIncludeBound);
+            const std::vector<Bytes>& values);
 
-        static std::vector<RecordDescriptor> getLessCommon(const Transaction *txn,
-            const PropertyAccessInfo& propertyInfo,
-            const IndexAccessInfo& indexInfo,
-            const Bytes& value,
-            bool isEqual);
+        // the distinct numeric keys of the values in ascending order, without NaN which equals nothing
+        static std::vector<uint64_t> getNumericKeys(const PropertyType& type, const std::vector<Bytes>& values);
 
-        static std::vector<RecordDescriptor> getGreaterCommon(const Transaction *txn,
+        static bool isDenseInList(const Transaction *txn,
             const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo,
-            const Bytes& value,
-            bool isEqual);
+            const std::vector<uint64_t>& keys);
 
-        template <typename T>
-        static std::vector<RecordDescriptor> getLessNumeric(const Transaction *txn,
-            const T& value,
+        static bool isDenseInList(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo,
-            bool includeEqual = false)
-        {
-            if (value < 0) {
-                auto indexAccessCursor = openIndexRecordNegative(txn, indexInfo).getCursor();
-                return backwardSearchIndex(indexAccessCursor, indexInfo.classId, value, false, includeEqual);
-            } else {
-                auto indexPositiveAccessCursor = openIndexRecordPositive(txn, indexInfo).getCursor();
-                auto indexNegativeAccessCursor = openIndexRecordNegative(txn, indexInfo).getCursor();
-                auto positiveResult = backwardSearchIndex(
-                    indexPositiveAccessCursor, indexInfo.classId, value, true, includeEqual);
-                auto negativeResult = fullScanIndex(indexNegativeAccessCursor, indexInfo.classId);
-                positiveResult.insert(positiveResult.end(), negativeResult.cbegin(), negativeResult.cend());
-                return positiveResult;
-            }
-        };
+            const std::vector<std::string>& keys);
 
-        template <typename T>
-        static std::vector<RecordDescriptor> getEqualNumeric(const Transaction *txn,
-            const T& value,
-            const IndexAccessInfo& indexInfo)
-        {
-            auto result = std::vector<RecordDescriptor> {};
-            auto indexAccess = (value < 0) ?
-                openIndexRecordNegative(txn, indexInfo) : openIndexRecordPositive(txn, indexInfo);
-            return exactMatchIndex(indexAccess.getCursor(), indexInfo.classId, value, result);
-        };
+        static void getIndexConjuncts(const Transaction *txn,
+            const ClassAccessInfo& classInfo,
+            const PropertyNameMapInfo& propertyInfos,
+            const std::shared_ptr<MultiCondition::ExprNode>& exprNode,
+            std::vector<IndexConjunct>& conjuncts);
 
-        template <typename T>
-        static std::vector<RecordDescriptor> getGreaterNumeric(const Transaction *txn,
-            const T& value,
+        static size_t getCountEqual(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
             const IndexAccessInfo& indexInfo,
-            bool includeEqual = false)
-        {
-            if (value < 0) {
-                auto indexPositiveAccessCursor = openIndexRecordPositive(txn, indexInfo).getCursor();
-                auto indexNegativeAccessCursor = openIndexRecordNegative(txn, indexInfo).getCursor();
-                auto positiveResult = fullScanIndex(indexPositiveAccessCursor, indexInfo.classId);
-                auto negativeResult = forwardSearchIndex(
-                    indexNegativeAccessCursor, indexInfo.classId, value, false, includeEqual);
-                positiveResult.insert(positiveResult.end(), negativeResult.cbegin(), negativeResult.cend());
-                return positiveResult;
-            } else {
-                auto indexAccessCursor = openIndexRecordPositive(txn, indexInfo).getCursor();
-                return forwardSearchIndex(indexAccessCursor, indexInfo.classId, value, true, includeEqual);
-            }
-        };
+            const Bytes& value);
 
-        template <typename T>
-        static std::vector<RecordDescriptor> getBetweenNumeric(const Transaction *txn,
-            const T& lowerBound,
-            const T& upperBound,
-            const IndexAccessInfo& indexInfo,
-            const std::pair<bool, bool>& isIncludeBound)
-        {
-            if (lowerBound < 0 && upperBound < 0) {
-                auto indexAccessCursor = openIndexRecordNegative(txn, indexInfo).getCursor();
-                return betweenSearchIndex(
-                    indexAccessCursor, indexInfo.classId, lowerBound, upperBound, false, isIncludeBound);
-            } else if (lowerBound < 0 && upperBound >= 0) {
-                auto indexPositiveAccessCursor = openIndexRecordPositive(txn, indexInfo).getCursor();
-                auto indexNegativeAccessCursor = openIndexRecordNegative(txn, indexInfo).getCursor();
-                auto positiveResult = betweenSearchIndex(indexPositiveAccessCursor, indexInfo.classId,
-                    static_cast<T>(0), upperBound,
-                    true, { true, isIncludeBound.second });
-                auto negativeResult = betweenSearchIndex(indexNegativeAccessCursor, indexInfo.classId,
-                    lowerBound, static_cast<T>(0),
-                    false, { isIncludeBound.first, true });
-                positiveResult.insert(positiveResult.end(), negativeResult.cbegin(), negativeResult.cend());
-                return positiveResult;
-            } else {
-                auto indexAccessCursor = openIndexRecordPositive(txn, indexInfo).getCursor();
-                return betweenSearchIndex(indexAccessCursor,
-                    indexInfo.classId,
-                    lowerBound,
-                    upperBound,
-                    true,
-                    isIncludeBound);
-            }
-        };
+        static size_t getCountIndexEntry(const Transaction *txn,
+            const PropertyAccessInfo& propertyInfo,
+            const IndexAccessInfo& indexInfo);
 
         template <typename T>
-        static std::vector<RecordDescriptor> backwardSearchIndex(const storage_engine::lmdb::Cursor& cursorHandler,
-            const ClassId& classId,
+        static size_t countExactMatchIndex(const storage_engine::lmdb::Cursor& cursorHandler,
             const T& value,
-            bool positive,
-            bool isInclude = false)
+            bool isUnique)
         {
-            auto result = std::vector<RecordDescriptor> {};
-            if (!std::is_same<T, double>::value || positive) {
-                if (isInclude) {
-                    exactMatchIndex(cursorHandler, classId, value, result);
-                }
-                cursorHandler.findRange(value);
-                for (auto keyValue = cursorHandler.getPrev();
-                     !keyValue.empty();
-                     keyValue = cursorHandler.getPrev()) {
-                    auto key = keyValue.key.data.template numeric<T>();
-                    auto positionId = keyValue.val.data.template numeric<PositionId>();
-                    result.emplace_back(RecordDescriptor { classId, positionId });
-                }
-            } else {
-                for (auto keyValue = cursorHandler.findRange(value);
-                     !keyValue.empty();
-                     keyValue = cursorHandler.getNext()) {
-                    if (!isInclude) {
-                        auto key = keyValue.key.data.template numeric<T>();
-                        if (key == value)
-                            continue;
-                        else
-                            isInclude = true;
-                    }
-                    auto positionId = keyValue.val.data.template numeric<PositionId>();
-                    result.emplace_back(RecordDescriptor { classId, positionId });
-                }
+            auto keyValue = cursorHandler.find(value);
+            if (keyValue.empty()) {
+                return 0;
             }
-            return result;
-        };
+            return (isUnique) ? 1 : cursorHandler.count();
+        }
 
         template <typename T>
         static std::vector<RecordDescriptor> exactMatchIndex(const storage_engine::lmdb::Cursor& cursorHandler,
@@ -494,95 +1080,155 @@ namespace index {
             const std::string& value,
             std::vector<RecordDescriptor>& result);
 
-        static std::vector<RecordDescriptor> fullScanIndex(const storage_engine::lmdb::Cursor& cursorHandler,
-            const ClassId& classId);
+        inline static uint64_t getIndexKey(const storage_engine::lmdb::CursorResult& keyValue, const uint64_t*)
+        {
+            return keyValue.key.data.numeric<uint64_t>();
+        }
+
+        inline static std::string getIndexKey(const storage_engine::lmdb::CursorResult& keyValue, const std::string*)
+        {
+            return keyValue.key.data.string();
+        }
 
+        /**
+         * Collect the entries of the sorted distinct keys, seeking each of them with the same cursor,
+         * or merging the keys with one walk from the first key when they are dense. A negative walk
+         * starts at the index beginning and collects the entries of every other key instead.
+         */
         template <typename T>
-        static std::vector<RecordDescriptor> forwardSearchIndex(const storage_engine::lmdb::Cursor& cursorHandler,
+        static void inListSearchIndex(const storage_engine::lmdb::Cursor& cursorHandler,
             const ClassId& classId,
-            const T& value,
-            bool positive,
-            bool isInclude = false)
+            const std::vector<T>& keys,
+            bool isDense,
+            bool isNegative,
+            std::vector<RecordDescriptor>& result)
         {
-            auto result = std::vector<RecordDescriptor> {};
-            if (!std::is_same<T, double>::value || positive) {
-                for (auto keyValue = cursorHandler.findRange(value);
-                     !keyValue.empty();
-                     keyValue = cursorHandler.getNext()) {
-                    if (!isInclude) {
-                        auto key = keyValue.key.data.template numeric<T>();
-                        if (key == value)
-                            continue;
-                        else
-                            isInclude = true;
+            if (keys.empty() && !isNegative) {
+                return;
+            }
+            if (!isDense && !isNegative) {
+                for (const auto& key : keys) {
+                    for (auto keyValue = cursorHandler.find(key);
+                         !keyValue.empty() && getIndexKey(keyValue, &key) == key;
+                         keyValue = cursorHandler.getNext()) {
+                        auto positionId = keyValue.val.data.template numeric<PositionId>();
+                        result.emplace_back(RecordDescriptor { classId, positionId });
                     }
-                    auto positionId = keyValue.val.data.template numeric<PositionId>();
-                    result.emplace_back(RecordDescriptor { classId, positionId });
                 }
-            } else {
-                if (isInclude) {
-                    exactMatchIndex(cursorHandler, classId, value, result);
+                return;
+            }
+            auto nextKey = keys.cbegin();
+            for (auto keyValue = (isNegative) ? cursorHandler.getNext() : cursorHandler.findRange(keys.front());
+                 !keyValue.empty();
+                 keyValue = cursorHandler.getNext()) {
+                auto key = getIndexKey(keyValue, static_cast<const T*>(nullptr));
+                while (nextKey != keys.cend() && *nextKey < key) {
+                    ++nextKey;
                 }
-                cursorHandler.findRange(value);
-                for (auto keyValue = cursorHandler.getPrev();
-                     !keyValue.empty();
-                     keyValue = cursorHandler.getPrev()) {
+                if (nextKey == keys.cend() && !isNegative)
+                    break;
+                if ((nextKey != keys.cend() && *nextKey == key) != isNegative) {
                     auto positionId = keyValue.val.data.template numeric<PositionId>();
                     result.emplace_back(RecordDescriptor { classId, positionId });
                 }
             }
-            return result;
-        };
+        }
 
-        static std::vector<RecordDescriptor> forwardSearchIndex(const storage_engine::lmdb::Cursor& cursorHandler,
-            const ClassId& classId,
-            const std::string& value,
-            bool isInclude = false);
+        template <typename T>
+        static size_t inListCountIndex(const storage_engine::lmdb::Cursor& cursorHandler,
+            const std::vector<T>& keys,
+            bool isDense,
+            bool isUnique)
+        {
+            auto count = size_t { 0 };
+            if (keys.empty()) {
+                return count;
+            }
+            if (!isDense) {
+                for (const auto& key : keys) {
+                    count += countExactMatchIndex(cursorHandler, key, isUnique);
+                }
+                return count;
+            }
+            auto nextKey = keys.cbegin();
+            for (auto keyValue = cursorHandler.findRange(keys.front());
+                 !keyValue.empty();
+                 keyValue = cursorHandler.getNextNoDup()) {
+                auto key = getIndexKey(keyValue, static_cast<const T*>(nullptr));
+                while (nextKey != keys.cend() && *nextKey < key) {
+                    ++nextKey;
+                }
+                if (nextKey == keys.cend())
+                    break;
+                if (*nextKey == key) {
+                    count += (isUnique) ? 1 : cursorHandler.count();
+                }
+            }
+            return count;
+        }
 
+        /**
+         * Collect the entries from the lower to the upper bound. A null bound means that the walk
+         * starts or ends at the index end.
+         */
         template <typename T>
-        static std::vector<RecordDescriptor> betweenSearchIndex(const storage_engine::lmdb::Cursor& cursorHandler,
+        static std::vector<RecordDescriptor> rangeSearchIndex(const storage_engine::lmdb::Cursor& cursorHandler,
             const ClassId& classId,
-            const T& lower,
-            const T& upper,
-            bool isLowerPositive,
+            const T* lower,
+            const T* upper,
             const std::pair<bool, bool>& isIncludeBound)
         {
             auto result = std::vector<RecordDescriptor> {};
-            if (!std::is_same<T, double>::value || isLowerPositive) {
-                for (auto keyValue = cursorHandler.findRange(lower);
-                     !keyValue.empty();
-                     keyValue = cursorHandler.getNext()) {
-                    auto key = keyValue.key.data.template numeric<T>();
-                    if (!isIncludeBound.first && key == lower)
-                        continue;
-                    else if ((!isIncludeBound.second && key == upper) || key > upper)
-                        break;
-                    auto positionId = keyValue.val.data.template numeric<PositionId>();
-                    result.emplace_back(RecordDescriptor { classId, positionId });
-                }
-            } else {
-                if (isIncludeBound.first) {
-                    exactMatchIndex(cursorHandler, classId, lower, result);
-                }
-                cursorHandler.findRange(lower);
-                for (auto keyValue = cursorHandler.getPrev();
-                     !keyValue.empty();
-                     keyValue = cursorHandler.getPrev()) {
-                    auto key = keyValue.key.data.numeric<T>();
-                    if ((!isIncludeBound.second && key == upper) || key > upper)
-                        break;
-                    auto positionId = keyValue.val.data.numeric<PositionId>();
-                    result.emplace_back(RecordDescriptor { classId, positionId });
-                }
+            for (auto keyValue = (lower != nullptr) ? cursorHandler.findRange(*lower) : cursorHandler.getNext();
+                 !keyValue.empty();
+                 keyValue = cursorHandler.getNext()) {
+                auto key = keyValue.key.data.template numeric<T>();
+                if (lower != nullptr && !isIncludeBound.first && key == *lower)
+                    continue;
+                if (upper != nullptr && ((!isIncludeBound.second && key == *upper) || key > *upper))
+                    break;
+                auto positionId = keyValue.val.data.template numeric<PositionId>();
+                result.emplace_back(RecordDescriptor { classId, positionId });
             }
             return result;
         };
 
-        static std::vector<RecordDescriptor> betweenSearchIndex(const storage_engine::lmdb::Cursor& cursorHandler,
+        static std::vector<RecordDescriptor> rangeSearchIndex(const storage_engine::lmdb::Cursor& cursorHandler,
             const ClassId& classId,
-            const std::string& lower,
-            const std::string& upper,
+            const std::string* lower,
+            const std::string* upper,
             const std::pair<bool, bool>& isIncludeBound);
+
+        /**
+         * Count the entries from the lower to the upper bound one key at a time, taking the number
+         * of duplicates of each key of a non-unique index from the cursor.
+         */
+        template <typename T>
+        static size_t rangeCountIndex(const storage_engine::lmdb::Cursor& cursorHandler,
+            const T* lower,
+            const T* upper,
+            const std::pair<bool, bool>& isIncludeBound,
+            bool isUnique)
+        {
+            auto count = size_t { 0 };
+            for (auto keyValue = (lower != nullptr) ? cursorHandler.findRange(*lower) : cursorHandler.getNext();
+                 !keyValue.empty();
+                 keyValue = cursorHandler.getNextNoDup()) {
+                auto key = keyValue.key.data.template numeric<T>();
+                if (lower != nullptr && !isIncludeBound.first && key == *lower)
+                    continue;
+                if (upper != nullptr && ((!isIncludeBound.second && key == *upper) || key > *upper))
+                    break;
+                count += (isUnique) ? 1 : cursorHandler.count();
+            }
+            return count;
+        }
+
+        static size_t rangeCountIndex(const storage_engine::lmdb::Cursor& cursorHandler,
+            const std::string* lower,
+            const std::string* upper,
+            const std::pair<bool, bool>& isIncludeBound,
+            bool isUnique);
     };
 
 }
@@ -74,16 +74,33 @@ namespace index {
             put(key, blob);
         }
 
+        // the key, and the position id within the key, must be above those which are already in the index
+        template <typename K>
+        void append(const K& key, const Blob& blob, bool duplicate)
+        {
+            LMDBKeyValAccess::append(key, blob, duplicate && !_unique);
+        }
+
         void destroy()
         {
             drop(true);
         }
 
+        void clear()
+        {
+            drop(false);
+        }
+
         storage_engine::lmdb::Cursor getCursor() const
         {
             return cursor();
         }
 
+        size_t count() const
+        {
+            return size();
+        }
+
     private:
         bool _positive;
         bool _numeric;
@@ -0,0 +1,230 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "nogdb/nogdb_errors.h"
+#include "nogdb/nogdb_types.h"
+
+namespace nogdb {
+namespace index {
+
+    /**
+     * Collects the (key, value) entries of an index which is being built and replays them
+     * in the order of the index database, i.e. by key and then by the raw bytes of the value
+     * as duplicates are sorted, so that they can be written with appends instead of random inserts.
+     * The value is the position id of a record, or a string which starts with the position id
+     * for the entries of a covering index. Entries beyond the memory limit are spilled into
+     * temporary files as sorted runs which are merged while the entries are replayed.
+     */
+    template <typename K, typename V = PositionId>
+    class IndexEntrySorter {
+    public:
+        using Entry = std::pair<K, V>;
+
+        explicit IndexEntrySorter(size_t memoryLimit)
+            : _memoryLimit { memoryLimit }
+        {
+        }
+
+        ~IndexEntrySorter() noexcept
+        {
+            for (auto run : _runs) {
+                std::fclose(run);
+            }
+        }
+
+        IndexEntrySorter(const IndexEntrySorter&) = delete;
+
+        IndexEntrySorter& operator=(const IndexEntrySorter&) = delete;
+
+        void add(const K& key, const V& value)
+        {
+            _memoryUsage += sizeof(Entry) + getHeapSize(key) + getHeapSize(value);
+            _entries.emplace_back(key, value);
+            if (_memoryUsage >= _memoryLimit) {
+                spill();
+            }
+        }
+
+        size_t getNumRuns() const
+        {
+            return _runs.size();
+        }
+
+        /**
+         * Call the function with every entry in order together with whether its key is the same
+         * as the key of the entry before it.
+         */
+        void forEach(const std::function<void(const K&, const V&, bool)>& function)
+        {
+            if (_runs.empty()) {
+                std::sort(_entries.begin(), _entries.end(), less);
+                for (auto it = _entries.cbegin(); it != _entries.cend(); ++it) {
+                    function(it->first, it->second, it != _entries.cbegin() && std::prev(it)->first == it->first);
+                }
+                return;
+            }
+            spill();
+            auto heads = std::vector<Entry>(_runs.size());
+            auto greater = [&](size_t lhs, size_t rhs) { return less(heads[rhs], heads[lhs]); };
+            auto queue = std::priority_queue<size_t, std::vector<size_t>, decltype(greater)> { greater };
+            for (auto i = size_t { 0 }; i < _runs.size(); ++i) {
+                std::rewind(_runs[i]);
+                if (read(_runs[i], heads[i])) {
+                    queue.push(i);
+                }
+            }
+            auto previousKey = K {};
+            auto isFirst = true;
+            while (!queue.empty()) {
+                auto i = queue.top();
+                queue.pop();
+                function(heads[i].first, heads[i].second, !isFirst && previousKey == heads[i].first);
+                previousKey = heads[i].first;
+                isFirst = false;
+                if (read(_runs[i], heads[i])) {
+                    queue.push(i);
+                }
+            }
+        }
+
+    private:
+        size_t _memoryLimit;
+        size_t _memoryUsage {};
+        std::vector<Entry> _entries {};
+        std::vector<FILE*> _runs {};
+
+        static bool less(const Entry& lhs, const Entry& rhs)
+        {
+            if (lhs.first != rhs.first) {
+                return lhs.first < rhs.first;
+            }
+            return isValueLess(lhs.second, rhs.second);
+        }
+
+        static bool isValueLess(const PositionId& lhs, const PositionId& rhs)
+        {
+            return std::memcmp(&lhs, &rhs, sizeof(PositionId)) < 0;
+        }
+
+        static bool isValueLess(const std::string& lhs, const std::string& rhs)
+        {
+            return lhs < rhs;
+        }
+
+        void spill()
+        {
+            auto run = std::tmpfile();
+            if (run == nullptr) {
+                throw NOGDB_INTERNAL_ERROR(NOGDB_INTERNAL_UNKNOWN_ERROR);
+            }
+            _runs.emplace_back(run);
+            std::sort(_entries.begin(), _entries.end(), less);
+            for (const auto& entry : _entries) {
+                write(run, entry.first);
+                write(run, entry.second);
+            }
+            if (std::fflush(run) != 0 || std::ferror(run)) {
+                throw NOGDB_INTERNAL_ERROR(NOGDB_INTERNAL_UNKNOWN_ERROR);
+            }
+            _entries = std::vector<Entry> {};
+            _memoryUsage = 0;
+        }
+
+        // a run may only end between two entries, anything else is a truncated or unreadable run
+        static bool read(FILE* run, Entry& entry)
+        {
+            return read(run, entry.first, true) && read(run, entry.second, false);
+        }
+
+        template <typename T>
+        static size_t getHeapSize(const T&)
+        {
+            return 0;
+        }
+
+        static size_t getHeapSize(const std::string& field)
+        {
+            return field.size();
+        }
+
+        template <typename T>
+        static void write(FILE* run, const T& field)
+        {
+            writeBytes(run, &field, sizeof(T));
+        }
+
+        static void write(FILE* run, const std::string& field)
+        {
+            auto size = static_cast<uint32_t>(field.size());
+            writeBytes(run, &size, sizeof(uint32_t));
+            writeBytes(run, field.data(), size);
+        }
+
+        template <typename T>
+        static bool read(FILE* run, T& field, bool isEndAllowed)
+        {
+            return readBytes(run, &field, sizeof(T), isEndAllowed);
+        }
+
+        static bool read(FILE* run, std::string& field, bool isEndAllowed)
+        {
+            auto size = uint32_t {};
+            if (!readBytes(run, &size, sizeof(uint32_t), isEndAllowed)) {
+                return false;
+            }
+            field.resize(size);
+            return size == 0 || readBytes(run, &field[0], size, false);
+        }
+
+        static void writeBytes(FILE* run, const void* data, size_t size)
+        {
+            if (std::fwrite(data, 1, size, run) != size) {
+                throw NOGDB_INTERNAL_ERROR(NOGDB_INTERNAL_UNKNOWN_ERROR);
+            }
+        }
+
+        // read all the bytes, or none if the run has ended and may end there
+        static bool readBytes(FILE* run, void* data, size_t size, bool isEndAllowed)
+        {
+            auto readSize = std::fread(data, 1, size, run);
+            if (readSize == size) {
+                return true;
+            }
+            if (readSize == 0 && isEndAllowed && std::feof(run) && !std::ferror(run)) {
+                return false;
+            }
+            throw NOGDB_INTERNAL_ERROR(NOGDB_INTERNAL_UNKNOWN_ERROR);
+        }
+    };
+
+}
+}
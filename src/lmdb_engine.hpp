@@ -339,6 +339,14 @@ namespace lmdb {
             _handle = nullptr;
         }
 
+        /**
+         * The id of the snapshot a read-only transaction reads, or of the one a read-write transaction writes.
+         */
+        size_t id() const noexcept
+        {
+            return static_cast<size_t>(mdb_txn_id(_handle));
+        }
+
         void reset() noexcept
         {
             mdb_txn_reset(_handle);
@@ -578,6 +586,23 @@ namespace lmdb {
             dbPut(Key { key }, Value { val }, LMDB_PUT_FLAGS_GENERATE(append, overwrite));
         }
 
+        // put a key which is above every existing key or, on a MDB_DUPSORT database,
+        // a value above every existing value of the last key
+        template <typename K>
+        void append(const K& key,
+            const Blob& blob,
+            bool duplicate = false)
+        {
+            dbPut(Key { &key, sizeof(K) }, Value { blob.bytes(), blob.size() }, (duplicate) ? MDB_APPENDDUP : MDB_APPEND);
+        }
+
+        void append(const std::string& key,
+            const Blob& blob,
+            bool duplicate = false)
+        {
+            dbPut(Key { key }, Value { blob.bytes(), blob.size() }, (duplicate) ? MDB_APPENDDUP : MDB_APPEND);
+        }
+
         template <typename K>
         void del(const K& key)
         {
@@ -765,6 +790,16 @@ namespace lmdb {
             }
         }
 
+        // number of duplicates at the current position of a cursor on a MDB_DUPSORT database
+        size_t count() const
+        {
+            auto count = mdb_size_t { 0 };
+            if (auto error = mdb_cursor_count(_handle, &count)) {
+                throw NOGDB_STORAGE_ERROR(error);
+            }
+            return static_cast<size_t>(count);
+        }
+
         CursorResult getNext() const
         {
             return get(MDB_NEXT);
@@ -775,6 +810,11 @@ namespace lmdb {
             return get(MDB_NEXT_DUP);
         }
 
+        CursorResult getNextNoDup() const
+        {
+            return get(MDB_NEXT_NODUP);
+        }
+
         CursorResult getPrev() const
         {
             return get(MDB_PREV);
@@ -797,6 +837,19 @@ namespace lmdb {
             return dbFind(key, MDB_SET_RANGE);
         }
 
+        // position at the first duplicate of the key which is not below the value on a MDB_DUPSORT database
+        template <typename K, typename V>
+        CursorResult findRange(const K& key, const V& value) const
+        {
+            return dbFindDup(Key { &key, sizeof(K) }, value);
+        }
+
+        template <typename V>
+        CursorResult findRange(const std::string& key, const V& value) const
+        {
+            return dbFindDup(Key { key }, value);
+        }
+
     protected:
         CursorHandler* _handle { nullptr };
         TransactionHandler* _txn { nullptr };
@@ -830,6 +883,22 @@ namespace lmdb {
             return result;
         }
 
+        template <typename V>
+        CursorResult dbFindDup(Key&& key, const V& value) const
+        {
+            CursorResult result {};
+            result.key.data = std::move(key);
+            result.val.data = Value { &value, sizeof(V) };
+            if (auto error = mdb_cursor_get(_handle, result.key.data, result.val.data, MDB_GET_BOTH_RANGE)) {
+                if (error != MDB_NOTFOUND) {
+                    throw NOGDB_STORAGE_ERROR(error);
+                }
+                result.key.empty = error == MDB_NOTFOUND;
+                result.val.empty = result.key.empty;
+            }
+            return result;
+        }
+
         CursorResult dbFind(const std::string& key, const MDB_cursor_op op) const
         {
             CursorResult result {};
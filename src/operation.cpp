@@ -24,6 +24,7 @@
 #include "constant.hpp"
 #include "datarecord.hpp"
 #include "datarecord_adapter.hpp"
+#include "explain.hpp"
 #include "index.hpp"
 #include "index_adapter.hpp"
 #include "lmdb_engine.hpp"
@@ -40,9 +41,105 @@ using namespace adapter::schema;
 using namespace schema;
 using namespace datarecord;
 using namespace index;
+using adapter::relation::Direction;
 using compare::RecordCompare;
 using parser::RecordParser;
 
+namespace {
+    IndexConjunct getCoveringConjunct(const Transaction* txn,
+        const ClassAccessInfo& classInfo,
+        const PropertyNameMapInfo& propertyInfos,
+        const OperationBuilder::ConditionType& conditionType,
+        const std::shared_ptr<Condition>& condition,
+        const std::shared_ptr<MultiCondition>& multiCondition,
+        const std::vector<std::string>& projection)
+    {
+        switch (conditionType) {
+        case OperationBuilder::ConditionType::CONDITION:
+            return IndexUtils::getCoveringConjunct(
+                txn, classInfo, propertyInfos, std::vector<const Condition*> { condition.get() }, projection);
+        case OperationBuilder::ConditionType::MULTI_CONDITION:
+            return IndexUtils::getCoveringConjunct(txn, classInfo, propertyInfos, *multiCondition, projection);
+        default:
+            return IndexConjunct {};
+        }
+    }
+
+    IndexConjunct getPolymorphicConjunct(const Transaction* txn,
+        const ClassAccessInfo& classInfo,
+        const OperationBuilder::ConditionType& conditionType,
+        const std::shared_ptr<Condition>& condition,
+        const std::shared_ptr<MultiCondition>& multiCondition)
+    {
+        if (conditionType != OperationBuilder::ConditionType::CONDITION
+            && conditionType != OperationBuilder::ConditionType::MULTI_CONDITION) {
+            return IndexConjunct {};
+        }
+        auto propertyInfos = SchemaUtils::getPropertyNameMapInfo(txn, classInfo.id, classInfo.superClassId);
+        return (conditionType == OperationBuilder::ConditionType::CONDITION)
+            ? IndexUtils::getPolymorphicConjunct(txn, classInfo, propertyInfos, *condition)
+            : IndexUtils::getPolymorphicConjunct(txn, classInfo, propertyInfos, *multiCondition);
+    }
+
+    /**
+     * Fetch the records of a polymorphic index lookup from their own classes and keep those which satisfy
+     * the whole condition, as the other conjuncts may be on properties of the subclasses.
+     */
+    ResultSet getPolymorphicResultSet(const Transaction* txn,
+        const ClassAccessInfo& classInfo,
+        const IndexConjunct& conjunct,
+        const OperationBuilder::ConditionType& conditionType,
+        const std::shared_ptr<Condition>& condition,
+        const std::shared_ptr<MultiCondition>& multiCondition,
+        QueryPlan* queryPlan = nullptr)
+    {
+        auto stopwatch = explain::Stopwatch {};
+        auto recordDescriptors = IndexUtils::getPolymorphicRecord(txn, conjunct);
+        if (auto stage = explain::record(queryPlan, "POLYMORPHIC_INDEX_SCAN", classInfo.name,
+                conjunct.estimatedCount, recordDescriptors.size(), stopwatch)) {
+            stage->indexIds.emplace_back(conjunct.indexInfo.id);
+            stage->detail = conjunct.propertyInfo.name;
+            stage->indexEntries = recordDescriptors.size();
+        }
+        auto resultSet = ResultSet {};
+        // the descriptors of each class are next to each other as they are sorted by record id
+        for (auto first = recordDescriptors.cbegin(); first != recordDescriptors.cend();) {
+            auto last = std::find_if(first, recordDescriptors.cend(), [&first](const RecordDescriptor& recordDescriptor) {
+                return recordDescriptor.rid.first != first->rid.first;
+            });
+            auto currentClassInfo = SchemaUtils::getExistingClass(txn, first->rid.first);
+            auto propertyInfos =
+                SchemaUtils::getPropertyNameMapInfo(txn, currentClassInfo.id, currentClassInfo.superClassId);
+            for (auto& result : DataRecordUtils::getResultSet(
+                     txn, currentClassInfo, std::vector<RecordDescriptor>(first, last))) {
+                auto isMatched = (conditionType == OperationBuilder::ConditionType::CONDITION)
+                    ? RecordCompare::compareRecordByCondition(result.record, propertyInfos, *condition)
+                    : RecordCompare::compareRecordByMultiCondition(result.record, propertyInfos, *multiCondition);
+                if (isMatched) {
+                    resultSet.emplace_back(std::move(result));
+                }
+            }
+            first = last;
+        }
+        explain::recordRead(queryPlan, "FETCH", classInfo.name,
+            recordDescriptors.size(), resultSet.size(), recordDescriptors.size(), stopwatch);
+        return resultSet;
+    }
+
+    algorithm::PathWeight getPathWeight(const std::string& propertyName,
+        bool hasDefaultWeight,
+        double defaultWeight,
+        double (*heuristic)(const Record&, const Record&))
+    {
+        auto pathWeight = algorithm::PathWeight {};
+        pathWeight.propertyName = propertyName;
+        pathWeight.hasDefaultWeight = hasDefaultWeight;
+        pathWeight.defaultWeight = defaultWeight;
+        pathWeight.heuristic = heuristic;
+        return pathWeight;
+    }
+}
+
 const RecordDescriptor Transaction::addVertex(const std::string& className, const Record& record)
 {
     BEGIN_VALIDATION(this)
@@ -53,6 +150,56 @@ const RecordDescriptor Transaction::addVertex(const std::string& className, cons
     auto vertexClassInfo = SchemaUtils::getValidClassInfo(this, className, ClassType::VERTEX);
     auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(
         this, vertexClassInfo.id, vertexClassInfo.superClassId);
+    return insertVertex(vertexClassInfo, propertyNameMapInfo, record);
+}
+
+const RecordDescriptor Transaction::upsertVertex(const std::string& className,
+    const std::string& uniquePropertyName,
+    const Record& record)
+{
+    BEGIN_VALIDATION(this)
+        .isTxnValid()
+        .isTxnCompleted()
+        .isClassNameValid(className)
+        .isPropertyNameValid(uniquePropertyName);
+
+    auto vertexClassInfo = SchemaUtils::getValidClassInfo(this, className, ClassType::VERTEX);
+    auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(
+        this, vertexClassInfo.id, vertexClassInfo.superClassId);
+    auto recordDescriptor =
+        IndexUtils::getUniqueRecord(this, vertexClassInfo, propertyNameMapInfo, uniquePropertyName, record);
+    if (recordDescriptor == RecordDescriptor {}) {
+        return insertVertex(vertexClassInfo, propertyNameMapInfo, record);
+    }
+    updateRecord(vertexClassInfo, propertyNameMapInfo, recordDescriptor, record);
+    return recordDescriptor;
+}
+
+const RecordDescriptor Transaction::getOrCreateVertex(const std::string& className,
+    const std::string& uniquePropertyName,
+    const Record& record)
+{
+    BEGIN_VALIDATION(this)
+        .isTxnValid()
+        .isTxnCompleted()
+        .isClassNameValid(className)
+        .isPropertyNameValid(uniquePropertyName);
+
+    auto vertexClassInfo = SchemaUtils::getValidClassInfo(this, className, ClassType::VERTEX);
+    auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(
+        this, vertexClassInfo.id, vertexClassInfo.superClassId);
+    auto recordDescriptor =
+        IndexUtils::getUniqueRecord(this, vertexClassInfo, propertyNameMapInfo, uniquePropertyName, record);
+    if (recordDescriptor == RecordDescriptor {}) {
+        return insertVertex(vertexClassInfo, propertyNameMapInfo, record);
+    }
+    return recordDescriptor;
+}
+
+const RecordDescriptor Transaction::insertVertex(const ClassAccessInfo& vertexClassInfo,
+    const PropertyNameMapInfo& propertyNameMapInfo,
+    const Record& record)
+{
     auto recordBlob = RecordParser::parseRecord(record, propertyNameMapInfo);
     try {
         auto vertexDataRecord = DataRecord(_txnBase, vertexClassInfo.id, ClassType::VERTEX);
@@ -67,6 +214,13 @@ const RecordDescriptor Transaction::addVertex(const std::string& className, cons
         auto recordDescriptor = RecordDescriptor { vertexClassInfo.id, positionId };
         auto indexInfos = IndexUtils::getIndexInfos(this, recordDescriptor, record, propertyNameMapInfo);
         IndexUtils::insert(this, recordDescriptor, record, indexInfos);
+        auto compositeIndexInfos = IndexUtils::getCompositeIndexInfos(this, recordDescriptor.rid.first, propertyNameMapInfo);
+        IndexUtils::insert(this, recordDescriptor, record, compositeIndexInfos);
+        auto textIndexInfos = IndexUtils::getTextIndexInfos(this, recordDescriptor.rid.first, propertyNameMapInfo);
+        IndexUtils::insert(this, recordDescriptor, record, textIndexInfos);
+        auto polymorphicIndexInfos =
+            IndexUtils::getPolymorphicIndexInfos(this, recordDescriptor.rid.first, propertyNameMapInfo);
+        IndexUtils::insertPolymorphic(this, recordDescriptor, record, polymorphicIndexInfos);
         return recordDescriptor;
     } catch (const Error& error) {
         rollback();
@@ -106,6 +260,13 @@ const RecordDescriptor Transaction::addEdge(const std::string& className,
         _graph->addRel(recordDescriptor.rid, srcVertexRecordDescriptor.rid, dstVertexRecordDescriptor.rid);
         auto indexInfos = IndexUtils::getIndexInfos(this, recordDescriptor, record, propertyNameMapInfo);
         IndexUtils::insert(this, recordDescriptor, record, indexInfos);
+        auto compositeIndexInfos = IndexUtils::getCompositeIndexInfos(this, recordDescriptor.rid.first, propertyNameMapInfo);
+        IndexUtils::insert(this, recordDescriptor, record, compositeIndexInfos);
+        auto textIndexInfos = IndexUtils::getTextIndexInfos(this, recordDescriptor.rid.first, propertyNameMapInfo);
+        IndexUtils::insert(this, recordDescriptor, record, textIndexInfos);
+        auto polymorphicIndexInfos =
+            IndexUtils::getPolymorphicIndexInfos(this, recordDescriptor.rid.first, propertyNameMapInfo);
+        IndexUtils::insertPolymorphic(this, recordDescriptor, record, polymorphicIndexInfos);
         return recordDescriptor;
     } catch (const Error& error) {
         rollback();
@@ -120,9 +281,17 @@ void Transaction::update(const RecordDescriptor& recordDescriptor, const Record&
         .isTxnCompleted();
 
     auto classInfo = SchemaUtils::getExistingClass(this, recordDescriptor.rid.first);
+    auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(this, classInfo.id, classInfo.superClassId);
+    updateRecord(classInfo, propertyNameMapInfo, recordDescriptor, record);
+}
+
+void Transaction::updateRecord(const ClassAccessInfo& classInfo,
+    const PropertyNameMapInfo& propertyNameMapInfo,
+    const RecordDescriptor& recordDescriptor,
+    const Record& record)
+{
     auto dataRecord = DataRecord(_txnBase, classInfo.id, classInfo.type);
     auto recordResult = dataRecord.getResult(recordDescriptor.rid.second);
-    auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(this, classInfo.id, classInfo.superClassId);
     auto newRecordBlob = RecordParser::parseRecord(record, propertyNameMapInfo);
     try {
         auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(this, classInfo.id, classInfo.superClassId);
@@ -152,12 +321,7 @@ void Transaction::update(const RecordDescriptor& recordDescriptor, const Record&
                 recordResult, newRecordBlob, classInfo.type == ClassType::EDGE, false);
         }
         dataRecord.update(recordDescriptor.rid.second, updateRecordBlob);
-
-        // remove index if applied in existing record
-        auto indexInfos = IndexUtils::getIndexInfos(this, recordDescriptor, record, propertyNameMapInfo);
-        IndexUtils::remove(this, recordDescriptor, existingRecord, indexInfos);
-        // add index if applied in new record
-        IndexUtils::insert(this, recordDescriptor, record, indexInfos);
+        IndexUtils::update(this, recordDescriptor, existingRecord, record, propertyNameMapInfo);
     } catch (const Error& error) {
         rollback();
         throw NOGDB_FATAL_ERROR(error);
@@ -331,6 +495,12 @@ void Transaction::remove(const RecordDescriptor& recordDescriptor)
         // remove index if applied in the record
         auto indexInfos = IndexUtils::getIndexInfos(this, recordDescriptor, record, propertyNameMapInfo);
         IndexUtils::remove(this, recordDescriptor, record, indexInfos);
+        auto compositeIndexInfos = IndexUtils::getCompositeIndexInfos(this, classInfo.id, propertyNameMapInfo);
+        IndexUtils::remove(this, recordDescriptor, record, compositeIndexInfos);
+        auto textIndexInfos = IndexUtils::getTextIndexInfos(this, classInfo.id, propertyNameMapInfo);
+        IndexUtils::remove(this, recordDescriptor, record, textIndexInfos);
+        auto polymorphicIndexInfos = IndexUtils::getPolymorphicIndexInfos(this, classInfo.id, propertyNameMapInfo);
+        IndexUtils::removePolymorphic(this, recordDescriptor, record, polymorphicIndexInfos);
     } catch (const Error& error) {
         rollback();
         throw NOGDB_FATAL_ERROR(error);
@@ -348,10 +518,18 @@ void Transaction::removeAll(const std::string& className)
     try {
         auto dataRecord = DataRecord(_txnBase, classInfo.id, ClassType::VERTEX);
         auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(this, classInfo.id, classInfo.superClassId);
+        // polymorphic indexes also keep records of other classes, so only the entries of these records are removed
+        auto polymorphicIndexInfos = IndexUtils::getPolymorphicIndexInfos(this, classInfo.id, propertyNameMapInfo);
+        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(this, classInfo.id, classInfo.superClassId);
         auto result = std::map<RecordId, std::pair<RecordId, RecordId>> {};
         std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
             [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
                 auto recordId = RecordId { classInfo.id, positionId };
+                if (!polymorphicIndexInfos.empty()) {
+                    auto record = RecordParser::parseRawData(
+                        result, propertyIdMapInfo, classInfo.type == ClassType::EDGE, _txnCtx->isVersionEnabled());
+                    IndexUtils::removePolymorphic(this, RecordDescriptor { recordId }, record, polymorphicIndexInfos);
+                }
                 if (classInfo.type == ClassType::EDGE) {
                     auto srcDstVertex = RecordParser::parseEdgeRawDataVertexSrcDst(
                         result, _txnCtx->isVersionEnabled());
@@ -512,59 +690,100 @@ ResultSet FindOperationBuilder::get() const
         .isTxnCompleted()
         .isClassNameValid(_className);
 
+    return getResultSet(nullptr);
+}
+
+ResultSet FindOperationBuilder::getResultSet(QueryPlan* queryPlan) const
+{
     auto classInfo = SchemaUtils::getExistingClass(_txn, _className);
-    auto classInfoExtend = (_includeSubClassOf) ?
-        SchemaUtils::getSubClassInfos(_txn, classInfo.id) : std::map<std::string, ClassAccessInfo> {};
-    switch (_conditionType) {
-    case ConditionType::CONDITION: {
-        auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(_txn, classInfo.id, classInfo.superClassId);
-        auto resultSet = RecordCompare::compareCondition(*_txn, classInfo, propertyNameMapInfo, *_condition, _indexed);
-        for (const auto& classNameMapInfo : classInfoExtend) {
-            auto& currentClassInfo = classNameMapInfo.second;
-            auto currentPropertyInfo =
-                SchemaUtils::getPropertyNameMapInfo(_txn, currentClassInfo.id, currentClassInfo.superClassId);
-            auto resultSetExtend = RecordCompare::compareCondition(
-                *_txn, currentClassInfo, currentPropertyInfo, *_condition, _indexed);
-            resultSet.insert(resultSet.cend(), resultSetExtend.cbegin(), resultSetExtend.cend());
+    if (_includeSubClassOf && _projection.empty()) {
+        // a polymorphic index of the class keeps the records of all its subclasses as well
+        auto conjunct = getPolymorphicConjunct(_txn, classInfo, _conditionType, _condition, _multiCondition);
+        if (!conjunct.keyConditions.empty()) {
+            return getPolymorphicResultSet(
+                _txn, classInfo, conjunct, _conditionType, _condition, _multiCondition, queryPlan);
         }
-        return resultSet;
     }
-    case ConditionType::MULTI_CONDITION: {
-        auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(_txn, classInfo.id, classInfo.superClassId);
-        auto resultSet = RecordCompare::compareMultiCondition(
-            *_txn, classInfo, propertyNameMapInfo, *_multiCondition, _indexed);
-        for (const auto& classNameMapInfo : classInfoExtend) {
-            auto& currentClassInfo = classNameMapInfo.second;
-            auto currentPropertyInfo =
-                SchemaUtils::getPropertyNameMapInfo(_txn, currentClassInfo.id, currentClassInfo.superClassId);
-            auto resultSetExtend = RecordCompare::compareMultiCondition(
-                *_txn, currentClassInfo, currentPropertyInfo, *_multiCondition, _indexed);
-            resultSet.insert(resultSet.cend(), resultSetExtend.cbegin(), resultSetExtend.cend());
+    auto classInfos = std::vector<ClassAccessInfo> { classInfo };
+    if (_includeSubClassOf) {
+        for (const auto& classNameMapInfo : SchemaUtils::getSubClassInfos(_txn, classInfo.id)) {
+            classInfos.emplace_back(classNameMapInfo.second);
         }
-        return resultSet;
     }
-    case ConditionType::COMPARE_FUNCTION: {
-        auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(_txn, classInfo.id, classInfo.superClassId);
-        auto resultSet = DataRecordUtils::getResultSetByCmpFunction(_txn, classInfo, _function);
-        for (const auto& classNameMapInfo : classInfoExtend) {
-            auto& currentClassInfo = classNameMapInfo.second;
-            auto currentPropertyInfo =
-                SchemaUtils::getPropertyNameMapInfo(_txn, currentClassInfo.id, currentClassInfo.superClassId);
-            auto resultSetExtend = DataRecordUtils::getResultSetByCmpFunction(_txn, classInfo, _function);
-            resultSet.insert(resultSet.cend(), resultSetExtend.cbegin(), resultSetExtend.cend());
+    if (!_projection.empty()) {
+        // records of a versioned context carry their version, which is not kept in index entries
+        if (classInfos.size() == 1 && !_txn->_txnCtx->isVersionEnabled()) {
+            auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(_txn, classInfo.id, classInfo.superClassId);
+            auto conjunct = getCoveringConjunct(
+                _txn, classInfo, propertyNameMapInfo, _conditionType, _condition, _multiCondition, _projection);
+            if (!conjunct.keyConditions.empty()) {
+                auto stopwatch = explain::Stopwatch {};
+                auto resultSet = IndexUtils::getCoveringResultSet(_txn, classInfo, propertyNameMapInfo, conjunct, _projection);
+                if (auto stage = explain::record(
+                        queryPlan, "COVERING_INDEX_SCAN", classInfo.name, 0, resultSet.size(), stopwatch)) {
+                    auto columns = std::string {};
+                    for (const auto& keyPropertyInfo : conjunct.keyPropertyInfos) {
+                        columns += (columns.empty() ? "" : ", ") + keyPropertyInfo.name;
+                    }
+                    stage->indexIds.emplace_back(conjunct.indexInfo.id);
+                    stage->detail = "(" + columns + ")";
+                    stage->indexEntries = resultSet.size();
+                }
+                return resultSet;
+            }
+        }
+        auto operation = *this;
+        operation._projection.clear();
+        auto resultSet = operation.getResultSet(queryPlan);
+        for (auto& result : resultSet) {
+            for (const auto& propertyName : result.record.getProperties()) {
+                if (std::find(_projection.cbegin(), _projection.cend(), propertyName) == _projection.cend()) {
+                    result.record.unset(propertyName);
+                }
+            }
         }
         return resultSet;
     }
-    default: {
-        auto resultSet = DataRecordUtils::getResultSet(_txn, classInfo);
-        for (const auto& classNameMapInfo : classInfoExtend) {
-            auto resultSetExtend = DataRecordUtils::getResultSet(_txn, classNameMapInfo.second);
+    auto resultSet = ResultSet {};
+    for (const auto& currentClassInfo : classInfos) {
+        auto resultSetExtend = ResultSet {};
+        switch (_conditionType) {
+        case ConditionType::CONDITION: {
+            auto propertyNameMapInfo =
+                SchemaUtils::getPropertyNameMapInfo(_txn, currentClassInfo.id, currentClassInfo.superClassId);
+            resultSetExtend = RecordCompare::compareCondition(
+                *_txn, currentClassInfo, propertyNameMapInfo, *_condition, _indexed, queryPlan);
+            break;
+        }
+        case ConditionType::MULTI_CONDITION: {
+            auto propertyNameMapInfo =
+                SchemaUtils::getPropertyNameMapInfo(_txn, currentClassInfo.id, currentClassInfo.superClassId);
+            resultSetExtend = RecordCompare::compareMultiCondition(
+                *_txn, currentClassInfo, propertyNameMapInfo, *_multiCondition, _indexed, queryPlan);
+            break;
+        }
+        default: {
+            auto stopwatch = explain::Stopwatch {};
+            auto isCmpFunction = _conditionType == ConditionType::COMPARE_FUNCTION;
+            resultSetExtend = isCmpFunction ?
+                DataRecordUtils::getResultSetByCmpFunction(_txn, currentClassInfo, _function) :
+                DataRecordUtils::getResultSet(_txn, currentClassInfo);
+            if (queryPlan != nullptr) {
+                auto classCount = DataRecord(_txn->_txnBase, currentClassInfo.id, currentClassInfo.type).count();
+                explain::recordRead(queryPlan, isCmpFunction ? "FUNCTION_SCAN" : "FULL_SCAN", currentClassInfo.name,
+                    classCount, resultSetExtend.size(), classCount, stopwatch);
+            }
+            break;
+        }
+        }
+        if (resultSet.empty()) {
+            resultSet = std::move(resultSetExtend);
+        } else {
             resultSet.insert(resultSet.cend(), resultSetExtend.cbegin(), resultSetExtend.cend());
         }
-        return resultSet;
-    }
     }
-};
+    return resultSet;
+}
 
 ResultSetCursor FindOperationBuilder::getCursor() const
 {
@@ -573,11 +792,27 @@ ResultSetCursor FindOperationBuilder::getCursor() const
         .isClassNameValid(_className);
 
     auto classInfo = SchemaUtils::getExistingClass(_txn, _className);
+    if (_includeSubClassOf) {
+        auto conjunct = getPolymorphicConjunct(_txn, classInfo, _conditionType, _condition, _multiCondition);
+        if (!conjunct.keyConditions.empty()) {
+            auto recordDescriptors = std::vector<RecordDescriptor> {};
+            for (const auto& result :
+                getPolymorphicResultSet(_txn, classInfo, conjunct, _conditionType, _condition, _multiCondition)) {
+                recordDescriptors.emplace_back(result.descriptor);
+            }
+            auto resultSetCursor = ResultSetCursor { *_txn };
+            resultSetCursor.addMetadata(recordDescriptors);
+            return resultSetCursor;
+        }
+    }
     auto classInfoExtend = (_includeSubClassOf) ?
         SchemaUtils::getSubClassInfos(_txn, classInfo.id) : std::map<std::string, ClassAccessInfo> {};
     switch (_conditionType) {
     case ConditionType::CONDITION: {
         auto propertyNameMapInfo = SchemaUtils::getPropertyNameMapInfo(_txn, classInfo.id, classInfo.superClassId);
+        if (classInfoExtend.empty()) {
+            return RecordCompare::compareConditionCursor(*_txn, classInfo, propertyNameMapInfo, *_condition, _indexed);
+        }
         auto resultSetCursor = ResultSetCursor { *_txn };
         auto result = RecordCompare::compareConditionRdesc(
             *_txn, classInfo, propertyNameMapInfo, *_condition, _indexed);
@@ -646,6 +881,13 @@ unsigned long FindOperationBuilder::count() const
         .isClassNameValid(_className);
 
     auto classInfo = SchemaUtils::getExistingClass(_txn, _className);
+    if (_includeSubClassOf) {
+        auto conjunct = getPolymorphicConjunct(_txn, classInfo, _conditionType, _condition, _multiCondition);
+        if (!conjunct.keyConditions.empty()) {
+            return getPolymorphicResultSet(
+                _txn, classInfo, conjunct, _conditionType, _condition, _multiCondition).size();
+        }
+    }
     auto classInfoExtend = (_includeSubClassOf) ?
         SchemaUtils::getSubClassInfos(_txn, classInfo.id) : std::map<std::string, ClassAccessInfo> {};
     switch (_conditionType) {
@@ -696,26 +938,41 @@ unsigned long FindOperationBuilder::count() const
     }
 }
 
+QueryPlan FindOperationBuilder::explain() const
+{
+    BEGIN_VALIDATION(_txn)
+        .isTxnCompleted()
+        .isClassNameValid(_className);
+
+    auto stopwatch = explain::Stopwatch {};
+    auto queryPlan = QueryPlan {};
+    queryPlan.actualRows = getResultSet(&queryPlan).size();
+    queryPlan.elapsedTime = stopwatch.elapsed();
+    return queryPlan;
+}
+
 ResultSet FindEdgeOperationBuilder::get() const
 {
     BEGIN_VALIDATION(_txn)
         .isTxnCompleted()
         .isExistingVertex(_rdesc);
 
+    // the edges of the classes in the filter are read as ranges of the relations
+    auto classFilter = RecordCompare::getFilterClasses(*_txn, _filter);
     auto edgeRecordIds = std::vector<RecordId> {};
     switch (_direction) {
     case EdgeDirection::IN: {
-        edgeRecordIds = _txn->_graph->getInEdges(_rdesc.rid);
+        edgeRecordIds = RecordCompare::resolveEdgeRecordIds(*_txn, _rdesc.rid, Direction::IN, classFilter);
         break;
     }
     case EdgeDirection::OUT: {
-        edgeRecordIds = _txn->_graph->getOutEdges(_rdesc.rid);
+        edgeRecordIds = RecordCompare::resolveEdgeRecordIds(*_txn, _rdesc.rid, Direction::OUT, classFilter);
         break;
     }
     default: {
         auto recordIds = std::set<RecordId> {};
-        auto inEdgeRecordIds = _txn->_graph->getInEdges(_rdesc.rid);
-        auto outEdgeRecordIds = _txn->_graph->getOutEdges(_rdesc.rid);
+        auto inEdgeRecordIds = RecordCompare::resolveEdgeRecordIds(*_txn, _rdesc.rid, Direction::IN, classFilter);
+        auto outEdgeRecordIds = RecordCompare::resolveEdgeRecordIds(*_txn, _rdesc.rid, Direction::OUT, classFilter);
         recordIds.insert(inEdgeRecordIds.cbegin(), inEdgeRecordIds.cend());
         recordIds.insert(outEdgeRecordIds.cbegin(), outEdgeRecordIds.cend());
         edgeRecordIds.assign(recordIds.cbegin(), recordIds.cend());
@@ -723,7 +980,6 @@ ResultSet FindEdgeOperationBuilder::get() const
     }
     }
     auto result = ResultSet {};
-    auto classFilter = RecordCompare::getFilterClasses(*_txn, _filter);
     for (const auto& recordId : edgeRecordIds) {
         auto edgeRecordDescriptor = RecordDescriptor { recordId };
         auto filterResult = RecordCompare::filterResult(*_txn, edgeRecordDescriptor, _filter, classFilter);
@@ -740,20 +996,22 @@ ResultSetCursor FindEdgeOperationBuilder::getCursor() const
         .isTxnCompleted()
         .isExistingVertex(_rdesc);
 
+    // the edges of the classes in the filter are read as ranges of the relations
+    auto classFilter = RecordCompare::getFilterClasses(*_txn, _filter);
     auto edgeRecordIds = std::vector<RecordId> {};
     switch (_direction) {
     case EdgeDirection::IN: {
-        edgeRecordIds = _txn->_graph->getInEdges(_rdesc.rid);
+        edgeRecordIds = RecordCompare::resolveEdgeRecordIds(*_txn, _rdesc.rid, Direction::IN, classFilter);
         break;
     }
     case EdgeDirection::OUT: {
-        edgeRecordIds = _txn->_graph->getOutEdges(_rdesc.rid);
+        edgeRecordIds = RecordCompare::resolveEdgeRecordIds(*_txn, _rdesc.rid, Direction::OUT, classFilter);
         break;
     }
     default: {
         auto recordIds = std::set<RecordId> {};
-        auto inEdgeRecordIds = _txn->_graph->getInEdges(_rdesc.rid);
-        auto outEdgeRecordIds = _txn->_graph->getOutEdges(_rdesc.rid);
+        auto inEdgeRecordIds = RecordCompare::resolveEdgeRecordIds(*_txn, _rdesc.rid, Direction::IN, classFilter);
+        auto outEdgeRecordIds = RecordCompare::resolveEdgeRecordIds(*_txn, _rdesc.rid, Direction::OUT, classFilter);
         recordIds.insert(inEdgeRecordIds.cbegin(), inEdgeRecordIds.cend());
         recordIds.insert(outEdgeRecordIds.cbegin(), outEdgeRecordIds.cend());
         edgeRecordIds.assign(recordIds.cbegin(), recordIds.cend());
@@ -761,7 +1019,6 @@ ResultSetCursor FindEdgeOperationBuilder::getCursor() const
     }
     }
     auto result = ResultSetCursor { *_txn };
-    auto classFilter = RecordCompare::getFilterClasses(*_txn, _filter);
     for (const auto& recordId : edgeRecordIds) {
         auto edgeRecordDescriptor = RecordDescriptor { recordId };
         auto filterRecord = RecordCompare::filterRecord(*_txn, edgeRecordDescriptor, _filter, classFilter);
@@ -778,20 +1035,22 @@ unsigned long FindEdgeOperationBuilder::count() const
         .isTxnCompleted()
         .isExistingVertex(_rdesc);
 
+    // the edges of the classes in the filter are read as ranges of the relations
+    auto classFilter = RecordCompare::getFilterClasses(*_txn, _filter);
     auto edgeRecordIds = std::vector<RecordId> {};
     switch (_direction) {
     case EdgeDirection::IN: {
-        edgeRecordIds = _txn->_graph->getInEdges(_rdesc.rid);
+        edgeRecordIds = RecordCompare::resolveEdgeRecordIds(*_txn, _rdesc.rid, Direction::IN, classFilter);
         break;
     }
     case EdgeDirection::OUT: {
-        edgeRecordIds = _txn->_graph->getOutEdges(_rdesc.rid);
+        edgeRecordIds = RecordCompare::resolveEdgeRecordIds(*_txn, _rdesc.rid, Direction::OUT, classFilter);
         break;
     }
     default: {
         auto recordIds = std::set<RecordId> {};
-        auto inEdgeRecordIds = _txn->_graph->getInEdges(_rdesc.rid);
-        auto outEdgeRecordIds = _txn->_graph->getOutEdges(_rdesc.rid);
+        auto inEdgeRecordIds = RecordCompare::resolveEdgeRecordIds(*_txn, _rdesc.rid, Direction::IN, classFilter);
+        auto outEdgeRecordIds = RecordCompare::resolveEdgeRecordIds(*_txn, _rdesc.rid, Direction::OUT, classFilter);
         recordIds.insert(inEdgeRecordIds.cbegin(), inEdgeRecordIds.cend());
         recordIds.insert(outEdgeRecordIds.cbegin(), outEdgeRecordIds.cend());
         edgeRecordIds.assign(recordIds.cbegin(), recordIds.cend());
@@ -799,7 +1058,6 @@ unsigned long FindEdgeOperationBuilder::count() const
     }
     }
     auto result = 0UL;
-    auto classFilter = RecordCompare::getFilterClasses(*_txn, _filter);
     for (const auto& recordId : edgeRecordIds) {
         auto edgeRecordDescriptor = RecordDescriptor { recordId };
         auto filterRecord = RecordCompare::filterRecord(*_txn, edgeRecordDescriptor, _filter, classFilter);
@@ -829,7 +1087,7 @@ ResultSet TraverseOperationBuilder::get() const
     }
 
     return algorithm::GraphTraversal::breadthFirstSearch(
-        *_txn, _rdescs, _minDepth, _maxDepth, direction, _edgeFilter, _vertexFilter);
+        *_txn, _rdescs, _minDepth, _maxDepth, direction, _edgeFilter, _vertexFilter, _nThreads);
 }
 
 ResultSetCursor TraverseOperationBuilder::getCursor() const
@@ -851,7 +1109,7 @@ ResultSetCursor TraverseOperationBuilder::getCursor() const
     }
 
     auto result = algorithm::GraphTraversal::breadthFirstSearchRdesc(
-        *_txn, _rdescs, _minDepth, _maxDepth, direction, _edgeFilter, _vertexFilter);
+        *_txn, _rdescs, _minDepth, _maxDepth, direction, _edgeFilter, _vertexFilter, _nThreads);
     return std::move(ResultSetCursor { *_txn }.addMetadata(result));
 }
 
@@ -860,6 +1118,32 @@ unsigned long TraverseOperationBuilder::count() const
     return static_cast<unsigned long>(getCursor().count());
 }
 
+QueryPlan TraverseOperationBuilder::explain() const
+{
+    BEGIN_VALIDATION(_txn)
+        .isTxnCompleted()
+        .isExistingVertices(_rdescs);
+
+    auto direction = adapter::relation::Direction::ALL;
+    switch (_direction) {
+    case EdgeDirection::IN:
+        direction = adapter::relation::Direction::IN;
+        break;
+    case EdgeDirection::OUT:
+        direction = adapter::relation::Direction::OUT;
+        break;
+    default:
+        break;
+    }
+
+    auto stopwatch = explain::Stopwatch {};
+    auto queryPlan = QueryPlan {};
+    queryPlan.actualRows = algorithm::GraphTraversal::breadthFirstSearch(
+        *_txn, _rdescs, _minDepth, _maxDepth, direction, _edgeFilter, _vertexFilter, _nThreads, &queryPlan).size();
+    queryPlan.elapsedTime = stopwatch.elapsed();
+    return queryPlan;
+}
+
 ResultSet ShortestPathOperationBuilder::get() const
 {
     BEGIN_VALIDATION(_txn)
@@ -867,8 +1151,13 @@ ResultSet ShortestPathOperationBuilder::get() const
         .isExistingSrcVertex(_srcRdesc)
         .isExistingDstVertex(_dstRdesc);
 
+    if (!_weightPropertyName.empty()) {
+        auto pathWeight = getPathWeight(_weightPropertyName, _hasDefaultWeight, _defaultWeight, _heuristic);
+        return algorithm::GraphTraversal::weightedShortestPath(
+            *_txn, _srcRdesc, _dstRdesc, _edgeFilter, _vertexFilter, pathWeight);
+    }
     return algorithm::GraphTraversal::bfsShortestPath(
-        *_txn, _srcRdesc, _dstRdesc, _edgeFilter, _vertexFilter);
+        *_txn, _srcRdesc, _dstRdesc, _edgeFilter, _vertexFilter, _bidirectional);
 }
 
 ResultSetCursor ShortestPathOperationBuilder::getCursor() const
@@ -878,8 +1167,12 @@ ResultSetCursor ShortestPathOperationBuilder::getCursor() const
         .isExistingSrcVertex(_srcRdesc)
         .isExistingDstVertex(_dstRdesc);
 
-    auto result = algorithm::GraphTraversal::bfsShortestPathRdesc(
-        *_txn, _srcRdesc, _dstRdesc, _edgeFilter, _vertexFilter);
+    auto pathWeight = getPathWeight(_weightPropertyName, _hasDefaultWeight, _defaultWeight, _heuristic);
+    auto result = (!_weightPropertyName.empty())
+        ? algorithm::GraphTraversal::weightedShortestPathRdesc(
+            *_txn, _srcRdesc, _dstRdesc, _edgeFilter, _vertexFilter, pathWeight)
+        : algorithm::GraphTraversal::bfsShortestPathRdesc(
+            *_txn, _srcRdesc, _dstRdesc, _edgeFilter, _vertexFilter, _bidirectional);
     return std::move(ResultSetCursor { *_txn }.addMetadata(result));
 }
 
@@ -888,4 +1181,23 @@ unsigned long ShortestPathOperationBuilder::count() const
     return static_cast<unsigned long>(getCursor().count());
 }
 
+QueryPlan ShortestPathOperationBuilder::explain() const
+{
+    BEGIN_VALIDATION(_txn)
+        .isTxnCompleted()
+        .isExistingSrcVertex(_srcRdesc)
+        .isExistingDstVertex(_dstRdesc);
+
+    auto stopwatch = explain::Stopwatch {};
+    auto queryPlan = QueryPlan {};
+    auto pathWeight = getPathWeight(_weightPropertyName, _hasDefaultWeight, _defaultWeight, _heuristic);
+    queryPlan.actualRows = (!_weightPropertyName.empty())
+        ? algorithm::GraphTraversal::weightedShortestPath(
+            *_txn, _srcRdesc, _dstRdesc, _edgeFilter, _vertexFilter, pathWeight, &queryPlan).size()
+        : algorithm::GraphTraversal::bfsShortestPath(
+            *_txn, _srcRdesc, _dstRdesc, _edgeFilter, _vertexFilter, _bidirectional, &queryPlan).size();
+    queryPlan.elapsedTime = stopwatch.elapsed();
+    return queryPlan;
+}
+
 }
@@ -202,6 +202,80 @@ namespace parser {
             .setBasicInfoIfNotExists(VERSION_PROPERTY, versionId);
     }
 
+    std::pair<const unsigned char*, size_t> RecordParser::parseRawDataPropertyValue(
+        const storage_engine::lmdb::Result& rawData,
+        const PropertyId& propertyId,
+        const ClassType& classType,
+        bool enableVersion)
+    {
+        auto notFound = std::make_pair(static_cast<const unsigned char*>(nullptr), size_t { 0 });
+        if (rawData.empty || rawData.data.empty()) {
+            return notFound;
+        }
+        auto data = rawData.data.data<unsigned char>();
+        auto dataSize = rawData.data.size();
+        auto offset = size_t { 0 };
+        // same as parseRawDataWithBasicInfo, a record written without a version id has no version block
+        if (enableVersion && dataSize >= RECORD_VERSION_DATA_LENGTH) {
+            auto versionId = VersionId { 0 };
+            memcpy(&versionId, data, RECORD_VERSION_DATA_LENGTH);
+            offset += (versionId > 0) ? RECORD_VERSION_DATA_LENGTH : size_t { 0 };
+        }
+        offset += (classType == ClassType::EDGE) ? VERTEX_SRC_DST_RAW_DATA_LENGTH : size_t { 0 };
+        if (dataSize <= offset + 1) {
+            return notFound;
+        }
+        while (offset + sizeof(PropertyId) + sizeof(uint8_t) <= dataSize) {
+            auto currentPropertyId = PropertyId {};
+            memcpy(&currentPropertyId, data + offset, sizeof(PropertyId));
+            offset += sizeof(PropertyId);
+            auto propertySize = size_t {};
+            if ((data[offset] & 0x1) == 1) {
+                auto tmpSize = uint32_t {};
+                memcpy(&tmpSize, data + offset, sizeof(uint32_t));
+                offset += sizeof(uint32_t);
+                propertySize = static_cast<size_t>(tmpSize >> 1);
+            } else {
+                propertySize = static_cast<size_t>(data[offset] >> 1);
+                offset += sizeof(uint8_t);
+            }
+            if (offset + propertySize > dataSize) {
+                break;
+            }
+            if (currentPropertyId == propertyId) {
+                return std::make_pair(data + offset, propertySize);
+            }
+            offset += propertySize;
+        }
+        return notFound;
+    }
+
+    double RecordParser::parseNumericValue(const Bytes& value, const PropertyType& type)
+    {
+        switch (type) {
+        case PropertyType::TINYINT:
+            return value.toTinyInt();
+        case PropertyType::UNSIGNED_TINYINT:
+            return value.toTinyIntU();
+        case PropertyType::SMALLINT:
+            return value.toSmallInt();
+        case PropertyType::UNSIGNED_SMALLINT:
+            return value.toSmallIntU();
+        case PropertyType::INTEGER:
+            return value.toInt();
+        case PropertyType::UNSIGNED_INTEGER:
+            return value.toIntU();
+        case PropertyType::BIGINT:
+            return static_cast<double>(value.toBigInt());
+        case PropertyType::UNSIGNED_BIGINT:
+            return static_cast<double>(value.toBigIntU());
+        case PropertyType::REAL:
+            return value.toReal();
+        default:
+            return 0.0;
+        }
+    }
+
     VersionId RecordParser::parseRawDataVersionId(const storage_engine::lmdb::Result& rawData)
     {
         require(!rawData.data.empty());
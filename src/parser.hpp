@@ -91,6 +91,16 @@ namespace parser {
             const PropertyIdMapInfo& propertyInfos,
             const ClassType& classType,
             bool enableVersion);
+
+        // locate a single property value in raw data without building a record (nullptr if not exists)
+        static std::pair<const unsigned char*, size_t> parseRawDataPropertyValue(const storage_engine::lmdb::Result& rawData,
+            const PropertyId& propertyId,
+            const ClassType& classType,
+            bool enableVersion);
+
+        // the value of a numeric property as a double, or zero for any other type
+        static double parseNumericValue(const Bytes& value, const PropertyType& type);
+
         //-------------------------
         // Version Id parsers
         //-------------------------
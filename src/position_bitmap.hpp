@@ -0,0 +1,319 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "nogdb/nogdb_types.h"
+
+namespace nogdb {
+namespace index {
+
+    /**
+     * A compressed set of the position ids of one class in the manner of roaring bitmaps.
+     * Ids are grouped into chunks by their upper 16 bits, and a chunk keeps its lower 16 bits
+     * either as a sorted array while it is sparse or as a bitmap of 2^16 bits once it is dense.
+     * Position ids are mostly added in ascending order, which appends to the last chunk.
+     */
+    class PositionBitmap {
+    public:
+        PositionBitmap() = default;
+
+        void add(PositionId positionId)
+        {
+            auto key = static_cast<uint16_t>(positionId >> 16);
+            auto value = static_cast<uint16_t>(positionId & 0xffff);
+            if (_keys.empty() || _keys.back() < key) {
+                _keys.emplace_back(key);
+                _chunks.emplace_back();
+                _chunks.back().add(value);
+                return;
+            }
+            auto foundKey = std::lower_bound(_keys.begin(), _keys.end(), key);
+            auto chunk = _chunks.begin() + std::distance(_keys.begin(), foundKey);
+            if (foundKey == _keys.end() || *foundKey != key) {
+                chunk = _chunks.emplace(chunk);
+                _keys.emplace(foundKey, key);
+            }
+            chunk->add(value);
+        }
+
+        bool contains(PositionId positionId) const
+        {
+            auto key = static_cast<uint16_t>(positionId >> 16);
+            auto foundKey = std::lower_bound(_keys.cbegin(), _keys.cend(), key);
+            return foundKey != _keys.cend() && *foundKey == key
+                && _chunks[std::distance(_keys.cbegin(), foundKey)].contains(static_cast<uint16_t>(positionId & 0xffff));
+        }
+
+        size_t size() const
+        {
+            auto size = size_t { 0 };
+            for (const auto& chunk : _chunks) {
+                size += chunk.size();
+            }
+            return size;
+        }
+
+        bool empty() const
+        {
+            return _chunks.empty();
+        }
+
+        PositionBitmap operator&(const PositionBitmap& other) const
+        {
+            auto result = PositionBitmap {};
+            for (auto i = size_t { 0 }, j = size_t { 0 }; i < _keys.size() && j < other._keys.size();) {
+                if (_keys[i] < other._keys[j]) {
+                    ++i;
+                } else if (other._keys[j] < _keys[i]) {
+                    ++j;
+                } else {
+                    auto chunk = Chunk::intersect(_chunks[i], other._chunks[j]);
+                    if (chunk.size() > 0) {
+                        result._keys.emplace_back(_keys[i]);
+                        result._chunks.emplace_back(std::move(chunk));
+                    }
+                    ++i;
+                    ++j;
+                }
+            }
+            return result;
+        }
+
+        PositionBitmap operator|(const PositionBitmap& other) const
+        {
+            auto result = PositionBitmap {};
+            auto i = size_t { 0 }, j = size_t { 0 };
+            while (i < _keys.size() || j < other._keys.size()) {
+                if (j == other._keys.size() || (i < _keys.size() && _keys[i] < other._keys[j])) {
+                    result._keys.emplace_back(_keys[i]);
+                    result._chunks.emplace_back(_chunks[i++]);
+                } else if (i == _keys.size() || other._keys[j] < _keys[i]) {
+                    result._keys.emplace_back(other._keys[j]);
+                    result._chunks.emplace_back(other._chunks[j++]);
+                } else {
+                    result._keys.emplace_back(_keys[i]);
+                    result._chunks.emplace_back(Chunk::unite(_chunks[i++], other._chunks[j++]));
+                }
+            }
+            return result;
+        }
+
+        /**
+         * Call the function with every position id in ascending order.
+         */
+        template <typename F>
+        void forEach(F&& function) const
+        {
+            for (auto i = size_t { 0 }; i < _keys.size(); ++i) {
+                auto high = static_cast<PositionId>(_keys[i]) << 16;
+                _chunks[i].forEach([&](uint16_t value) { function(high | value); });
+            }
+        }
+
+    private:
+        class Chunk {
+        public:
+            // a chunk with more values than this takes less memory as a bitmap
+            static constexpr size_t MAX_ARRAY_SIZE = 4096;
+            static constexpr size_t BITMAP_WORDS = (1 << 16) / 64;
+            // an array this many times longer than the other is galloped through instead of merged
+            static constexpr size_t GALLOP_RATIO = 32;
+
+            void add(uint16_t value)
+            {
+                if (isBitmap()) {
+                    auto& word = _words[value >> 6];
+                    auto bit = uint64_t { 1 } << (value & 63);
+                    _size += (word & bit) ? 0 : 1;
+                    word |= bit;
+                    return;
+                }
+                if (_values.empty() || _values.back() < value) {
+                    _values.emplace_back(value);
+                } else {
+                    auto found = std::lower_bound(_values.begin(), _values.end(), value);
+                    if (*found == value) {
+                        return;
+                    }
+                    _values.emplace(found, value);
+                }
+                _size = _values.size();
+                if (_size > MAX_ARRAY_SIZE) {
+                    toBitmap();
+                }
+            }
+
+            bool contains(uint16_t value) const
+            {
+                if (isBitmap()) {
+                    return (_words[value >> 6] >> (value & 63)) & 1;
+                }
+                return std::binary_search(_values.cbegin(), _values.cend(), value);
+            }
+
+            size_t size() const
+            {
+                return _size;
+            }
+
+            template <typename F>
+            void forEach(F&& function) const
+            {
+                if (!isBitmap()) {
+                    for (auto value : _values) {
+                        function(value);
+                    }
+                    return;
+                }
+                for (auto i = size_t { 0 }; i < BITMAP_WORDS; ++i) {
+                    for (auto word = _words[i]; word != 0; word &= word - 1) {
+                        function(static_cast<uint16_t>(i * 64 + static_cast<size_t>(__builtin_ctzll(word))));
+                    }
+                }
+            }
+
+            static Chunk intersect(const Chunk& lhs, const Chunk& rhs)
+            {
+                auto result = Chunk {};
+                if (lhs.isBitmap() && rhs.isBitmap()) {
+                    result._words.resize(BITMAP_WORDS);
+                    for (auto i = size_t { 0 }; i < BITMAP_WORDS; ++i) {
+                        result._words[i] = lhs._words[i] & rhs._words[i];
+                        result._size += static_cast<size_t>(__builtin_popcountll(result._words[i]));
+                    }
+                    if (result._size <= MAX_ARRAY_SIZE) {
+                        result.toArray();
+                    }
+                } else if (lhs.isBitmap() || rhs.isBitmap()) {
+                    const auto& bitmap = lhs.isBitmap() ? lhs : rhs;
+                    const auto& array = lhs.isBitmap() ? rhs : lhs;
+                    for (auto value : array._values) {
+                        if (bitmap.contains(value)) {
+                            result._values.emplace_back(value);
+                        }
+                    }
+                    result._size = result._values.size();
+                } else {
+                    const auto& shorter = (lhs._size <= rhs._size) ? lhs._values : rhs._values;
+                    const auto& longer = (lhs._size <= rhs._size) ? rhs._values : lhs._values;
+                    if (shorter.size() * GALLOP_RATIO < longer.size()) {
+                        gallopIntersect(shorter, longer, result._values);
+                    } else {
+                        std::set_intersection(shorter.cbegin(), shorter.cend(), longer.cbegin(), longer.cend(),
+                            std::back_inserter(result._values));
+                    }
+                    result._size = result._values.size();
+                }
+                return result;
+            }
+
+            static Chunk unite(const Chunk& lhs, const Chunk& rhs)
+            {
+                if (lhs.isBitmap() || rhs.isBitmap()) {
+                    auto result = lhs.isBitmap() ? lhs : rhs;
+                    const auto& other = lhs.isBitmap() ? rhs : lhs;
+                    if (other.isBitmap()) {
+                        result._size = 0;
+                        for (auto i = size_t { 0 }; i < BITMAP_WORDS; ++i) {
+                            result._words[i] |= other._words[i];
+                            result._size += static_cast<size_t>(__builtin_popcountll(result._words[i]));
+                        }
+                    } else {
+                        for (auto value : other._values) {
+                            result.add(value);
+                        }
+                    }
+                    return result;
+                }
+                auto result = Chunk {};
+                std::set_union(lhs._values.cbegin(), lhs._values.cend(), rhs._values.cbegin(), rhs._values.cend(),
+                    std::back_inserter(result._values));
+                result._size = result._values.size();
+                if (result._size > MAX_ARRAY_SIZE) {
+                    result.toBitmap();
+                }
+                return result;
+            }
+
+        private:
+            std::vector<uint16_t> _values {};
+            std::vector<uint64_t> _words {};
+            size_t _size {};
+
+            bool isBitmap() const
+            {
+                return !_words.empty();
+            }
+
+            void toBitmap()
+            {
+                _words.assign(BITMAP_WORDS, 0);
+                for (auto value : _values) {
+                    _words[value >> 6] |= uint64_t { 1 } << (value & 63);
+                }
+                _values = std::vector<uint16_t> {};
+            }
+
+            void toArray()
+            {
+                _values.reserve(_size);
+                forEach([&](uint16_t value) { _values.emplace_back(value); });
+                _words = std::vector<uint64_t> {};
+            }
+
+            // look every value of the shorter array up in the longer one with exponential steps
+            static void gallopIntersect(const std::vector<uint16_t>& shorter,
+                const std::vector<uint16_t>& longer,
+                std::vector<uint16_t>& result)
+            {
+                auto begin = longer.cbegin();
+                for (auto value : shorter) {
+                    auto step = size_t { 1 };
+                    auto end = begin;
+                    while (static_cast<size_t>(std::distance(end, longer.cend())) > step && *(end + step) < value) {
+                        end += step;
+                        step *= 2;
+                    }
+                    auto last = (static_cast<size_t>(std::distance(end, longer.cend())) > step) ? end + step + 1
+                                                                                              : longer.cend();
+                    begin = std::lower_bound(end, last, value);
+                    if (begin == longer.cend()) {
+                        break;
+                    }
+                    if (*begin == value) {
+                        result.emplace_back(value);
+                    }
+                }
+            }
+        };
+
+        std::vector<uint16_t> _keys {};
+        std::vector<Chunk> _chunks {};
+    };
+
+}
+}
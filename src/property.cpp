@@ -19,11 +19,13 @@
  *
  */
 
+#include <algorithm>
 #include <memory>
 
 #include "index.hpp"
 #include "lmdb_engine.hpp"
 #include "schema.hpp"
+#include "statistics.hpp"
 #include "validate.hpp"
 
 #include "nogdb/nogdb.h"
@@ -32,6 +34,7 @@ namespace nogdb {
 using namespace adapter::schema;
 using namespace schema;
 using namespace index;
+using statistics::StatisticsUtils;
 
 const PropertyDescriptor Transaction::addProperty(const std::string& className,
     const std::string& propertyName,
@@ -104,11 +107,15 @@ void Transaction::dropProperty(const std::string& className, const std::string&
     auto foundProperty = SchemaUtils::getExistingProperty(this, foundClass.id, propertyName);
     // check if all index tables associated with the column have bee removed beforehand
     auto foundIndex = _adapter->dbIndex()->getInfo(foundClass.id, foundProperty.id);
-    if (foundIndex.id != IndexId {}) {
+    if (foundIndex.id != IndexId {} || !_adapter->dbCompositeIndex()->getInfos(foundClass.id, foundProperty.id).empty()
+        || _adapter->dbTextIndex()->getInfo(foundClass.id, foundProperty.id).id != IndexId {}
+        || _adapter->dbPolymorphicIndex()->getInfo(foundClass.id, foundProperty.id).id != IndexId {}
+        || IndexUtils::isUsedByPredicate(this, foundClass.id, foundProperty.id)) {
         throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_IN_USED_PROPERTY);
     }
     try {
         _adapter->dbProperty()->remove(foundClass.id, propertyName);
+        StatisticsUtils::remove(this, foundClass.id, foundProperty.id);
         _adapter->dbInfo()->setNumPropertyId(_adapter->dbInfo()->getNumPropertyId() - PropertyId { 1 });
     } catch (const Error& err) {
         rollback();
@@ -122,6 +129,39 @@ void Transaction::dropProperty(const std::string& className, const std::string&
 const IndexDescriptor Transaction::addIndex(const std::string& className,
     const std::string& propertyName,
     bool isUnique)
+{
+    return createIndex(className, propertyName, isUnique, std::vector<const Condition*> {});
+}
+
+const IndexDescriptor Transaction::addIndex(const std::string& className,
+    const std::string& propertyName,
+    bool isUnique,
+    IndexCollation collation)
+{
+    return createIndex(className, propertyName, isUnique, std::vector<const Condition*> {}, collation);
+}
+
+const IndexDescriptor Transaction::addIndex(const std::string& className,
+    const std::string& propertyName,
+    bool isUnique,
+    const Condition& predicate)
+{
+    return createIndex(className, propertyName, isUnique, std::vector<const Condition*> { &predicate });
+}
+
+const IndexDescriptor Transaction::addIndex(const std::string& className,
+    const std::string& propertyName,
+    bool isUnique,
+    const MultiCondition& predicate)
+{
+    return createIndex(className, propertyName, isUnique, IndexUtils::getPredicateConditions(predicate));
+}
+
+const IndexDescriptor Transaction::createIndex(const std::string& className,
+    const std::string& propertyName,
+    bool isUnique,
+    const std::vector<const Condition*>& predicate,
+    IndexCollation collation)
 {
     BEGIN_VALIDATION(this)
         .isTxnValid()
@@ -132,16 +172,20 @@ const IndexDescriptor Transaction::addIndex(const std::string& className,
 
     auto foundClass = SchemaUtils::getExistingClass(this, className);
     auto foundProperty = SchemaUtils::getExistingPropertyExtend(this, foundClass.id, propertyName);
-    if (foundProperty.type == PropertyType::BLOB || foundProperty.type == PropertyType::UNDEFINED) {
+    if (foundProperty.type == PropertyType::BLOB || foundProperty.type == PropertyType::UNDEFINED
+        || (collation != IndexCollation::BINARY && foundProperty.type != PropertyType::TEXT)) {
         throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_PROPTYPE_INDEX);
     }
     auto indexInfo = _adapter->dbIndex()->getInfo(foundClass.id, foundProperty.id);
     if (indexInfo.id != IndexId {}) {
         throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_DUPLICATE_INDEX);
     }
+    auto indexPredicate = (predicate.empty()) ? std::string {}
+        : IndexUtils::getPredicate(SchemaUtils::getPropertyNameMapInfo(this, foundClass.id, foundClass.superClassId),
+            predicate);
     try {
         auto indexId = _adapter->dbInfo()->getMaxIndexId() + IndexId { 1 };
-        auto indexProps = IndexAccessInfo { foundClass.id, foundProperty.id, indexId, isUnique };
+        auto indexProps = IndexAccessInfo { foundClass.id, foundProperty.id, indexId, isUnique, indexPredicate, collation };
         // create index metadata in schema
         _adapter->dbIndex()->create(indexProps);
         // create index record in index database
@@ -152,7 +196,90 @@ const IndexDescriptor Transaction::addIndex(const std::string& className,
             indexId,
             foundClass.id,
             foundProperty.id,
-            isUnique
+            isUnique,
+            collation
+        };
+    } catch (const Error& err) {
+        if (err.code() == MDB_KEYEXIST) {
+            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_INDEX_CONSTRAINT);
+        } else {
+            rollback();
+            throw NOGDB_FATAL_ERROR(err);
+        }
+    } catch (...) {
+        rollback();
+        std::rethrow_exception(std::current_exception());
+    }
+}
+
+const IndexDescriptor Transaction::addIndex(const std::string& className,
+    const std::vector<std::string>& propertyNames,
+    bool isUnique,
+    const std::vector<std::string>& includedPropertyNames)
+{
+    if (propertyNames.size() == 1 && includedPropertyNames.empty()) {
+        return addIndex(className, propertyNames.front(), isUnique);
+    }
+    auto validators = BEGIN_VALIDATION(this)
+                          .isTxnValid()
+                          .isTxnCompleted()
+                          .isClassNameValid(className)
+                          .isIndexIdMaxReach();
+    if (propertyNames.empty()) {
+        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_PROPERTYNAME);
+    }
+    for (const auto& propertyName : propertyNames) {
+        validators.isPropertyNameValid(propertyName);
+    }
+    for (const auto& propertyName : includedPropertyNames) {
+        validators.isPropertyNameValid(propertyName);
+    }
+
+    auto foundClass = SchemaUtils::getExistingClass(this, className);
+    auto propertyInfos = std::vector<PropertyAccessInfo> {};
+    auto propertyIds = std::vector<PropertyId> {};
+    for (const auto& propertyName : propertyNames) {
+        auto foundProperty = SchemaUtils::getExistingPropertyExtend(this, foundClass.id, propertyName);
+        if (foundProperty.type == PropertyType::BLOB || foundProperty.type == PropertyType::UNDEFINED) {
+            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_PROPTYPE_INDEX);
+        }
+        if (std::find(propertyIds.cbegin(), propertyIds.cend(), foundProperty.id) != propertyIds.cend()) {
+            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_DUPLICATE_PROPERTY);
+        }
+        propertyInfos.emplace_back(foundProperty);
+        propertyIds.emplace_back(foundProperty.id);
+    }
+    // included properties are only stored in the index entries so that they may be of any type
+    auto includedPropertyIds = std::vector<PropertyId> {};
+    for (const auto& propertyName : includedPropertyNames) {
+        auto foundProperty = SchemaUtils::getExistingPropertyExtend(this, foundClass.id, propertyName);
+        if (std::find(propertyIds.cbegin(), propertyIds.cend(), foundProperty.id) != propertyIds.cend()
+            || std::find(includedPropertyIds.cbegin(), includedPropertyIds.cend(), foundProperty.id)
+                != includedPropertyIds.cend()) {
+            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_DUPLICATE_PROPERTY);
+        }
+        propertyInfos.emplace_back(foundProperty);
+        includedPropertyIds.emplace_back(foundProperty.id);
+    }
+    auto indexInfo = _adapter->dbCompositeIndex()->getInfo(foundClass.id, propertyIds);
+    if (indexInfo.id != IndexId {}) {
+        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_DUPLICATE_INDEX);
+    }
+    try {
+        auto indexId = _adapter->dbInfo()->getMaxIndexId() + IndexId { 1 };
+        auto indexProps = IndexAccessInfo { foundClass.id, propertyIds, indexId, isUnique, includedPropertyIds };
+        // create composite index metadata in schema
+        _adapter->dbCompositeIndex()->create(indexProps);
+        // create index record in index database
+        IndexUtils::initialize(this, propertyInfos, indexProps, foundClass.superClassId, foundClass.type);
+        _adapter->dbInfo()->setMaxIndexId(indexId);
+        _adapter->dbInfo()->setNumIndexId(_adapter->dbInfo()->getNumIndexId() + IndexId { 1 });
+        return IndexDescriptor {
+            indexId,
+            foundClass.id,
+            propertyIds,
+            isUnique,
+            includedPropertyIds
         };
     } catch (const Error& err) {
         if (err.code() == MDB_KEYEXIST) {
@@ -196,4 +323,185 @@ void Transaction::dropIndex(const std::string& className, const std::string& pro
     }
 }
 
+void Transaction::dropIndex(const std::string& className, const std::vector<std::string>& propertyNames)
+{
+    auto validators = BEGIN_VALIDATION(this)
+                          .isTxnValid()
+                          .isTxnCompleted()
+                          .isClassNameValid(className);
+    for (const auto& propertyName : propertyNames) {
+        validators.isPropertyNameValid(propertyName);
+    }
+
+    auto foundClass = SchemaUtils::getExistingClass(this, className);
+    auto propertyInfos = std::vector<PropertyAccessInfo> {};
+    auto propertyIds = std::vector<PropertyId> {};
+    for (const auto& propertyName : propertyNames) {
+        propertyInfos.emplace_back(SchemaUtils::getExistingPropertyExtend(this, foundClass.id, propertyName));
+        propertyIds.emplace_back(propertyInfos.back().id);
+    }
+    // a single property may be the key of both a single-property index and a covering composite index
+    if (propertyIds.size() == 1 && _adapter->dbCompositeIndex()->getInfo(foundClass.id, propertyIds).id == IndexId {}) {
+        dropIndex(className, propertyNames.front());
+        return;
+    }
+    auto indexInfo = SchemaUtils::getIndexInfo(this, foundClass.id, propertyIds);
+    try {
+        // remove composite index metadata from schema
+        _adapter->dbCompositeIndex()->remove(foundClass.id, indexInfo.id);
+        // remove all index data from index database
+        IndexUtils::drop(this, propertyInfos, indexInfo);
+        _adapter->dbInfo()->setNumIndexId(_adapter->dbInfo()->getNumIndexId() - IndexId { 1 });
+    } catch (const Error& err) {
+        rollback();
+        throw NOGDB_FATAL_ERROR(err);
+    } catch (...) {
+        rollback();
+        std::rethrow_exception(std::current_exception());
+    }
+}
+
+const IndexDescriptor Transaction::addTextIndex(const std::string& className, const std::string& propertyName)
+{
+    BEGIN_VALIDATION(this)
+        .isTxnValid()
+        .isTxnCompleted()
+        .isClassNameValid(className)
+        .isPropertyNameValid(propertyName)
+        .isIndexIdMaxReach();
+
+    auto foundClass = SchemaUtils::getExistingClass(this, className);
+    auto foundProperty = SchemaUtils::getExistingPropertyExtend(this, foundClass.id, propertyName);
+    if (foundProperty.type != PropertyType::TEXT) {
+        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_PROPTYPE_INDEX);
+    }
+    auto indexInfo = _adapter->dbTextIndex()->getInfo(foundClass.id, foundProperty.id);
+    if (indexInfo.id != IndexId {}) {
+        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_DUPLICATE_INDEX);
+    }
+    try {
+        auto indexId = _adapter->dbInfo()->getMaxIndexId() + IndexId { 1 };
+        auto indexProps = IndexAccessInfo { foundClass.id, foundProperty.id, indexId, false };
+        // create text index metadata in schema
+        _adapter->dbTextIndex()->create(indexProps);
+        // create text index record in index database
+        IndexUtils::initializeText(this, foundProperty, indexProps, foundClass.superClassId, foundClass.type);
+        _adapter->dbInfo()->setMaxIndexId(indexId);
+        _adapter->dbInfo()->setNumIndexId(_adapter->dbInfo()->getNumIndexId() + IndexId { 1 });
+        return IndexDescriptor {
+            indexId,
+            foundClass.id,
+            foundProperty.id,
+            false
+        };
+    } catch (const Error& err) {
+        rollback();
+        throw NOGDB_FATAL_ERROR(err);
+    } catch (...) {
+        rollback();
+        std::rethrow_exception(std::current_exception());
+    }
+}
+
+void Transaction::dropTextIndex(const std::string& className, const std::string& propertyName)
+{
+    BEGIN_VALIDATION(this)
+        .isTxnValid()
+        .isTxnCompleted()
+        .isClassNameValid(className)
+        .isPropertyNameValid(propertyName);
+
+    auto foundClass = SchemaUtils::getExistingClass(this, className);
+    auto foundProperty = SchemaUtils::getExistingPropertyExtend(this, foundClass.id, propertyName);
+    auto indexInfo = _adapter->dbTextIndex()->getInfo(foundClass.id, foundProperty.id);
+    if (indexInfo.id == IndexId {}) {
+        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_NOEXST_INDEX);
+    }
+    try {
+        // remove text index metadata from schema
+        _adapter->dbTextIndex()->remove(foundClass.id, foundProperty.id);
+        // remove all text index data from index database
+        IndexUtils::dropText(this, indexInfo);
+        _adapter->dbInfo()->setNumIndexId(_adapter->dbInfo()->getNumIndexId() - IndexId { 1 });
+    } catch (const Error& err) {
+        rollback();
+        throw NOGDB_FATAL_ERROR(err);
+    } catch (...) {
+        rollback();
+        std::rethrow_exception(std::current_exception());
+    }
+}
+
+
+const IndexDescriptor Transaction::addPolymorphicIndex(const std::string& className, const std::string& propertyName)
+{
+    BEGIN_VALIDATION(this)
+        .isTxnValid()
+        .isTxnCompleted()
+        .isClassNameValid(className)
+        .isPropertyNameValid(propertyName)
+        .isIndexIdMaxReach();
+
+    auto foundClass = SchemaUtils::getExistingClass(this, className);
+    auto foundProperty = SchemaUtils::getExistingPropertyExtend(this, foundClass.id, propertyName);
+    if (foundProperty.type == PropertyType::BLOB || foundProperty.type == PropertyType::UNDEFINED) {
+        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_PROPTYPE_INDEX);
+    }
+    auto indexInfo = _adapter->dbPolymorphicIndex()->getInfo(foundClass.id, foundProperty.id);
+    if (indexInfo.id != IndexId {}) {
+        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_DUPLICATE_INDEX);
+    }
+    try {
+        auto indexId = _adapter->dbInfo()->getMaxIndexId() + IndexId { 1 };
+        auto indexProps = IndexAccessInfo { foundClass.id, foundProperty.id, indexId, false };
+        // create polymorphic index metadata in schema
+        _adapter->dbPolymorphicIndex()->create(indexProps);
+        // create polymorphic index record in index database from the class and all its subclasses
+        IndexUtils::initializePolymorphic(this, foundProperty, indexProps);
+        _adapter->dbInfo()->setMaxIndexId(indexId);
+        _adapter->dbInfo()->setNumIndexId(_adapter->dbInfo()->getNumIndexId() + IndexId { 1 });
+        return IndexDescriptor {
+            indexId,
+            foundClass.id,
+            foundProperty.id,
+            false
+        };
+    } catch (const Error& err) {
+        rollback();
+        throw NOGDB_FATAL_ERROR(err);
+    } catch (...) {
+        rollback();
+        std::rethrow_exception(std::current_exception());
+    }
+}
+
+void Transaction::dropPolymorphicIndex(const std::string& className, const std::string& propertyName)
+{
+    BEGIN_VALIDATION(this)
+        .isTxnValid()
+        .isTxnCompleted()
+        .isClassNameValid(className)
+        .isPropertyNameValid(propertyName);
+
+    auto foundClass = SchemaUtils::getExistingClass(this, className);
+    auto foundProperty = SchemaUtils::getExistingPropertyExtend(this, foundClass.id, propertyName);
+    auto indexInfo = _adapter->dbPolymorphicIndex()->getInfo(foundClass.id, foundProperty.id);
+    if (indexInfo.id == IndexId {}) {
+        throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_NOEXST_INDEX);
+    }
+    try {
+        // remove polymorphic index metadata from schema
+        _adapter->dbPolymorphicIndex()->remove(foundClass.id, foundProperty.id);
+        // remove all polymorphic index data from index database
+        IndexUtils::dropPolymorphic(this, indexInfo);
+        _adapter->dbInfo()->setNumIndexId(_adapter->dbInfo()->getNumIndexId() - IndexId { 1 });
+    } catch (const Error& err) {
+        rollback();
+        throw NOGDB_FATAL_ERROR(err);
+    } catch (...) {
+        rollback();
+        std::rethrow_exception(std::current_exception());
+    }
+}
+
 }
@@ -110,6 +110,16 @@ namespace relation {
         return _outRel->getEdges(recordId);
     }
 
+    std::vector<RecordId> GraphUtils::getInEdges(const RecordId& recordId, const ClassId& edgeClassId) const
+    {
+        return _inRel->getEdges(recordId, edgeClassId);
+    }
+
+    std::vector<RecordId> GraphUtils::getOutEdges(const RecordId& recordId, const ClassId& edgeClassId) const
+    {
+        return _outRel->getEdges(recordId, edgeClassId);
+    }
+
     std::vector<std::pair<RecordId, RecordId>> GraphUtils::getInEdgeAndNeighbours(const RecordId& recordId) const
     {
         return _inRel->getEdgeAndNeighbours(recordId);
@@ -120,6 +130,18 @@ namespace relation {
         return _outRel->getEdgeAndNeighbours(recordId);
     }
 
+    std::vector<std::pair<RecordId, RecordId>> GraphUtils::getInEdgeAndNeighbours(const RecordId& recordId,
+        const ClassId& edgeClassId) const
+    {
+        return _inRel->getEdgeAndNeighbours(recordId, edgeClassId);
+    }
+
+    std::vector<std::pair<RecordId, RecordId>> GraphUtils::getOutEdgeAndNeighbours(const RecordId& recordId,
+        const ClassId& edgeClassId) const
+    {
+        return _outRel->getEdgeAndNeighbours(recordId, edgeClassId);
+    }
+
     std::pair<RecordId, RecordId> GraphUtils::getSrcDstVertices(const RecordId& recordId) const
     {
         std::function<std::shared_ptr<DataRecord>(void)> callback = [&]() {
@@ -79,10 +79,20 @@ namespace relation {
 
         std::vector<RecordId> getOutEdges(const RecordId& recordId) const;
 
+        std::vector<RecordId> getInEdges(const RecordId& recordId, const ClassId& edgeClassId) const;
+
+        std::vector<RecordId> getOutEdges(const RecordId& recordId, const ClassId& edgeClassId) const;
+
         std::vector<std::pair<RecordId, RecordId>> getInEdgeAndNeighbours(const RecordId& recordId) const;
 
         std::vector<std::pair<RecordId, RecordId>> getOutEdgeAndNeighbours(const RecordId& recordId) const;
 
+        std::vector<std::pair<RecordId, RecordId>> getInEdgeAndNeighbours(const RecordId& recordId,
+            const ClassId& edgeClassId) const;
+
+        std::vector<std::pair<RecordId, RecordId>> getOutEdgeAndNeighbours(const RecordId& recordId,
+            const ClassId& edgeClassId) const;
+
         std::pair<RecordId, RecordId> getSrcDstVertices(const RecordId& recordId) const;
 
     private:
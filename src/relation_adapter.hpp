@@ -45,6 +45,8 @@ namespace relation {
     /**
      * Raw record format in lmdb data storage:
      * {vertexId<string>} -> {edgeId<RecordId>}{neighborId<RecordId>}
+     * Duplicates are sorted by their bytes, which begin with the class id of an edge,
+     * so that the edges of one class incident to a vertex are contiguous.
      */
     struct RelationAccessInfo {
         RelationAccessInfo() = default;
@@ -162,6 +164,38 @@ namespace relation {
             return result;
         }
 
+        std::vector<RecordId> getEdges(const RecordId& vertexId, const ClassId& edgeClassId) const
+        {
+            auto result = std::vector<RecordId> {};
+            auto cursorHandler = cursor();
+            for (auto keyValue = cursorHandler.findRange(rid2str(vertexId), edgeClassId);
+                 !keyValue.empty();
+                 keyValue = cursorHandler.getNextDup()) {
+                auto edgeId = parseEdgeId(keyValue.val.data.blob());
+                if (edgeId.first != edgeClassId)
+                    break;
+                result.emplace_back(edgeId);
+            }
+            return result;
+        }
+
+        std::vector<std::pair<RecordId, RecordId>> getEdgeAndNeighbours(const RecordId& vertexId,
+            const ClassId& edgeClassId) const
+        {
+            auto result = std::vector<std::pair<RecordId, RecordId>> {};
+            auto cursorHandler = cursor();
+            for (auto keyValue = cursorHandler.findRange(rid2str(vertexId), edgeClassId);
+                 !keyValue.empty();
+                 keyValue = cursorHandler.getNextDup()) {
+                auto blob = keyValue.val.data.blob();
+                auto edgeId = parseEdgeId(blob);
+                if (edgeId.first != edgeClassId)
+                    break;
+                result.emplace_back(std::make_pair(edgeId, parseNeighborId(blob)));
+            }
+            return result;
+        }
+
         std::vector<std::pair<RecordId, RecordId>> getEdgeAndNeighbours(const RecordId& vertexId) const
         {
             auto result = std::vector<std::pair<RecordId, RecordId>> {};
@@ -144,5 +144,16 @@ namespace schema {
         return foundIndexInfo;
     }
 
+    IndexAccessInfo SchemaUtils::getIndexInfo(const Transaction *txn,
+        const ClassId& classId,
+        const std::vector<PropertyId>& propertyIds)
+    {
+        auto foundIndexInfo = txn->_adapter->dbCompositeIndex()->getInfo(classId, propertyIds);
+        if (foundIndexInfo.id == IndexId {}) {
+            throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_NOEXST_INDEX);
+        }
+        return foundIndexInfo;
+    }
+
 }
 }
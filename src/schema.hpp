@@ -79,6 +79,10 @@ namespace schema {
             const ClassId& classId,
             const PropertyId& propertyId);
 
+        static IndexAccessInfo getIndexInfo(const Transaction *txn,
+            const ClassId& classId,
+            const std::vector<PropertyId>& propertyIds);
+
     private:
 
         static inline PropertyNameMapInfo& addBasicInfo(PropertyNameMapInfo& propertyInfo)
@@ -486,23 +486,59 @@ namespace schema {
 
     /**
    * Raw record format in lmdb data storage:
-   * {classId<uint16>}{propertyId<uint16>} -> {id<uint16>}{isUnique<uint8>}
+   * {classId<uint16>}{propertyId<uint16>} -> {id<uint16>}{flags<uint8>}[{predicate<bytes>}]
+   * where the lowest bit of the flags is isUnique and the next two bits are the collation,
+   * and the predicate is only present for partial indexes.
    */
     struct IndexAccessInfo {
         IndexAccessInfo() = default;
 
-        IndexAccessInfo(const ClassId& _classId, const PropertyId& _propertyId, const IndexId& _id, bool _isUnique)
+        IndexAccessInfo(const ClassId& _classId,
+            const PropertyId& _propertyId,
+            const IndexId& _id,
+            bool _isUnique,
+            const std::string& _predicate = std::string {},
+            IndexCollation _collation = IndexCollation::BINARY)
             : classId { _classId }
             , propertyId { _propertyId }
             , id { _id }
             , isUnique { _isUnique }
+            , predicate { _predicate }
+            , collation { _collation }
         {
         }
 
+        IndexAccessInfo(const ClassId& _classId,
+            const std::vector<PropertyId>& _propertyIds,
+            const IndexId& _id,
+            bool _isUnique,
+            const std::vector<PropertyId>& _includedPropertyIds = std::vector<PropertyId> {})
+            : classId { _classId }
+            , propertyId { _propertyIds.empty() ? PropertyId { 0 } : _propertyIds.front() }
+            , propertyIds { _propertyIds }
+            , includedPropertyIds { _includedPropertyIds }
+            , id { _id }
+            , isUnique { _isUnique }
+        {
+        }
+
+        bool isComposite() const
+        {
+            return !propertyIds.empty();
+        }
+
         ClassId classId { 0 };
         PropertyId propertyId { 0 };
+        // the ordered key columns of a composite index, or none for a single-property index
+        std::vector<PropertyId> propertyIds {};
+        // the non-key columns of a composite index which are stored beside the position id of each entry
+        std::vector<PropertyId> includedPropertyIds {};
         IndexId id { 0 };
         bool isUnique { true };
+        // the encoded conditions which a record must satisfy to be kept in a partial index,
+        // or none for an index of all records
+        std::string predicate {};
+        IndexCollation collation { IndexCollation::BINARY };
     };
 
     class IndexAccess : public storage_engine::adapter::LMDBKeyValAccess {
@@ -573,13 +609,20 @@ namespace schema {
     protected:
         using IndexKey = uint32_t;
 
+        IndexAccess(const storage_engine::LMDBTxn* const txn, const std::string& dbName)
+            : LMDBKeyValAccess(txn, dbName, true, true, false, false)
+        {
+        }
+
         static IndexAccessInfo parse(const ClassId& classId, const PropertyId& propertyId, const Blob& blob)
         {
             return IndexAccessInfo {
                 classId,
                 propertyId,
                 parseIndexId(blob),
-                parseIsUnique(blob)
+                parseIsUnique(blob),
+                parsePredicate(blob),
+                parseCollation(blob)
             };
         }
 
@@ -594,17 +637,38 @@ namespace schema {
         {
             auto isUnique = uint8_t {};
             blob.retrieve(&isUnique, sizeof(IndexId), sizeof(uint8_t));
-            return isUnique == 1;
+            return (isUnique & 1) == 1;
+        }
+
+        static IndexCollation parseCollation(const Blob& blob)
+        {
+            auto flags = uint8_t {};
+            blob.retrieve(&flags, sizeof(IndexId), sizeof(uint8_t));
+            return static_cast<IndexCollation>((flags >> 1) & 3);
+        }
+
+        static std::string parsePredicate(const Blob& blob)
+        {
+            auto offset = sizeof(IndexId) + sizeof(uint8_t);
+            if (blob.size() <= offset) {
+                return std::string {};
+            }
+            auto predicate = std::string(blob.size() - offset, '\0');
+            blob.retrieve(&predicate[0], offset, predicate.size());
+            return predicate;
         }
 
     private:
         void createOrUpdate(const IndexAccessInfo& props)
         {
-            auto totalLength = sizeof(IndexId) + sizeof(uint8_t);
+            auto totalLength = sizeof(IndexId) + sizeof(uint8_t) + props.predicate.size();
             auto value = Blob(totalLength);
             value.append(&props.id, sizeof(IndexId));
-            auto isUnique = (props.isUnique) ? uint8_t { 1 } : uint8_t { 0 };
-            value.append(&isUnique, sizeof(isUnique));
+            auto flags = static_cast<uint8_t>(((props.isUnique) ? 1 : 0) | (static_cast<uint8_t>(props.collation) << 1));
+            value.append(&flags, sizeof(flags));
+            if (!props.predicate.empty()) {
+                value.append(props.predicate.data(), props.predicate.size());
+            }
             put(buildKey(props.classId, props.propertyId), value);
         }
 
@@ -629,6 +693,201 @@ namespace schema {
         }
     };
 
+    /**
+   * Raw record format in lmdb data storage, the same as of single-property indexes:
+   * {classId<uint16>}{propertyId<uint16>} -> {id<uint16>}{isUnique<uint8>}
+   * where isUnique is always false since a text index keeps a record under many n-grams.
+   */
+    class TextIndexAccess : public IndexAccess {
+    public:
+        TextIndexAccess() = default;
+
+        TextIndexAccess(const storage_engine::LMDBTxn* const txn)
+            : IndexAccess(txn, TB_TEXT_INDEXES)
+        {
+        }
+
+        virtual ~TextIndexAccess() noexcept = default;
+
+        TextIndexAccess(TextIndexAccess&& other) noexcept = default;
+
+        TextIndexAccess& operator=(TextIndexAccess&& other) noexcept = default;
+    };
+
+    /**
+   * Raw record format in lmdb data storage, the same as of single-property indexes:
+   * {classId<uint16>}{propertyId<uint16>} -> {id<uint16>}{isUnique<uint8>}
+   * where classId is the base class whose records and the records of all its subclasses are indexed,
+   * and isUnique is always false.
+   */
+    class PolymorphicIndexAccess : public IndexAccess {
+    public:
+        PolymorphicIndexAccess() = default;
+
+        PolymorphicIndexAccess(const storage_engine::LMDBTxn* const txn)
+            : IndexAccess(txn, TB_POLYMORPHIC_INDEXES)
+        {
+        }
+
+        virtual ~PolymorphicIndexAccess() noexcept = default;
+
+        PolymorphicIndexAccess(PolymorphicIndexAccess&& other) noexcept = default;
+
+        PolymorphicIndexAccess& operator=(PolymorphicIndexAccess&& other) noexcept = default;
+    };
+
+    /**
+   * Raw record format in lmdb data storage:
+   * {classId<uint16>}{indexId<uint32>} -> {isUnique<uint8>}{numProperties<uint16>}[{propertyId<uint16>}]...
+   *   {numIncludedProperties<uint16>}[{propertyId<uint16>}]...
+   */
+    class CompositeIndexAccess : public storage_engine::adapter::LMDBKeyValAccess {
+    public:
+        CompositeIndexAccess() = default;
+
+        CompositeIndexAccess(const storage_engine::LMDBTxn* const txn)
+            : LMDBKeyValAccess(txn, TB_COMPOSITE_INDEXES, true, true, false, false)
+        {
+        }
+
+        virtual ~CompositeIndexAccess() noexcept = default;
+
+        CompositeIndexAccess(CompositeIndexAccess&& other) noexcept = default;
+
+        CompositeIndexAccess& operator=(CompositeIndexAccess&& other) noexcept = default;
+
+        void create(const IndexAccessInfo& props)
+        {
+            if (getInfo(props.classId, props.propertyIds).id == IndexId {}) {
+                createOrUpdate(props);
+            } else {
+                throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_DUPLICATE_INDEX);
+            }
+        }
+
+        void remove(const ClassId& classId, const IndexId& indexId)
+        {
+            auto compositeIndexKey = buildKey(classId, indexId);
+            auto result = get(compositeIndexKey);
+            if (!result.empty) {
+                del(compositeIndexKey);
+            } else {
+                throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_NOEXST_INDEX);
+            }
+        }
+
+        IndexAccessInfo getInfo(const ClassId& classId, const std::vector<PropertyId>& propertyIds) const
+        {
+            for (const auto& indexInfo : getInfos(classId)) {
+                if (indexInfo.propertyIds == propertyIds) {
+                    return indexInfo;
+                }
+            }
+            return IndexAccessInfo {};
+        }
+
+        std::vector<IndexAccessInfo> getInfos(const ClassId& classId) const
+        {
+            auto result = std::vector<IndexAccessInfo> {};
+            auto cursorHandler = cursor();
+            for (auto keyValue = cursorHandler.findRange(buildSearchKeyBegin(classId));
+                 !keyValue.empty();
+                 keyValue = cursorHandler.getNext()) {
+                auto compositeIndexKey = keyValue.key.data.numeric<CompositeIndexKey>();
+                auto classIdKey = getClassIdFromKey(compositeIndexKey);
+                if (classId != classIdKey)
+                    break;
+                result.emplace_back(parse(classIdKey, getIndexIdFromKey(compositeIndexKey), keyValue.val.data.blob()));
+            }
+            return result;
+        }
+
+        std::vector<IndexAccessInfo> getInfos(const ClassId& classId, const PropertyId& propertyId) const
+        {
+            auto result = std::vector<IndexAccessInfo> {};
+            for (const auto& indexInfo : getInfos(classId)) {
+                if (std::find(indexInfo.propertyIds.cbegin(), indexInfo.propertyIds.cend(), propertyId)
+                        != indexInfo.propertyIds.cend()
+                    || std::find(indexInfo.includedPropertyIds.cbegin(), indexInfo.includedPropertyIds.cend(), propertyId)
+                        != indexInfo.includedPropertyIds.cend()) {
+                    result.emplace_back(indexInfo);
+                }
+            }
+            return result;
+        }
+
+    protected:
+        using CompositeIndexKey = uint64_t;
+        using ListSizeType = uint16_t;
+
+        static IndexAccessInfo parse(const ClassId& classId, const IndexId& indexId, const Blob& blob)
+        {
+            auto isUnique = uint8_t {};
+            auto offset = blob.retrieve(&isUnique, 0, sizeof(uint8_t));
+            auto numProperties = ListSizeType {};
+            offset = blob.retrieve(&numProperties, offset, sizeof(ListSizeType));
+            auto propertyIds = std::vector<PropertyId> {};
+            for (auto i = ListSizeType { 0 }; i < numProperties; ++i) {
+                auto propertyId = PropertyId {};
+                offset = blob.retrieve(&propertyId, offset, sizeof(PropertyId));
+                propertyIds.emplace_back(propertyId);
+            }
+            // the included properties are absent from indexes created before they were supported
+            auto includedPropertyIds = std::vector<PropertyId> {};
+            if (offset < blob.size()) {
+                auto numIncludedProperties = ListSizeType {};
+                offset = blob.retrieve(&numIncludedProperties, offset, sizeof(ListSizeType));
+                for (auto i = ListSizeType { 0 }; i < numIncludedProperties; ++i) {
+                    auto propertyId = PropertyId {};
+                    offset = blob.retrieve(&propertyId, offset, sizeof(PropertyId));
+                    includedPropertyIds.emplace_back(propertyId);
+                }
+            }
+            return IndexAccessInfo { classId, propertyIds, indexId, isUnique == 1, includedPropertyIds };
+        }
+
+    private:
+        void createOrUpdate(const IndexAccessInfo& props)
+        {
+            auto totalLength = sizeof(uint8_t) + 2 * sizeof(ListSizeType)
+                + (props.propertyIds.size() + props.includedPropertyIds.size()) * sizeof(PropertyId);
+            auto value = Blob(totalLength);
+            auto isUnique = (props.isUnique) ? uint8_t { 1 } : uint8_t { 0 };
+            value.append(&isUnique, sizeof(isUnique));
+            auto numProperties = static_cast<ListSizeType>(props.propertyIds.size());
+            value.append(&numProperties, sizeof(ListSizeType));
+            for (const auto& propertyId : props.propertyIds) {
+                value.append(&propertyId, sizeof(PropertyId));
+            }
+            auto numIncludedProperties = static_cast<ListSizeType>(props.includedPropertyIds.size());
+            value.append(&numIncludedProperties, sizeof(ListSizeType));
+            for (const auto& propertyId : props.includedPropertyIds) {
+                value.append(&propertyId, sizeof(PropertyId));
+            }
+            put(buildKey(props.classId, props.id), value);
+        }
+
+        CompositeIndexKey buildKey(const ClassId& classId, const IndexId& indexId) const
+        {
+            return CompositeIndexKey { classId } << 32 | indexId;
+        }
+
+        CompositeIndexKey buildSearchKeyBegin(const ClassId& classId) const
+        {
+            return CompositeIndexKey { classId } << 32;
+        }
+
+        ClassId getClassIdFromKey(const CompositeIndexKey& compositeIndexKey) const
+        {
+            return static_cast<ClassId>(compositeIndexKey >> 32);
+        }
+
+        IndexId getIndexIdFromKey(const CompositeIndexKey& compositeIndexKey) const
+        {
+            return static_cast<IndexId>(compositeIndexKey & 0xffffffff);
+        }
+    };
+
 }
 }
 }
\ No newline at end of file
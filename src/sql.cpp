@@ -707,10 +707,12 @@ static int keywordCode(const char* z, int n, int* pType)
             { "EDGE", TK_EDGE },
             { "END", TK_END },
             { "EXISTS", TK_EXISTS },
+            { "EXPLAIN", TK_EXPLAIN },
             { "EXTENDS", TK_EXTENDS },
             { "FROM", TK_FROM },
             { "GROUP", TK_GROUP },
             { "IF", TK_IF },
+            { "INCLUDE", TK_INCLUDE },
             { "INDEX", TK_INDEX },
             { "IS", TK_IS },
             { "LIKE", TK_LIKE },
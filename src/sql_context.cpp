@@ -23,6 +23,7 @@
 #include <functional>
 
 #include "constant.hpp"
+#include "explain.hpp"
 #include "sql.hpp"
 #include "sql_context.hpp"
 #include "sql_parser.h"
@@ -438,11 +439,75 @@ void Context::traverse(const TraverseArgs& args)
     }
 }
 
-void Context::createIndex(const Token& tClassName, const Token& tPropName, const Token& tIndexType)
+void Context::explain(const SelectArgs& args)
+{
+    try {
+        auto queryPlan = QueryPlan {};
+        if (args.from.type == TargetType::CLASS) {
+            auto& className = args.from.get<string>();
+            if (Context::findClassType(this->txn, className) == ClassType::UNDEFINED) {
+                throw NOGDB_CONTEXT_ERROR(NOGDB_CTX_INVALID_CLASSTYPE);
+            }
+            queryPlan = this->findOperation(className, args.where)
+                            .select(Context::getProjectionPropertyNames(args.projections))
+                            .explain();
+        } else {
+            // other targets are evaluated in memory so only the statement as a whole can be measured
+            auto stopwatch = explain::Stopwatch {};
+            auto result = this->selectPrivate(args);
+            auto stage = explain::record(&queryPlan, "SELECT", "", 0, result.size(), stopwatch);
+            queryPlan.actualRows = result.size();
+            queryPlan.elapsedTime = stage->elapsedTime;
+        }
+        this->rc = SQL_OK;
+        this->result = SQL::Result(new QueryPlan(move(queryPlan)));
+    } catch (const Error& e) {
+        this->rc = SQL_ERROR;
+        this->result = SQL::Result(new Error(e));
+    }
+}
+
+void Context::explain(const TraverseArgs& args)
+{
+    try {
+        auto queryPlan = this->traverseOperation(args).explain();
+        this->rc = SQL_OK;
+        this->result = SQL::Result(new QueryPlan(move(queryPlan)));
+    } catch (const Error& e) {
+        this->rc = SQL_ERROR;
+        this->result = SQL::Result(new Error(e));
+    }
+}
+
+void Context::createIndex(const Token& tClassName,
+    const Token& tPropName,
+    const Token& tIndexType,
+    const std::vector<std::string>& includedPropNames)
+{
+    try {
+        bool unique = stringcasecmp(tIndexType.toString(), "UNIQUE") == 0 ? true : false;
+        if (includedPropNames.empty()) {
+            this->txn.addIndex(tClassName.toString(), tPropName.toString(), unique);
+        } else {
+            this->txn.addIndex(tClassName.toString(), { tPropName.toString() }, unique, includedPropNames);
+        }
+
+        this->rc = SQL_OK;
+        this->result = SQL::Result();
+    } catch (const Error& e) {
+        this->rc = SQL_ERROR;
+        this->result = SQL::Result(new Error(e));
+    }
+}
+
+void Context::createIndex(const Token& tClassName,
+    const std::vector<std::string>& propNames,
+    const Token& tIndexType,
+    const std::vector<std::string>& includedPropNames)
 {
     try {
         bool unique = stringcasecmp(tIndexType.toString(), "UNIQUE") == 0 ? true : false;
-        this->txn.addIndex(tClassName.toString(), tPropName.toString(), unique);
+        this->txn.addIndex(tClassName.toString(), propNames, unique, includedPropNames);
 
         this->rc = SQL_OK;
         this->result = SQL::Result();
@@ -465,11 +530,25 @@ void Context::dropIndex(const Token& tClassName, const Token& tPropName)
     }
 }
 
+void Context::dropIndex(const Token& tClassName, const std::vector<std::string>& propNames)
+{
+    try {
+        this->txn.dropIndex(tClassName.toString(), propNames);
+
+        this->rc = SQL_OK;
+        this->result = SQL::Result();
+    } catch (const Error& e) {
+        this->rc = SQL_ERROR;
+        this->result = SQL::Result(new Error(e));
+    }
+}
+
 #pragma mark-- private
 
 ResultSet Context::selectPrivate(const SelectArgs& stmt)
 {
-    ResultSet result = this->select(stmt.from, stmt.where, stmt.skip, stmt.limit);
+    ResultSet result = this->select(
+        stmt.from, stmt.where, stmt.skip, stmt.limit, Context::getProjectionPropertyNames(stmt.projections));
     result = this->selectProjection(result, stmt.projections);
     return this->selectGroupBy(result, stmt.group);
 }
@@ -480,6 +559,11 @@ ResultSet Context::select(const Target& target, const Where& where)
 }
 
 ResultSet Context::select(const Target& target, const Where& where, int skip, int limit)
+{
+    return this->select(target, where, skip, limit, vector<string> {});
+}
+
+ResultSet Context::select(const Target& target, const Where& where, int skip, int limit, const vector<string>& propNames)
 {
     switch (target.type) {
     case TargetType::NO_TARGET:
@@ -488,7 +572,11 @@ ResultSet Context::select(const Target& target, const Where& where, int skip, in
     case TargetType::CLASS: {
         string& className = target.get<string>();
         ClassType type = Context::findClassType(this->txn, className);
-        if (type == ClassType::VERTEX) {
+        if (type != ClassType::UNDEFINED && !propNames.empty()) {
+            // only the projected properties are read, so that a covering index may answer them alone
+            ResultSet result = this->findOperation(className, where).select(propNames).get();
+            return result.limit(skip, limit);
+        } else if (type == ClassType::VERTEX) {
             ResultSetCursor res = this->selectVertex(className, where);
             return ResultSet(res, skip, limit);
         } else if (type == ClassType::EDGE) {
@@ -541,27 +629,24 @@ ResultSet Context::select(const RecordDescriptorSet& rids)
 
 nogdb::ResultSetCursor Context::selectVertex(const string& className, const Where& where)
 {
-    switch (where.type) {
-    case WhereType::CONDITION:
-        return this->txn.find(className).where(where.get<Condition>()).getCursor();
-    case WhereType::MULTI_COND:
-        return this->txn.find(className).where(where.get<MultiCondition>()).getCursor();
-    case WhereType::NO_COND:
-    default:
-        return this->txn.find(className).getCursor();
-    }
+    return this->findOperation(className, where).getCursor();
 }
 
 nogdb::ResultSetCursor Context::selectEdge(const string& className, const Where& where)
+{
+    return this->findOperation(className, where).getCursor();
+}
+
+nogdb::FindOperationBuilder Context::findOperation(const string& className, const Where& where)
 {
     switch (where.type) {
     case WhereType::CONDITION:
-        return this->txn.find(className).where(where.get<Condition>()).getCursor();
+        return this->txn.find(className).where(where.get<Condition>());
     case WhereType::MULTI_COND:
-        return this->txn.find(className).where(where.get<MultiCondition>()).getCursor();
+        return this->txn.find(className).where(where.get<MultiCondition>());
     case WhereType::NO_COND:
     default:
-        return this->txn.find(className).getCursor();
+        return this->txn.find(className);
     }
 }
 
@@ -635,6 +720,18 @@ ResultSet Context::selectProjection(ResultSet& input, const vector<Projection> p
     }
 }
 
+vector<string> Context::getProjectionPropertyNames(const vector<Projection>& projs)
+{
+    auto propNames = vector<string> {};
+    for (const Projection& proj : projs) {
+        if (proj.type != ProjectionType::PROPERTY || proj.get<string>().empty() || proj.get<string>()[0] == '@') {
+            return vector<string> {};
+        }
+        propNames.emplace_back(proj.get<string>());
+    }
+    return propNames;
+}
+
 ResultSet Context::selectGroupBy(ResultSet& input, const string& group)
 {
     if (group.empty()) {
@@ -653,6 +750,11 @@ ResultSet Context::selectGroupBy(ResultSet& input, const string& group)
 }
 
 ResultSet Context::traversePrivate(const TraverseArgs& args)
+{
+    return this->traverseOperation(args).get();
+}
+
+nogdb::TraverseOperationBuilder Context::traverseOperation(const TraverseArgs& args)
 {
     if (args.minDepth < 0 || args.minDepth > UINT_MAX) {
         throw NOGDB_SQL_ERROR(NOGDB_SQL_INVALID_TRAVERSE_MIN_DEPTH);
@@ -674,8 +776,7 @@ ResultSet Context::traversePrivate(const TraverseArgs& args)
             return traverse
                 .minDepth(args.minDepth)
                 .maxDepth(args.maxDepth)
-                .whereE(GraphFilter {}.only(args.filter))
-                .get();
+                .whereE(GraphFilter {}.only(args.filter));
         } else if (func == "OUTDEPTH_FIRST" || func == "OUTBREADTH_FIRST") {
             auto traverse = this->txn.traverseOut(*args.root.begin());
             if (args.root.size() > 1) {
@@ -686,8 +787,7 @@ ResultSet Context::traversePrivate(const TraverseArgs& args)
             return traverse
                 .minDepth(args.minDepth)
                 .maxDepth(args.maxDepth)
-                .whereE(GraphFilter {}.only(args.filter))
-                .get();
+                .whereE(GraphFilter {}.only(args.filter));
         } else if (func == "ALLDEPTH_FIRST" || func == "ALLBREADTH_FIRST") {
             auto traverse = this->txn.traverse(*args.root.begin());
             if (args.root.size() > 1) {
@@ -698,8 +798,7 @@ ResultSet Context::traversePrivate(const TraverseArgs& args)
             return traverse
                 .minDepth(args.minDepth)
                 .maxDepth(args.maxDepth)
-                .whereE(GraphFilter {}.only(args.filter))
-                .get();
+                .whereE(GraphFilter {}.only(args.filter));
         } else {
             throw 0;
         }
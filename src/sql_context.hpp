@@ -97,11 +97,26 @@ namespace sql_parser {
         // TRAVERSE operations
         void traverse(const TraverseArgs& args);
 
+        // EXPLAIN operations
+        void explain(const SelectArgs& args);
+
+        void explain(const TraverseArgs& args);
+
         // INDEX operations
-        void createIndex(const Token& tClassName, const Token& tPropName, const Token& tIndexType);
+        void createIndex(const Token& tClassName,
+            const Token& tPropName,
+            const Token& tIndexType,
+            const std::vector<std::string>& includedPropNames);
+
+        void createIndex(const Token& tClassName,
+            const std::vector<std::string>& propNames,
+            const Token& tIndexType,
+            const std::vector<std::string>& includedPropNames);
 
         void dropIndex(const Token& tClassName, const Token& tPropName);
 
+        void dropIndex(const Token& tClassName, const std::vector<std::string>& propNames);
+
     private:
         void newTxnIfRootStmt(bool isRoot, TxnMode mode);
 
@@ -115,20 +130,33 @@ namespace sql_parser {
 
         ResultSet select(const Target& target, const Where& where, int skip, int limit);
 
+        ResultSet select(const Target& target,
+            const Where& where,
+            int skip,
+            int limit,
+            const vector<string>& propNames);
+
         ResultSet select(const RecordDescriptorSet& rids);
 
         ResultSetCursor selectVertex(const string& className, const Where& where);
 
         ResultSetCursor selectEdge(const string& className, const Where& where);
 
+        FindOperationBuilder findOperation(const string& className, const Where& where);
+
         ResultSet selectWhere(ResultSet& input, const Where& where);
 
         ResultSet selectProjection(ResultSet& input, const vector<Projection> projs);
 
+        // the names of the projected properties if the projection consists of nothing else, or none
+        static vector<string> getProjectionPropertyNames(const vector<Projection>& projs);
+
         ResultSet selectGroupBy(ResultSet& input, const string& group);
 
         ResultSet traversePrivate(const TraverseArgs& stmt);
 
+        TraverseOperationBuilder traverseOperation(const TraverseArgs& stmt);
+
         static Bytes getProjectionItem(Transaction& txn, const Result& input, const Projection& proj, const PropertyMapType& map);
 
         static Bytes
@@ -129,6 +129,9 @@ create_edge_stmt(A) ::= CREATE EDGE name(name) FROM select_target_without_class(
 cmd ::= select_stmt(stmt) SEMI. {
     this->select(stmt);
 }
+cmd ::= EXPLAIN select_stmt(stmt) SEMI. {
+    this->explain(stmt);
+}
 
 %type select_stmt { SelectArgs }
 select_stmt(A) ::= SELECT projections(proj) from_opt(from) where_opt(where) group_by(group) order_by(order) skip(skip) limit(limit). {
@@ -306,6 +309,9 @@ to_edge_opt(A) ::= TO select_target_without_class(X). { A = X; }
 cmd ::= traverse_stmt(stmt) SEMI. {
     this->traverse(stmt);
 }
+cmd ::= EXPLAIN traverse_stmt(stmt) SEMI. {
+    this->explain(stmt);
+}
 
 %type traverse_stmt { TraverseArgs }
 traverse_stmt(A) ::= TRAVERSE
@@ -335,19 +341,29 @@ strategy_opt(A) ::= STRATEGY IDENTITY(X). { A = X.toString(); }
 
 //////////////////// The INDEX command ////////////////////
 // CREATE
-cmd ::= CREATE INDEX name(className) DOT name(propName) index_type(type) SEMI. {
-    this->createIndex(className, propName, type);
+cmd ::= CREATE INDEX name(className) DOT name(propName) index_type(type) include_opt(includedPropNames) SEMI. {
+    this->createIndex(className, propName, type, includedPropNames);
+}
+cmd ::= CREATE INDEX name(className) LP name_list(propNames) RP index_type(type) include_opt(includedPropNames) SEMI. {
+    this->createIndex(className, propNames, type, includedPropNames);
 }
 
 // DROP
 cmd ::= DROP INDEX name(className) DOT name(propName) SEMI. {
     this->dropIndex(className, propName);
 }
+cmd ::= DROP INDEX name(className) LP name_list(propNames) RP SEMI. {
+    this->dropIndex(className, propNames);
+}
 
 
 index_type ::= .
 index_type(A) ::= IDENTITY(X). { A = X; }
 
+%type include_opt { vector<string> }
+include_opt(A) ::= . { A = vector<string>{}; }
+include_opt(A) ::= INCLUDE LP name_list(X) RP. { A = X; }
+
 
 //////////////////// Other options ////////////////////
 // if (not) exists
@@ -392,6 +408,11 @@ rid_set(A) ::= rid(X). { A = RecordDescriptorSet{X}; }
 name_set(A) ::= name_set(A) COMMA name(X). { A.insert(X.toString()); }
 name_set(A) ::= name(X). { A = set<string>{X.toString()}; }
 
+// name_list
+%type name_list { vector<string> }
+name_list(A) ::= name_list(A) COMMA name(X). { A.push_back(X.toString()); }
+name_list(A) ::= name(X). { A = vector<string>{X.toString()}; }
+
 // term_list
 %type term_list { vector<Bytes> }
 term_list(A) ::= term_list(A) COMMA term(X). { A.push_back(move(X)); }
@@ -0,0 +1,354 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <random>
+
+#include "constant.hpp"
+#include "datarecord_adapter.hpp"
+#include "parser.hpp"
+#include "schema.hpp"
+#include "statistics.hpp"
+
+namespace nogdb {
+namespace statistics {
+    using namespace adapter::datarecord;
+    using namespace schema;
+    using parser::RecordParser;
+
+    namespace {
+
+        template <typename T>
+        int compareValue(const T& lhs, const T& rhs)
+        {
+            return (lhs < rhs) ? -1 : ((rhs < lhs) ? 1 : 0);
+        }
+
+        // doubles are ordered by the IEEE-754 total order like the keys of REAL indexes, in which
+        // NaN is below -inf or above +inf instead of being unordered, and a negative zero is zero
+        uint64_t toOrderedBits(double value)
+        {
+            constexpr auto signBit = uint64_t { 1 } << 63;
+            auto bits = uint64_t {};
+            value = (value == 0.0) ? 0.0 : value;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return (bits & signBit) ? ~bits : (bits | signBit);
+        }
+
+        // the non-null values of a property seen so far and a uniform sample of them
+        struct ValueSample {
+            std::vector<Bytes> values {};
+            uint64_t count { 0 };
+        };
+
+        // the part of a total which falls below a position of a sample, scaled from the sample size
+        uint64_t scaleCount(uint64_t position, uint64_t sampleSize, uint64_t total)
+        {
+            return static_cast<uint64_t>(static_cast<double>(position) * total / sampleSize + 0.5);
+        }
+
+    }
+
+    ClassStatistics StatisticsUtils::analyze(const Transaction *txn, const ClassAccessInfo& classInfo)
+    {
+        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
+        auto propertyValues = std::map<PropertyId, ValueSample> {};
+        for (const auto& property : propertyIdMapInfo) {
+            if (property.first >= INIT_NUM_PROPERTIES && property.second.type != PropertyType::BLOB) {
+                propertyValues.emplace(property.first, ValueSample {});
+            }
+        }
+
+        // reservoir sampling with a fixed seed, so that analyzing the same records gives the same statistics
+        auto random = std::mt19937_64 {};
+        auto rowCount = uint64_t { 0 };
+        auto dataRecord = DataRecord(txn->_txnBase, classInfo.id, classInfo.type);
+        std::function<void(const PositionId&, const storage_engine::lmdb::Result&)> callback =
+            [&](const PositionId& positionId, const storage_engine::lmdb::Result& result) {
+                auto const record = RecordParser::parseRawData(
+                    result, propertyIdMapInfo, classInfo.type == ClassType::EDGE, txn->_txnCtx->isVersionEnabled());
+                for (auto& values : propertyValues) {
+                    auto bytesValue = record.get(propertyIdMapInfo.at(values.first).name);
+                    if (bytesValue.empty()) {
+                        continue;
+                    }
+                    auto& sample = values.second;
+                    if (sample.values.size() < STATISTICS_SAMPLE_SIZE) {
+                        sample.values.emplace_back(std::move(bytesValue));
+                    } else {
+                        auto position = std::uniform_int_distribution<uint64_t> { 0, sample.count }(random);
+                        if (position < STATISTICS_SAMPLE_SIZE) {
+                            sample.values[position] = std::move(bytesValue);
+                        }
+                    }
+                    ++sample.count;
+                }
+                ++rowCount;
+            };
+        dataRecord.resultSetIter(callback);
+
+        auto statisticsAccess = txn->_adapter->dbStatistics();
+        statisticsAccess->remove(classInfo.id);
+        for (auto& values : propertyValues) {
+            auto statistics = buildStatistics(
+                propertyIdMapInfo.at(values.first), values.second.values, values.second.count, rowCount);
+            statisticsAccess->createOrUpdate(classInfo.id, statistics);
+        }
+        return getStatistics(txn, classInfo);
+    }
+
+    ClassStatistics StatisticsUtils::getStatistics(const Transaction *txn, const ClassAccessInfo& classInfo)
+    {
+        auto result = ClassStatistics {};
+        result.classId = classInfo.id;
+        result.className = classInfo.name;
+        result.rowCount = DataRecord(txn->_txnBase, classInfo.id, classInfo.type).count();
+        auto propertyIdMapInfo = SchemaUtils::getPropertyIdMapInfo(txn, classInfo.id, classInfo.superClassId);
+        for (auto& statistics : txn->_adapter->dbStatistics()->getInfos(classInfo.id)) {
+            auto foundProperty = propertyIdMapInfo.find(statistics.propertyId);
+            if (foundProperty == propertyIdMapInfo.cend()) {
+                continue;
+            }
+            statistics.propertyName = foundProperty->second.name;
+            statistics.type = foundProperty->second.type;
+            statistics.indexId = txn->_adapter->dbIndex()->getInfo(classInfo.id, statistics.propertyId).id;
+            result.properties.emplace_back(std::move(statistics));
+        }
+        return result;
+    }
+
+    PropertyStatistics StatisticsUtils::getStatistics(const Transaction *txn,
+        const ClassId& classId,
+        const PropertyId& propertyId)
+    {
+        return txn->_adapter->dbStatistics()->getInfo(classId, propertyId);
+    }
+
+    void StatisticsUtils::remove(const Transaction *txn, const ClassId& classId)
+    {
+        txn->_adapter->dbStatistics()->remove(classId);
+    }
+
+    void StatisticsUtils::remove(const Transaction *txn, const ClassId& classId, const PropertyId& propertyId)
+    {
+        txn->_adapter->dbStatistics()->remove(classId, propertyId);
+    }
+
+    double StatisticsUtils::estimateEqual(const PropertyStatistics& statistics, const Bytes& value)
+    {
+        auto nonNullCount = statistics.rowCount - statistics.nullCount;
+        if (nonNullCount == 0 || statistics.histogram.empty()) {
+            return 0.0;
+        }
+        auto mostCommonCount = uint64_t { 0 };
+        for (const auto& mostCommonValue : statistics.mostCommonValues) {
+            if (compare(mostCommonValue.first, value, statistics.type) == 0) {
+                return static_cast<double>(mostCommonValue.second) / nonNullCount;
+            }
+            mostCommonCount += mostCommonValue.second;
+        }
+        if (compare(value, statistics.histogram.front().lowerBound, statistics.type) < 0
+            || compare(value, statistics.histogram.back().upperBound, statistics.type) > 0) {
+            return 0.0;
+        }
+        auto remainingDistinct = statistics.distinctCount - statistics.mostCommonValues.size();
+        if (remainingDistinct == 0) {
+            return 0.0;
+        }
+        return static_cast<double>(nonNullCount - mostCommonCount) / remainingDistinct / nonNullCount;
+    }
+
+    double StatisticsUtils::estimateRange(const PropertyStatistics& statistics,
+        const Bytes* lower,
+        const Bytes* upper,
+        bool includeLower,
+        bool includeUpper)
+    {
+        auto nonNullCount = statistics.rowCount - statistics.nullCount;
+        if (nonNullCount == 0) {
+            return 0.0;
+        }
+        auto& type = statistics.type;
+        auto isNumeric = type != PropertyType::TEXT;
+        auto estimatedCount = 0.0;
+        for (const auto& bucket : statistics.histogram) {
+            if (upper) {
+                auto cmpUpper = compare(bucket.lowerBound, *upper, type);
+                if (cmpUpper > 0 || (cmpUpper == 0 && !includeUpper)) {
+                    break;
+                }
+            }
+            if (lower) {
+                auto cmpLower = compare(bucket.upperBound, *lower, type);
+                if (cmpLower < 0 || (cmpLower == 0 && !includeLower)) {
+                    continue;
+                }
+            }
+            auto isCutLower = lower && compare(*lower, bucket.lowerBound, type) > 0;
+            auto isCutUpper = upper && compare(*upper, bucket.upperBound, type) < 0;
+            auto fraction = 1.0;
+            if (isCutLower || isCutUpper) {
+                if (isNumeric) {
+                    // assume values are uniformly spread between the bucket bounds
+                    auto bucketLower = toNumeric(bucket.lowerBound, type);
+                    auto bucketUpper = toNumeric(bucket.upperBound, type);
+                    auto rangeLower = (isCutLower) ? toNumeric(*lower, type) : bucketLower;
+                    auto rangeUpper = (isCutUpper) ? toNumeric(*upper, type) : bucketUpper;
+                    fraction = (bucketUpper > bucketLower) ? (rangeUpper - rangeLower) / (bucketUpper - bucketLower) : 1.0;
+                } else {
+                    fraction = (isCutLower && isCutUpper) ? 0.25 : 0.5;
+                }
+            }
+            estimatedCount += std::max(0.0, std::min(1.0, fraction)) * bucket.count;
+        }
+        return estimatedCount / nonNullCount;
+    }
+
+    int StatisticsUtils::compare(const Bytes& lhs, const Bytes& rhs, const PropertyType& type)
+    {
+        switch (type) {
+        case PropertyType::TINYINT:
+            return compareValue(lhs.toTinyInt(), rhs.toTinyInt());
+        case PropertyType::UNSIGNED_TINYINT:
+            return compareValue(lhs.toTinyIntU(), rhs.toTinyIntU());
+        case PropertyType::SMALLINT:
+            return compareValue(lhs.toSmallInt(), rhs.toSmallInt());
+        case PropertyType::UNSIGNED_SMALLINT:
+            return compareValue(lhs.toSmallIntU(), rhs.toSmallIntU());
+        case PropertyType::INTEGER:
+            return compareValue(lhs.toInt(), rhs.toInt());
+        case PropertyType::UNSIGNED_INTEGER:
+            return compareValue(lhs.toIntU(), rhs.toIntU());
+        case PropertyType::BIGINT:
+            return compareValue(lhs.toBigInt(), rhs.toBigInt());
+        case PropertyType::UNSIGNED_BIGINT:
+            return compareValue(lhs.toBigIntU(), rhs.toBigIntU());
+        case PropertyType::REAL:
+            return compareValue(toOrderedBits(lhs.toReal()), toOrderedBits(rhs.toReal()));
+        case PropertyType::TEXT:
+            return compareValue(lhs.toText(), rhs.toText());
+        default:
+            return 0;
+        }
+    }
+
+    PropertyStatistics StatisticsUtils::buildStatistics(const PropertyAccessInfo& propertyInfo,
+        std::vector<Bytes>& values,
+        uint64_t nonNullCount,
+        uint64_t rowCount)
+    {
+        auto statistics = PropertyStatistics {};
+        statistics.propertyId = propertyInfo.id;
+        statistics.propertyName = propertyInfo.name;
+        statistics.type = propertyInfo.type;
+        statistics.rowCount = rowCount;
+        statistics.nullCount = rowCount - nonNullCount;
+        if (values.empty()) {
+            return statistics;
+        }
+
+        auto& type = propertyInfo.type;
+        std::sort(values.begin(), values.end(), [&type](const Bytes& lhs, const Bytes& rhs) {
+            return compare(lhs, rhs, type) < 0;
+        });
+        // runs of equal values as {first index, length}
+        auto runs = std::vector<std::pair<size_t, uint64_t>> {};
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (runs.empty() || compare(values[runs.back().first], values[i], type) != 0) {
+                runs.emplace_back(i, 0);
+            }
+            ++runs.back().second;
+        }
+        statistics.distinctCount = runs.size();
+        if (values.size() < nonNullCount) {
+            // the estimator of Haas and Stokes, which is also used by PostgreSQL
+            auto singles = std::count_if(runs.cbegin(), runs.cend(), [](const std::pair<size_t, uint64_t>& run) {
+                return run.second == 1;
+            });
+            auto sampleSize = static_cast<double>(values.size());
+            auto estimate = sampleSize * runs.size()
+                / (sampleSize - singles + singles * sampleSize / nonNullCount);
+            statistics.distinctCount = std::min(nonNullCount,
+                std::max(static_cast<uint64_t>(runs.size()), static_cast<uint64_t>(estimate + 0.5)));
+        }
+
+        // values noticeably more frequent than the average are kept as most common values
+        auto mostCommonRuns = std::vector<std::pair<size_t, uint64_t>> {};
+        for (const auto& run : runs) {
+            if (run.second > 1 && run.second * runs.size() > values.size()) {
+                mostCommonRuns.emplace_back(run);
+            }
+        }
+        std::stable_sort(mostCommonRuns.begin(), mostCommonRuns.end(),
+            [](const std::pair<size_t, uint64_t>& lhs, const std::pair<size_t, uint64_t>& rhs) {
+                return lhs.second > rhs.second;
+            });
+        if (mostCommonRuns.size() > STATISTICS_MOST_COMMON_VALUES) {
+            mostCommonRuns.resize(STATISTICS_MOST_COMMON_VALUES);
+        }
+        for (const auto& run : mostCommonRuns) {
+            statistics.mostCommonValues.emplace_back(
+                values[run.first], std::max(uint64_t { 1 }, scaleCount(run.second, values.size(), nonNullCount)));
+        }
+
+        // equi-depth buckets never split a run of equal values, and their counts are scaled by their
+        // positions in the sample so that they add up to the non-null and distinct counts
+        auto numBuckets = std::min(STATISTICS_HISTOGRAM_BUCKETS, runs.size());
+        auto depth = (values.size() + numBuckets - 1) / numBuckets;
+        auto bucket = HistogramBucket {};
+        auto sampleCount = uint64_t { 0 };
+        auto bucketStart = std::make_pair(uint64_t { 0 }, uint64_t { 0 });
+        auto runCount = uint64_t { 0 };
+        auto addBucket = [&]() {
+            bucket.count = scaleCount(sampleCount, values.size(), nonNullCount)
+                - scaleCount(bucketStart.first, values.size(), nonNullCount);
+            bucket.distinctCount = scaleCount(runCount, runs.size(), statistics.distinctCount)
+                - scaleCount(bucketStart.second, runs.size(), statistics.distinctCount);
+            statistics.histogram.emplace_back(bucket);
+            bucket = HistogramBucket {};
+            bucketStart = std::make_pair(sampleCount, runCount);
+        };
+        for (const auto& run : runs) {
+            if (sampleCount == bucketStart.first) {
+                bucket.lowerBound = values[run.first];
+            }
+            bucket.upperBound = values[run.first];
+            sampleCount += run.second;
+            ++runCount;
+            if (sampleCount - bucketStart.first >= depth) {
+                addBucket();
+            }
+        }
+        if (sampleCount > bucketStart.first) {
+            addBucket();
+        }
+        return statistics;
+    }
+
+    double StatisticsUtils::toNumeric(const Bytes& value, const PropertyType& type)
+    {
+        return RecordParser::parseNumericValue(value, type);
+    }
+
+}
+}
@@ -0,0 +1,87 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "schema_adapter.hpp"
+#include "statistics_adapter.hpp"
+
+#include "nogdb/nogdb.h"
+#include "nogdb/nogdb_types.h"
+
+namespace nogdb {
+namespace statistics {
+    using namespace adapter::schema;
+
+    struct StatisticsUtils {
+
+        /**
+         * Scan all records of a class once and rebuild the null counts, distinct counts,
+         * most common values and equi-depth histograms of its (native and inherited) properties.
+         * Null counts are exact while the rest is built from a sample of at most STATISTICS_SAMPLE_SIZE
+         * values per property, so that the memory needed does not grow with the number of records.
+         */
+        static ClassStatistics analyze(const Transaction *txn, const ClassAccessInfo& classInfo);
+
+        static ClassStatistics getStatistics(const Transaction *txn, const ClassAccessInfo& classInfo);
+
+        static PropertyStatistics getStatistics(const Transaction *txn,
+            const ClassId& classId,
+            const PropertyId& propertyId);
+
+        static void remove(const Transaction *txn, const ClassId& classId);
+
+        static void remove(const Transaction *txn, const ClassId& classId, const PropertyId& propertyId);
+
+        /**
+         * Estimated fraction of the non-null values of an analyzed property which are equal to the value.
+         */
+        static double estimateEqual(const PropertyStatistics& statistics, const Bytes& value);
+
+        /**
+         * Estimated fraction of the non-null values of an analyzed property which fall in the range.
+         * A null bound means that the range is unbounded on that side.
+         */
+        static double estimateRange(const PropertyStatistics& statistics,
+            const Bytes* lower,
+            const Bytes* upper,
+            bool includeLower,
+            bool includeUpper);
+
+        static int compare(const Bytes& lhs, const Bytes& rhs, const PropertyType& type);
+
+    private:
+        static double toNumeric(const Bytes& value, const PropertyType& type);
+
+        /**
+         * Counts taken from the sample are scaled up to the non-null values it was drawn from, and
+         * the distinct count is estimated from the values seen only once in the sample.
+         */
+        static PropertyStatistics buildStatistics(const PropertyAccessInfo& propertyInfo,
+            std::vector<Bytes>& values,
+            uint64_t nonNullCount,
+            uint64_t rowCount);
+    };
+
+}
+}
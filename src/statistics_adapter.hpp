@@ -0,0 +1,220 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "constant.hpp"
+#include "datatype.hpp"
+#include "storage_adapter.hpp"
+
+#include "nogdb/nogdb_types.h"
+
+namespace nogdb {
+namespace adapter {
+namespace metadata {
+    using namespace internal_data_type;
+
+    /**
+     * Raw record format in lmdb data storage:
+     * {classId<uint16>}{propertyId<uint16>} ->
+     *   {rowCount<uint64>}{nullCount<uint64>}{distinctCount<uint64>}
+     *   {numMostCommonValues<uint16>}[{size<uint32>}{value}{count<uint64>}]...
+     *   {numBuckets<uint16>}[{size<uint32>}{lowerBound}{size<uint32>}{upperBound}{count<uint64>}{distinctCount<uint64>}]...
+     */
+    class StatisticsAccess : public storage_engine::adapter::LMDBKeyValAccess {
+    public:
+        StatisticsAccess() = default;
+
+        StatisticsAccess(const storage_engine::LMDBTxn* const txn)
+            : LMDBKeyValAccess(txn, TB_STATISTICS, true, true, false, true)
+        {
+        }
+
+        virtual ~StatisticsAccess() noexcept = default;
+
+        StatisticsAccess(StatisticsAccess&& other) noexcept = default;
+
+        StatisticsAccess& operator=(StatisticsAccess&& other) noexcept = default;
+
+        void createOrUpdate(const ClassId& classId, const PropertyStatistics& props)
+        {
+            put(buildKey(classId, props.propertyId), serialize(props));
+        }
+
+        void remove(const ClassId& classId, const PropertyId& propertyId)
+        {
+            auto statisticsKey = buildKey(classId, propertyId);
+            if (!get(statisticsKey).empty) {
+                del(statisticsKey);
+            }
+        }
+
+        void remove(const ClassId& classId)
+        {
+            auto statisticsKeys = std::vector<StatisticsKey> {};
+            auto cursorHandler = cursor();
+            for (auto keyValue = cursorHandler.findRange(buildSearchKeyBegin(classId));
+                 !keyValue.empty();
+                 keyValue = cursorHandler.getNext()) {
+                auto statisticsKey = keyValue.key.data.numeric<StatisticsKey>();
+                if (classId != getClassIdFromKey(statisticsKey))
+                    break;
+                statisticsKeys.emplace_back(statisticsKey);
+            }
+            for (const auto& statisticsKey : statisticsKeys) {
+                del(statisticsKey);
+            }
+        }
+
+        PropertyStatistics getInfo(const ClassId& classId, const PropertyId& propertyId) const
+        {
+            auto result = get(buildKey(classId, propertyId));
+            if (result.empty) {
+                return PropertyStatistics {};
+            } else {
+                return parse(propertyId, result.data.blob());
+            }
+        }
+
+        std::vector<PropertyStatistics> getInfos(const ClassId& classId) const
+        {
+            auto result = std::vector<PropertyStatistics> {};
+            auto cursorHandler = cursor();
+            for (auto keyValue = cursorHandler.findRange(buildSearchKeyBegin(classId));
+                 !keyValue.empty();
+                 keyValue = cursorHandler.getNext()) {
+                auto statisticsKey = keyValue.key.data.numeric<StatisticsKey>();
+                if (classId != getClassIdFromKey(statisticsKey))
+                    break;
+                result.emplace_back(parse(getPropertyIdFromKey(statisticsKey), keyValue.val.data.blob()));
+            }
+            return result;
+        }
+
+    protected:
+        using StatisticsKey = uint32_t;
+        using ValueSizeType = uint32_t;
+        using ListSizeType = uint16_t;
+
+        static Blob serialize(const PropertyStatistics& props)
+        {
+            auto totalLength = 3 * sizeof(uint64_t) + 2 * sizeof(ListSizeType);
+            for (const auto& mostCommonValue : props.mostCommonValues) {
+                totalLength += sizeof(ValueSizeType) + mostCommonValue.first.size() + sizeof(uint64_t);
+            }
+            for (const auto& bucket : props.histogram) {
+                totalLength += 2 * sizeof(ValueSizeType) + bucket.lowerBound.size() + bucket.upperBound.size()
+                    + 2 * sizeof(uint64_t);
+            }
+            auto value = Blob(totalLength);
+            value.append(&props.rowCount, sizeof(uint64_t));
+            value.append(&props.nullCount, sizeof(uint64_t));
+            value.append(&props.distinctCount, sizeof(uint64_t));
+            auto numMostCommonValues = static_cast<ListSizeType>(props.mostCommonValues.size());
+            value.append(&numMostCommonValues, sizeof(ListSizeType));
+            for (const auto& mostCommonValue : props.mostCommonValues) {
+                appendBytes(value, mostCommonValue.first);
+                value.append(&mostCommonValue.second, sizeof(uint64_t));
+            }
+            auto numBuckets = static_cast<ListSizeType>(props.histogram.size());
+            value.append(&numBuckets, sizeof(ListSizeType));
+            for (const auto& bucket : props.histogram) {
+                appendBytes(value, bucket.lowerBound);
+                appendBytes(value, bucket.upperBound);
+                value.append(&bucket.count, sizeof(uint64_t));
+                value.append(&bucket.distinctCount, sizeof(uint64_t));
+            }
+            return value;
+        }
+
+        static PropertyStatistics parse(const PropertyId& propertyId, const Blob& blob)
+        {
+            auto props = PropertyStatistics {};
+            props.propertyId = propertyId;
+            auto offset = blob.retrieve(&props.rowCount, 0, sizeof(uint64_t));
+            offset = blob.retrieve(&props.nullCount, offset, sizeof(uint64_t));
+            offset = blob.retrieve(&props.distinctCount, offset, sizeof(uint64_t));
+            auto numMostCommonValues = ListSizeType {};
+            offset = blob.retrieve(&numMostCommonValues, offset, sizeof(ListSizeType));
+            for (auto i = ListSizeType { 0 }; i < numMostCommonValues; ++i) {
+                auto bytes = retrieveBytes(blob, offset);
+                auto count = uint64_t {};
+                offset = blob.retrieve(&count, offset, sizeof(uint64_t));
+                props.mostCommonValues.emplace_back(bytes, count);
+            }
+            auto numBuckets = ListSizeType {};
+            offset = blob.retrieve(&numBuckets, offset, sizeof(ListSizeType));
+            for (auto i = ListSizeType { 0 }; i < numBuckets; ++i) {
+                auto bucket = HistogramBucket {};
+                bucket.lowerBound = retrieveBytes(blob, offset);
+                bucket.upperBound = retrieveBytes(blob, offset);
+                offset = blob.retrieve(&bucket.count, offset, sizeof(uint64_t));
+                offset = blob.retrieve(&bucket.distinctCount, offset, sizeof(uint64_t));
+                props.histogram.emplace_back(bucket);
+            }
+            return props;
+        }
+
+    private:
+        static void appendBytes(Blob& blob, const Bytes& bytes)
+        {
+            auto size = static_cast<ValueSizeType>(bytes.size());
+            blob.append(&size, sizeof(ValueSizeType));
+            if (size > 0) {
+                blob.append(bytes.getRaw(), size);
+            }
+        }
+
+        static Bytes retrieveBytes(const Blob& blob, size_t& offset)
+        {
+            auto size = ValueSizeType {};
+            offset = blob.retrieve(&size, offset, sizeof(ValueSizeType));
+            auto bytes = Bytes { blob.bytes() + offset, size };
+            offset += size;
+            return bytes;
+        }
+
+        StatisticsKey buildKey(const ClassId& classId, const PropertyId& propertyId) const
+        {
+            return classId << 16 | propertyId;
+        }
+
+        StatisticsKey buildSearchKeyBegin(const ClassId& classId) const
+        {
+            return classId << 16;
+        }
+
+        ClassId getClassIdFromKey(const StatisticsKey& statisticsKey) const
+        {
+            return static_cast<ClassId>(statisticsKey >> 16);
+        }
+
+        PropertyId getPropertyIdFromKey(const StatisticsKey& statisticsKey) const
+        {
+            return static_cast<PropertyId>(statisticsKey & 0xffff);
+        }
+    };
+
+}
+}
+}
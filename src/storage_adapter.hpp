@@ -75,6 +75,15 @@ namespace adapter {
             _dbi.put(key, val, _append, _overwrite);
         }
 
+        template <typename K, typename V>
+        void append(const K& key, const V& val, bool duplicate)
+        {
+            if (_dbi == 0) {
+                throw NOGDB_INTERNAL_ERROR(NOGDB_INTERNAL_EMPTY_DBI);
+            }
+            _dbi.append(key, val, duplicate);
+        }
+
         template <typename K>
         lmdb::Result get(const K& key) const
         {
@@ -110,6 +119,14 @@ namespace adapter {
             _dbi.drop(del);
         }
 
+        size_t size() const
+        {
+            if (_dbi == 0) {
+                throw NOGDB_INTERNAL_ERROR(NOGDB_INTERNAL_EMPTY_DBI);
+            }
+            return _dbi.size();
+        }
+
         lmdb::Cursor cursor() const
         {
             if (_txn == nullptr) {
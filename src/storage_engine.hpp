@@ -96,6 +96,16 @@ namespace storage_engine {
             _txn = lmdb::Transaction::begin(env->handle(), txnMode);
         }
 
+        /**
+         * Begin a read-only transaction which uses the databases that the owner has shared instead of opening any,
+         * since no other transaction may open a database while the owner is running.
+         */
+        LMDBTxn(LMDBEnv* const env, const LMDBTxn& dbiOwner)
+            : _dbiOwner { &dbiOwner }
+        {
+            _txn = lmdb::Transaction::begin(env->handle(), lmdb::TXN_RO);
+        }
+
         ~LMDBTxn() noexcept
         {
             if (_txn.handle()) {
@@ -111,6 +121,8 @@ namespace storage_engine {
         {
             using std::swap;
             swap(_txn, other._txn);
+            swap(_dbiOwner, other._dbiOwner);
+            swap(_sharedDBi, other._sharedDBi);
         }
 
         LMDBTxn& operator=(LMDBTxn&& other) noexcept
@@ -118,17 +130,46 @@ namespace storage_engine {
             if (this != &other) {
                 using std::swap;
                 swap(_txn, other._txn);
+                swap(_dbiOwner, other._dbiOwner);
+                swap(_sharedDBi, other._sharedDBi);
             }
             return *this;
         }
 
         lmdb::DBi openDBi(const std::string& dbName, bool numericKey = false, bool unique = true) const
         {
-            if (_txn.handle()) {
-                return lmdb::DBi::open(_txn.handle(), dbName, numericKey, unique);
-            } else {
+            if (!_txn.handle()) {
                 throw NOGDB_STORAGE_ERROR(MDB_BAD_TXN);
+            } else if (_dbiOwner) {
+                auto dbHandler = _dbiOwner->_sharedDBi.find(dbName);
+                if (dbHandler == _dbiOwner->_sharedDBi.cend()) {
+                    throw NOGDB_STORAGE_ERROR(MDB_BAD_DBI);
+                }
+                return lmdb::DBi { _txn.handle(), dbHandler->second };
+            } else {
+                return lmdb::DBi::open(_txn.handle(), dbName, numericKey, unique);
+            }
+        }
+
+        // open a database for the transactions which use the databases of this one
+        void shareDBi(const std::string& dbName)
+        {
+            _sharedDBi[dbName] = openDBi(dbName).handle();
+        }
+
+        /**
+         * Whether the databases which the owner has shared are usable, which those it is the first to open are not
+         * until it has finished.
+         */
+        bool hasSharedDBi() const noexcept
+        {
+            for (const auto& dbHandler : _dbiOwner->_sharedDBi) {
+                auto flags = 0U;
+                if (mdb_dbi_flags(_txn.handle(), dbHandler.second, &flags)) {
+                    return false;
+                }
             }
+            return true;
         }
 
         lmdb::Cursor openCursor(const lmdb::DBi& dbi) const
@@ -159,8 +200,15 @@ namespace storage_engine {
             return _txn.handle();
         }
 
+        size_t id() const noexcept
+        {
+            return _txn.id();
+        }
+
     private:
         lmdb::Transaction _txn { nullptr };
+        const LMDBTxn* _dbiOwner { nullptr };
+        std::unordered_map<std::string, lmdb::DBHandler> _sharedDBi {};
     };
 
 }
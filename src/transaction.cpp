@@ -27,6 +27,7 @@
 #include "lmdb_engine.hpp"
 #include "relation.hpp"
 #include "schema_adapter.hpp"
+#include "statistics_adapter.hpp"
 
 #include "nogdb/nogdb.h"
 
@@ -37,6 +38,10 @@ Transaction::Adapter::Adapter()
     , _class { nullptr }
     , _property { nullptr }
     , _index { nullptr }
+    , _compositeIndex { nullptr }
+    , _textIndex { nullptr }
+    , _polymorphicIndex { nullptr }
+    , _statistics { nullptr }
 {
 }
 
@@ -45,6 +50,10 @@ Transaction::Adapter::Adapter(const storage_engine::LMDBTxn* txn)
     , _class { new adapter::schema::ClassAccess(txn) }
     , _property { new adapter::schema::PropertyAccess(txn) }
     , _index { new adapter::schema::IndexAccess(txn) }
+    , _compositeIndex { new adapter::schema::CompositeIndexAccess(txn) }
+    , _textIndex { new adapter::schema::TextIndexAccess(txn) }
+    , _polymorphicIndex { new adapter::schema::PolymorphicIndexAccess(txn) }
+    , _statistics { new adapter::metadata::StatisticsAccess(txn) }
 {
 }
 
@@ -66,11 +75,30 @@ Transaction::Adapter::~Adapter() noexcept
         delete _index;
         _index = nullptr;
     }
+    if (_compositeIndex) {
+        delete _compositeIndex;
+        _compositeIndex = nullptr;
+    }
+    if (_textIndex) {
+        delete _textIndex;
+        _textIndex = nullptr;
+    }
+    if (_polymorphicIndex) {
+        delete _polymorphicIndex;
+        _polymorphicIndex = nullptr;
+    }
+    if (_statistics) {
+        delete _statistics;
+        _statistics = nullptr;
+    }
 }
 
 Transaction::Transaction(Context& ctx, const TxnMode& mode)
     : _txnMode { mode }
     , _txnCtx { &ctx }
+    , _txnBase { nullptr }
+    , _adapter { nullptr }
+    , _graph { nullptr }
 {
     try {
         _txnBase = new storage_engine::LMDBTxn(
@@ -93,6 +121,32 @@ Transaction::Transaction(Context& ctx, const TxnMode& mode)
     }
 }
 
+Transaction::Transaction(const Transaction* owner)
+    : _txnMode { TxnMode::READ_ONLY }
+    , _txnCtx { owner->_txnCtx }
+    , _txnBase { nullptr }
+    , _adapter { nullptr }
+    , _graph { nullptr }
+{
+    try {
+        _txnBase = new storage_engine::LMDBTxn(_txnCtx->_envHandler, *owner->_txnBase);
+        _adapter = new Adapter(_txnBase);
+        _graph = new relation::GraphUtils(_txnBase, _txnCtx->_versionEnabled);
+    } catch (const Error& err) {
+        try {
+            rollback();
+        } catch (...) {
+        }
+        throw NOGDB_FATAL_ERROR(err);
+    } catch (...) {
+        try {
+            rollback();
+        } catch (...) {
+        }
+        std::rethrow_exception(std::current_exception());
+    }
+}
+
 Transaction::~Transaction() noexcept
 {
     try {
@@ -19,6 +19,12 @@
  *
  */
 
+#include <cstring>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 #include "utils.hpp"
 
 namespace nogdb {
@@ -72,6 +78,321 @@ namespace string {
         }
         return tmp;
     }
+
+    std::string foldCase(const std::string& str)
+    {
+        auto result = std::string(str.size(), '\0');
+        std::transform(str.cbegin(), str.cend(), result.begin(), [](char c) { return foldCase(c); });
+        return result;
+    }
+
+    namespace {
+        uint32_t foldCodePoint(uint32_t c)
+        {
+            // pairs of an upper case letter at an even code point followed by its lower case letter
+            auto isPaired = [c](uint32_t first, uint32_t last) { return c >= first && c <= last && c % 2 == 0; };
+            if (c < 0x80) {
+                return (c >= 'A' && c <= 'Z') ? c + 0x20 : c;
+            }
+            if ((c >= 0xc0 && c <= 0xde && c != 0xd7) || (c >= 0x391 && c <= 0x3ab && c != 0x3a2)
+                || (c >= 0x410 && c <= 0x42f) || (c >= 0xff21 && c <= 0xff3a)) {
+                return c + 0x20;
+            }
+            if (isPaired(0x100, 0x12f) || isPaired(0x132, 0x137) || isPaired(0x14a, 0x177)
+                || isPaired(0x3d8, 0x3ef) || isPaired(0x460, 0x481) || isPaired(0x48a, 0x4bf)
+                || isPaired(0x4d0, 0x52f) || isPaired(0x1e00, 0x1e95) || isPaired(0x1ea0, 0x1eff)) {
+                return c + 1;
+            }
+            // pairs of an upper case letter at an odd code point
+            if ((c >= 0x139 && c <= 0x148 && c % 2 == 1) || (c >= 0x179 && c <= 0x17e && c % 2 == 1)
+                || (c >= 0x4c1 && c <= 0x4ce && c % 2 == 1)) {
+                return c + 1;
+            }
+            if (c >= 0x400 && c <= 0x40f) {
+                return c + 0x50;
+            }
+            if (c >= 0x531 && c <= 0x556) {
+                return c + 0x30;
+            }
+            switch (c) {
+            case 0xb5:
+                return 0x3bc;
+            case 0x178:
+                return 0xff;
+            case 0x386:
+                return 0x3ac;
+            case 0x388:
+            case 0x389:
+            case 0x38a:
+                return c + 0x25;
+            case 0x38c:
+                return 0x3cc;
+            case 0x38e:
+            case 0x38f:
+                return c + 0x3f;
+            case 0x3c2:
+                return 0x3c3;
+            case 0x4c0:
+                return 0x4cf;
+            case 0x1e9e:
+                return 0xdf;
+            case 0x2126:
+                return 0x3c9;
+            default:
+                return c;
+            }
+        }
+
+        void appendCodePoint(std::string& str, uint32_t c)
+        {
+            if (c < 0x80) {
+                str.push_back(static_cast<char>(c));
+            } else if (c < 0x800) {
+                str.push_back(static_cast<char>(0xc0 | (c >> 6)));
+                str.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+            } else if (c < 0x10000) {
+                str.push_back(static_cast<char>(0xe0 | (c >> 12)));
+                str.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3f)));
+                str.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+            } else {
+                str.push_back(static_cast<char>(0xf0 | (c >> 18)));
+                str.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3f)));
+                str.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3f)));
+                str.push_back(static_cast<char>(0x80 | (c & 0x3f)));
+            }
+        }
+    }
+
+    std::string foldCaseUnicode(const std::string& str)
+    {
+        auto result = std::string {};
+        result.reserve(str.size());
+        for (auto i = size_t { 0 }; i < str.size();) {
+            auto lead = static_cast<unsigned char>(str[i]);
+            auto length = (lead < 0x80) ? 1 : ((lead >> 5) == 0x6) ? 2 : ((lead >> 4) == 0xe) ? 3 : ((lead >> 3) == 0x1e) ? 4 : 0;
+            auto c = (length == 1) ? uint32_t { lead } : (length == 2) ? uint32_t { lead & 0x1fu }
+                : (length == 3) ? uint32_t { lead & 0x0fu } : uint32_t { lead & 0x07u };
+            auto isValid = length > 0 && i + length <= str.size();
+            for (auto j = 1; isValid && j < length; ++j) {
+                auto next = static_cast<unsigned char>(str[i + j]);
+                isValid = (next >> 6) == 0x2;
+                c = (c << 6) | (next & 0x3fu);
+            }
+            // invalid and overlong sequences are copied byte by byte
+            if (!isValid || (length == 2 && c < 0x80) || (length == 3 && c < 0x800) || (length == 4 && c < 0x10000)) {
+                result.push_back(str[i++]);
+                continue;
+            }
+            appendCodePoint(result, foldCodePoint(c));
+            i += length;
+        }
+        return result;
+    }
+
+    bool isAscii(const std::string& str)
+    {
+        return std::all_of(str.cbegin(), str.cend(), [](char c) { return (static_cast<unsigned char>(c) & 0x80) == 0; });
+    }
+
+    namespace {
+        inline char upperCase(char c)
+        {
+            return (c >= 'a' && c <= 'z') ? static_cast<char>(c - ('a' - 'A')) : c;
+        }
+
+        inline bool equalBytes(const char* lhs, const char* rhs, size_t length, bool ignoreCase)
+        {
+            if (!ignoreCase) {
+                return memcmp(lhs, rhs, length) == 0;
+            }
+            for (size_t i = 0; i < length; ++i) {
+                if (foldCase(lhs[i]) != foldCase(rhs[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // compare a fixed-length LIKE segment where '_' matches any single character
+        inline bool matchSegment(const char* text, const char* segment, size_t length, bool ignoreCase)
+        {
+            for (size_t i = 0; i < length; ++i) {
+                if (segment[i] != '_' && (ignoreCase ? foldCase(text[i]) != foldCase(segment[i]) : text[i] != segment[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // leftmost occurrence of a fixed-length LIKE segment, anchored on its first literal run
+        size_t findSegment(const char* text, size_t textLength, const char* segment, size_t length, bool ignoreCase)
+        {
+            auto offset = size_t { 0 };
+            while (offset < length && segment[offset] == '_') {
+                ++offset;
+            }
+            if (offset == length) {
+                return (length <= textLength) ? 0 : std::string::npos;
+            }
+            auto runLength = size_t { 1 };
+            while (offset + runLength < length && segment[offset + runLength] != '_') {
+                ++runLength;
+            }
+            for (auto start = size_t { 0 }; start + length <= textLength;) {
+                auto found = find(text + start + offset, textLength - start - offset, segment + offset, runLength, ignoreCase);
+                if (found == std::string::npos || start + found + length > textLength) {
+                    return std::string::npos;
+                }
+                start += found;
+                if (matchSegment(text + start, segment, length, ignoreCase)) {
+                    return start;
+                }
+                ++start;
+            }
+            return std::string::npos;
+        }
+    }
+
+    size_t find(const char* text, size_t textLength, const char* pattern, size_t patternLength, bool ignoreCase)
+    {
+        if (patternLength == 0) {
+            return 0;
+        }
+        if (patternLength > textLength) {
+            return std::string::npos;
+        }
+        const auto lastStart = textLength - patternLength;
+        const auto firstLower = ignoreCase ? foldCase(pattern[0]) : pattern[0];
+        const auto firstUpper = ignoreCase ? upperCase(firstLower) : pattern[0];
+        const auto lastLower = ignoreCase ? foldCase(pattern[patternLength - 1]) : pattern[patternLength - 1];
+        const auto lastUpper = ignoreCase ? upperCase(lastLower) : pattern[patternLength - 1];
+        auto position = size_t { 0 };
+        // filter candidate positions by comparing both the first and the last pattern characters per lane
+#ifdef __AVX2__
+        {
+            const auto vFirstLower = _mm256_set1_epi8(firstLower);
+            const auto vFirstUpper = _mm256_set1_epi8(firstUpper);
+            const auto vLastLower = _mm256_set1_epi8(lastLower);
+            const auto vLastUpper = _mm256_set1_epi8(lastUpper);
+            for (; position + 32 <= lastStart + 1; position += 32) {
+                const auto blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + position));
+                const auto blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + position + patternLength - 1));
+                const auto matchFirst = _mm256_or_si256(_mm256_cmpeq_epi8(blockFirst, vFirstLower), _mm256_cmpeq_epi8(blockFirst, vFirstUpper));
+                const auto matchLast = _mm256_or_si256(_mm256_cmpeq_epi8(blockLast, vLastLower), _mm256_cmpeq_epi8(blockLast, vLastUpper));
+                auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(matchFirst, matchLast)));
+                while (mask != 0) {
+                    auto candidate = position + static_cast<size_t>(__builtin_ctz(mask));
+                    if (equalBytes(text + candidate, pattern, patternLength, ignoreCase)) {
+                        return candidate;
+                    }
+                    mask &= mask - 1;
+                }
+            }
+        }
+#endif
+#ifdef __SSE2__
+        {
+            const auto vFirstLower = _mm_set1_epi8(firstLower);
+            const auto vFirstUpper = _mm_set1_epi8(firstUpper);
+            const auto vLastLower = _mm_set1_epi8(lastLower);
+            const auto vLastUpper = _mm_set1_epi8(lastUpper);
+            for (; position + 16 <= lastStart + 1; position += 16) {
+                const auto blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + position));
+                const auto blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + position + patternLength - 1));
+                const auto matchFirst = _mm_or_si128(_mm_cmpeq_epi8(blockFirst, vFirstLower), _mm_cmpeq_epi8(blockFirst, vFirstUpper));
+                const auto matchLast = _mm_or_si128(_mm_cmpeq_epi8(blockLast, vLastLower), _mm_cmpeq_epi8(blockLast, vLastUpper));
+                auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(matchFirst, matchLast)));
+                while (mask != 0) {
+                    auto candidate = position + static_cast<size_t>(__builtin_ctz(mask));
+                    if (equalBytes(text + candidate, pattern, patternLength, ignoreCase)) {
+                        return candidate;
+                    }
+                    mask &= mask - 1;
+                }
+            }
+        }
+#endif
+        if (!ignoreCase) {
+            while (position <= lastStart) {
+                auto found = static_cast<const char*>(memchr(text + position, pattern[0], lastStart - position + 1));
+                if (found == nullptr) {
+                    return std::string::npos;
+                }
+                position = static_cast<size_t>(found - text);
+                if (memcmp(text + position, pattern, patternLength) == 0) {
+                    return position;
+                }
+                ++position;
+            }
+            return std::string::npos;
+        }
+        for (; position <= lastStart; ++position) {
+            if (foldCase(text[position]) == firstLower && equalBytes(text + position, pattern, patternLength, true)) {
+                return position;
+            }
+        }
+        return std::string::npos;
+    }
+
+    bool contains(const std::string& text, const std::string& pattern, bool ignoreCase)
+    {
+        return find(text.data(), text.size(), pattern.data(), pattern.size(), ignoreCase) != std::string::npos;
+    }
+
+    bool beginWith(const std::string& text, const std::string& pattern, bool ignoreCase)
+    {
+        return pattern.size() <= text.size() && equalBytes(text.data(), pattern.data(), pattern.size(), ignoreCase);
+    }
+
+    bool endWith(const std::string& text, const std::string& pattern, bool ignoreCase)
+    {
+        return pattern.size() <= text.size()
+            && equalBytes(text.data() + text.size() - pattern.size(), pattern.data(), pattern.size(), ignoreCase);
+    }
+
+    bool like(const std::string& text, const std::string& pattern, bool ignoreCase)
+    {
+        const auto textData = text.data();
+        const auto patternData = pattern.data();
+        const auto textLength = text.size();
+        const auto patternLength = pattern.size();
+        // the leading segment (which contains the literal prefix) is anchored at the beginning
+        auto firstWildcard = pattern.find('%');
+        if (firstWildcard == std::string::npos) {
+            return textLength == patternLength && matchSegment(textData, patternData, patternLength, ignoreCase);
+        }
+        if (firstWildcard > textLength || !matchSegment(textData, patternData, firstWildcard, ignoreCase)) {
+            return false;
+        }
+        // the trailing segment is anchored at the end
+        auto lastWildcard = pattern.rfind('%');
+        auto tailLength = patternLength - lastWildcard - 1;
+        if (tailLength > textLength - firstWildcard
+            || !matchSegment(textData + textLength - tailLength, patternData + lastWildcard + 1, tailLength, ignoreCase)) {
+            return false;
+        }
+        // segments in between have fixed lengths, so matching each of them leftmost is sufficient
+        auto textBegin = firstWildcard;
+        auto textEnd = textLength - tailLength;
+        for (auto patternBegin = firstWildcard + 1; patternBegin < lastWildcard;) {
+            auto patternEnd = pattern.find('%', patternBegin);
+            auto segmentLength = patternEnd - patternBegin;
+            if (segmentLength > 0) {
+                auto found = findSegment(textData + textBegin, textEnd - textBegin, patternData + patternBegin, segmentLength, ignoreCase);
+                if (found == std::string::npos) {
+                    return false;
+                }
+                textBegin += found + segmentLength;
+            }
+            patternBegin = patternEnd + 1;
+        }
+        return true;
+    }
+
+    std::string likePrefix(const std::string& pattern)
+    {
+        return pattern.substr(0, pattern.find_first_of("%_"));
+    }
 }
 
 // assertion
@@ -119,6 +119,32 @@ namespace string {
     void replaceAll(std::string& string, const std::string& from, const std::string& to);
     void toUpperCase(std::string& str);
     std::string frontPadding(const std::string& str, const size_t length, const char paddingChar);
+
+    // ascii-only case folding, equivalent to ::tolower under the "C" locale
+    inline char foldCase(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+    }
+
+    std::string foldCase(const std::string& str);
+
+    // simple unicode case folding of utf-8 text over the latin, greek, cyrillic and armenian letters
+    // and the fullwidth forms, leaving out the foldings of non-ascii letters into ascii ones
+    // (such as the kelvin sign), so that an ascii text only compares equal to other ascii texts
+    std::string foldCaseUnicode(const std::string& str);
+
+    bool isAscii(const std::string& str);
+
+    // position of the first occurrence of pattern in text or std::string::npos (memchr/memmem style with simd fast paths)
+    size_t find(const char* text, size_t textLength, const char* pattern, size_t patternLength, bool ignoreCase = false);
+    bool contains(const std::string& text, const std::string& pattern, bool ignoreCase = false);
+    bool beginWith(const std::string& text, const std::string& pattern, bool ignoreCase = false);
+    bool endWith(const std::string& text, const std::string& pattern, bool ignoreCase = false);
+
+    // sql LIKE matching where '%' matches any sequence of characters and '_' matches exactly one character
+    bool like(const std::string& text, const std::string& pattern, bool ignoreCase = false);
+    // literal characters of a LIKE pattern before its first wildcard
+    std::string likePrefix(const std::string& pattern);
 }
 
 // assertion
@@ -758,6 +758,68 @@ void test_reopen_ctx_v6()
     }
 }
 
+/* reopening a database with signed and real indexes holding values on both sides of zero */
+void test_reopen_ctx_v7()
+{
+    auto values = std::vector<int64_t> { -1000, -42, -1, 0, 1, 42, 1000 };
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("index_signed", nogdb::ClassType::VERTEX);
+        txn.addProperty("index_signed", "prop_int", nogdb::PropertyType::INTEGER);
+        txn.addProperty("index_signed", "prop_bigint", nogdb::PropertyType::BIGINT);
+        txn.addProperty("index_signed", "prop_real", nogdb::PropertyType::REAL);
+        txn.addIndex("index_signed", "prop_int", true);
+        txn.addIndex("index_signed", "prop_bigint", false);
+        txn.addIndex("index_signed", "prop_real", false);
+        for (const auto& value : values) {
+            txn.addVertex("index_signed",
+                nogdb::Record {}
+                    .set("prop_int", static_cast<int32_t>(value))
+                    .set("prop_bigint", value)
+                    .set("prop_real", value / 4.0));
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    delete ctx;
+
+    try {
+        ctx = new nogdb::Context(DATABASE_PATH);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        auto res = txn.find("index_signed").where(nogdb::Condition("prop_int").between(-42, 42)).indexed().get();
+        ASSERT_SIZE(res, 5);
+        res = txn.find("index_signed").where(nogdb::Condition("prop_bigint").lt(int64_t { 0 })).indexed().get();
+        ASSERT_SIZE(res, 3);
+        res = txn.find("index_signed").where(nogdb::Condition("prop_real").ge(-0.25)).indexed().get();
+        ASSERT_SIZE(res, 5);
+        res = txn.find("index_signed").where(nogdb::Condition("prop_real").eq(-10.5)).indexed().get();
+        ASSERT_SIZE(res, 1);
+        assert(res[0].record.getBigInt("prop_bigint") == -42);
+
+        txn.addVertex("index_signed", nogdb::Record {}.set("prop_int", -7).set("prop_real", -1.75));
+        res = txn.find("index_signed").where(nogdb::Condition("prop_real").between(-2.0, -0.25, { false, true })).indexed().get();
+        ASSERT_SIZE(res, 2);
+
+        txn.dropIndex("index_signed", "prop_int");
+        txn.dropIndex("index_signed", "prop_bigint");
+        txn.dropIndex("index_signed", "prop_real");
+        txn.dropClass("index_signed");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
+
 // void test_locked_ctx() {
 //  try {
 //    new nogdb::Context(DATABASE_PATH);
@@ -25,6 +25,7 @@
 
 nogdb::Context* ctx = nullptr;
 auto tnum = 0;
+auto isBenchmarkEnabled = false;
 
 void exec(void (*func)(), const std::string& msg)
 {
@@ -37,6 +38,14 @@ void exec(void (*func)(), const std::string& msg)
     ++tnum;
 }
 
+// benchmarks only report timings and run when the test is started with --benchmark
+void benchmark(void (*func)(), const std::string& msg)
+{
+    if (isBenchmarkEnabled) {
+        exec(func, msg);
+    }
+}
+
 void init_context()
 {
     std::string dbname { DATABASE_PATH };
@@ -56,8 +65,11 @@ void destroy_context()
     }
 }
 
-int main()
+int main(int argc, char* argv[])
 {
+    for (auto i = 1; i < argc; ++i) {
+        isBenchmarkEnabled = isBenchmarkEnabled || std::string { argv[i] } == "--benchmark";
+    }
     // prepare test environment
     init();
 
@@ -218,7 +230,6 @@ int main()
     exec(test_invalid_shortest_path, "finding the shortest path with invalid parameters");
     exec(test_shortest_path_cursor, "finding a cursor of the shortest path in a graph");
     exec(test_invalid_shortest_path_cursor, "finding a cursor of the shortest path with invalid parameters");
-    // exec(test_shortest_path_dijkstra, "finding the shortest path with dijkstra's algorithm");
     exec(test_bfs_traverse_with_condition, "traversing a graph using bfs algorithm with conditional functions");
     exec(test_shortest_path_with_condition, "finding the shortest path in a graph with conditional functions");
     exec(test_bfs_traverse_cursor_with_condition, "traversing a graph and returning a cursor using bfs algorithm with conditional functions");
@@ -226,6 +237,12 @@ int main()
     exec(test_bfs_traverse_multi_edges_with_condition, "traversing a graph using bfs algorithm with conditional functions for multi-edge vertices");
     exec(test_bfs_traverse_multi_vertices, "traversing a graph using bfs algorithm with multi-vertex sources");
     exec(test_bfs_traverse_multi_vertices_with_condition, "traversing a graph using bfs algorithm with multi-vertex sources and conditions");
+    exec(test_explain_traverse_and_shortest_path, "explaining the plans of traversing a graph and finding the shortest path");
+    exec(test_find_edges_of_classes_on_supernode, "finding the edges of some classes incident to a vertex with many edges");
+    exec(test_bidirectional_shortest_path, "finding the same shortest paths searching from both ends as forward only");
+    exec(test_shortest_path_dijkstra, "finding the lightest paths with dijkstra's algorithm and a*");
+    exec(test_parallel_bfs_traverse, "traversing a graph with several threads the same as with one");
+    benchmark(test_benchmark_parallel_traverse, "benchmarking a wide traversal with one to eight threads");
     exec(destroy_test_graph, "destroying the graph for testing graph operations");
 #endif
     // find
@@ -331,6 +348,7 @@ int main()
         "finding a cursor of incoming and outgoing edges from a vertex with a given expression");
     exec(test_find_invalid_edge_all_cursor_with_expression,
         "finding a cursor of incoming and outgoing edges from an invalid vertex or with an invalid expression");
+    exec(test_find_vertex_in_column_blocks, "finding records with numeric conditions evaluated in column blocks");
     exec(destroy_test_find, "destroying a graph for testing find operations");
 #endif
     // inheritance
@@ -392,13 +410,32 @@ int main()
 //    exec(test_search_by_index_non_unique_cursor_multicondition, "getting cursor from non-unique indexing with multi-condition");
     exec(test_search_by_index_extended_class_condition, "getting records from indexing with extended class with condition");
     exec(test_search_by_index_extended_class_cursor_condition, "getting cursor from indexing with extended class with condition");
-//    exec(test_search_by_index_extended_class_multicondition, "getting records from indexing with extended class with condition");
+    exec(test_search_by_index_extended_class_multicondition, "getting records from indexing with extended class with multi-condition");
 //    exec(test_search_by_index_extended_class_cursor_multicondition, "getting cursor from indexing with extended class with condition");
+    exec(test_search_by_index_partial_multicondition, "getting records from indexing with multi-condition partially covered by indexes");
+    exec(test_analyze_statistics, "analyzing and reading statistics of a class and its properties");
+    exec(test_explain_find_plan, "explaining the access paths chosen for finding records with and without indexes");
+    exec(test_search_by_index_range_against_scan, "getting the same records from index range scans as from class scans");
+    benchmark(test_benchmark_index_range_query, "benchmarking range queries with and without an index");
+    exec(test_composite_index, "creating, searching and dropping composite indexes");
+    exec(test_search_by_index_lazy_cursor, "reading indexed records lazily from a cursor in index order");
+    exec(test_create_index_with_many_existing_records, "creating indexes on a class with many existing records");
+    exec(test_covering_index, "answering projections from covering indexes");
+    exec(test_search_by_index_long_text, "searching indexes of texts longer than the key size limit");
+    exec(test_composite_index_long_text, "searching composite indexes of texts longer than the key size limit");
+    exec(test_text_index, "searching text patterns with n-gram text indexes");
+    exec(test_search_by_index_in_list, "searching for records with in-lists on indexes");
+    exec(test_collated_index, "searching for records with case-insensitive conditions on case-folding indexes");
+    exec(test_search_by_index_prefix, "searching for records with literal text prefixes as index ranges");
+    exec(test_upsert_by_unique_index, "upserting and getting or creating vertices by unique indexes");
+    exec(test_partial_index, "indexing only the records which satisfy the predicate of partial indexes");
+    exec(test_polymorphic_index, "looking records of a class and its subclasses up in polymorphic indexes");
 #endif
     // ctx
 #ifdef TEST_CONTEXT_OPERATIONS
     std::cout << "\n\x1B[96mEnd-to-end tests for a database context with indexing should:\x1B[0m\n";
     exec(test_reopen_ctx_v6, "reopening a context with records, extended classes, and indexing");
+    exec(test_reopen_ctx_v7, "reopening a context and searching signed and real indexes across zero");
 
     std::cout << "\n\x1B[96mEnd-to-end tests for multiple database contexts should:\x1B[0m\n";
     exec(test_multiple_ctx, "opening more than two contexts at the same time in the same process");
@@ -519,6 +556,9 @@ int main()
     exec(test_sql_create_index, "creating index with sql command");
     exec(test_sql_create_index_unique, "creating unique index with sql command");
     exec(test_sql_drop_index, "droping index with sql command");
+    exec(test_sql_composite_index, "creating and dropping composite index with sql command");
+    exec(test_sql_covering_index, "selecting covered properties with sql command");
+    exec(test_sql_explain, "explaining select and traverse queries with sql command");
 #endif
 
     destroy_context();
@@ -49,6 +49,7 @@ extern void test_reopen_ctx_v3(); // with records and relations
 extern void test_reopen_ctx_v4(); // with records, relations, and renaming class/property
 extern void test_reopen_ctx_v5(); // with records, relations, and extended classes
 extern void test_reopen_ctx_v6(); // with records, extended classes, and indexing
+extern void test_reopen_ctx_v7(); // with signed and real indexing
 // extern void test_locked_ctx();
 extern void test_invalid_ctx();
 extern void test_multiple_ctx();
@@ -186,7 +187,12 @@ extern void test_shortest_path_cursor_with_condition();
 extern void test_bfs_traverse_multi_edges_with_condition();
 extern void test_bfs_traverse_multi_vertices();
 extern void test_bfs_traverse_multi_vertices_with_condition();
-// extern void test_shortest_path_dijkstra();
+extern void test_explain_traverse_and_shortest_path();
+extern void test_find_edges_of_classes_on_supernode();
+extern void test_bidirectional_shortest_path();
+extern void test_shortest_path_dijkstra();
+extern void test_parallel_bfs_traverse();
+extern void test_benchmark_parallel_traverse();
 #endif
 
 // find operations testing
@@ -258,6 +264,7 @@ extern void test_find_edge_all_cursor_with_expression();
 extern void test_find_invalid_edge_in_cursor_with_expression();
 extern void test_find_invalid_edge_out_cursor_with_expression();
 extern void test_find_invalid_edge_all_cursor_with_expression();
+extern void test_find_vertex_in_column_blocks();
 extern void destroy_test_find();
 #endif
 
@@ -310,6 +317,27 @@ extern void test_search_by_index_extended_class_condition();
 extern void test_search_by_index_extended_class_cursor_condition();
 extern void test_search_by_index_extended_class_multicondition();
 extern void test_search_by_index_extended_class_cursor_multicondition();
+extern void test_search_by_index_partial_multicondition();
+extern void test_analyze_statistics();
+extern void test_explain_find_plan();
+extern void test_search_by_index_range_against_scan();
+extern void test_benchmark_index_range_query();
+
+extern void test_composite_index();
+extern void test_search_by_index_lazy_cursor();
+extern void test_create_index_with_many_existing_records();
+
+extern void test_covering_index();
+extern void test_search_by_index_long_text();
+extern void test_composite_index_long_text();
+extern void test_text_index();
+extern void test_search_by_index_in_list();
+extern void test_collated_index();
+extern void test_search_by_index_prefix();
+extern void test_upsert_by_unique_index();
+
+extern void test_partial_index();
+extern void test_polymorphic_index();
 #endif
 
 // schema transaction testing
@@ -426,4 +454,9 @@ extern void test_sql_traverse();
 extern void test_sql_create_index();
 extern void test_sql_create_index_unique();
 extern void test_sql_drop_index();
+
+extern void test_sql_composite_index();
+
+extern void test_sql_covering_index();
+extern void test_sql_explain();
 #endif
@@ -173,20 +173,26 @@ inline bool rdescCursorCompare(const std::string& propertyName, nogdb::ResultSet
         }
         std::cout << "]\x1B[0m\n";
     } else {
-        auto index = 0;
+        // an indexed condition yields records in index order rather than by record id
+        auto actualResultSorted = std::vector<nogdb::RecordDescriptor> {};
+        while (res.next()) {
+            actualResultSorted.emplace_back(res->descriptor);
+        }
         auto expectedResultSorted = expectedResult;
-        std::sort(expectedResultSorted.begin(), expectedResultSorted.end(),
-            [](const nogdb::RecordDescriptor& lhs, const nogdb::RecordDescriptor& rhs) { return lhs.rid < rhs.rid; });
-        for (res.next(); res.hasNext(); res.next()) {
-            auto cmp = res->descriptor.rid == expectedResultSorted[index].rid;
+        auto ridLess = [](const nogdb::RecordDescriptor& lhs, const nogdb::RecordDescriptor& rhs) {
+            return lhs.rid < rhs.rid;
+        };
+        std::sort(actualResultSorted.begin(), actualResultSorted.end(), ridLess);
+        std::sort(expectedResultSorted.begin(), expectedResultSorted.end(), ridLess);
+        for (auto index = 0U; index < expectedResultSorted.size(); ++index) {
+            auto cmp = actualResultSorted[index].rid == expectedResultSorted[index].rid;
             compareRes &= cmp;
             if (!cmp) {
                 std::cout << propertyName << "\n";
                 std::cout << "\x1B[31m"
                           << "\n[error] Expect:\t" << expectedResultSorted[index].rid << "\n"
-                          << "        Actual:\t" << res->descriptor.rid << ".\x1B[0m\n";
+                          << "        Actual:\t" << actualResultSorted[index].rid << ".\x1B[0m\n";
             }
-            ++index;
         }
     }
     return compareRes;
@@ -3616,3 +3616,105 @@ void test_find_invalid_edge_all_cursor_with_expression()
         REQUIRE(ex, NOGDB_GRAPH_NOEXST_VERTEX, "NOGDB_GRAPH_NOEXST_VERTEX");
     }
 }
+
+void test_find_vertex_in_column_blocks()
+{
+    auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+    try {
+        txn.addClass("measurements", nogdb::ClassType::VERTEX);
+        txn.addProperty("measurements", "level", nogdb::PropertyType::TINYINT);
+        txn.addProperty("measurements", "reading", nogdb::PropertyType::BIGINT);
+        txn.addProperty("measurements", "counter", nogdb::PropertyType::UNSIGNED_BIGINT);
+        txn.addProperty("measurements", "ratio", nogdb::PropertyType::REAL);
+        txn.addProperty("measurements", "weight", nogdb::PropertyType::UNSIGNED_SMALLINT);
+        for (auto i = 0; i < 3000; ++i) {
+            auto r = nogdb::Record {};
+            if (i % 7 != 0) {
+                r.set("level", static_cast<int8_t>(i % 200 - 100));
+            }
+            if (i % 11 != 0) {
+                r.set("ratio", (i % 100) / 10.0 - 5.0);
+            }
+            r.set("reading", static_cast<int64_t>(i * 37 % 2001) - 1000)
+                .set("counter", static_cast<uint64_t>(i) * 0x0100000000000001ULL)
+                .set("weight", static_cast<uint16_t>(i % 500));
+            txn.addVertex("measurements", r);
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+    auto all = txn.find("measurements").get();
+    assert(all.size() == 3000);
+    auto check = [&](const nogdb::Condition& condition, std::function<bool(const nogdb::Record&)> expected) {
+        auto expectedResult = std::vector<nogdb::RecordDescriptor> {};
+        for (const auto& result : all) {
+            if (expected(result.record)) {
+                expectedResult.emplace_back(result.descriptor);
+            }
+        }
+        auto res = txn.find("measurements").where(condition).get();
+        ASSERT_SIZE(res, expectedResult.size());
+        for (size_t i = 0; i < res.size(); ++i) {
+            assert(res[i].descriptor == expectedResult[i]);
+        }
+        assert(txn.find("measurements").where(condition).count() == expectedResult.size());
+        auto cursor = txn.find("measurements").where(condition).getCursor();
+        assert(cursor.size() == expectedResult.size());
+    };
+    try {
+        check(nogdb::Condition("level").gt(static_cast<int8_t>(-20)), [](const nogdb::Record& r) {
+            return !r.get("level").empty() && r.get("level").toTinyInt() > -20;
+        });
+        check(nogdb::Condition("level").eq(static_cast<int8_t>(5)), [](const nogdb::Record& r) {
+            return !r.get("level").empty() && r.get("level").toTinyInt() == 5;
+        });
+        check(!nogdb::Condition("level").le(static_cast<int8_t>(0)), [](const nogdb::Record& r) {
+            return !r.get("level").empty() && !(r.get("level").toTinyInt() <= 0);
+        });
+        check(nogdb::Condition("reading").between(static_cast<int64_t>(-100), static_cast<int64_t>(100)),
+            [](const nogdb::Record& r) {
+                return r.get("reading").toBigInt() >= -100 && r.get("reading").toBigInt() <= 100;
+            });
+        check(!nogdb::Condition("reading").between(static_cast<int64_t>(-100), static_cast<int64_t>(100), { false, false }),
+            [](const nogdb::Record& r) {
+                return !(r.get("reading").toBigInt() > -100 && r.get("reading").toBigInt() < 100);
+            });
+        check(nogdb::Condition("counter").ge(static_cast<uint64_t>(1500) * 0x0100000000000001ULL),
+            [](const nogdb::Record& r) {
+                return r.get("counter").toBigIntU() >= static_cast<uint64_t>(1500) * 0x0100000000000001ULL;
+            });
+        check(nogdb::Condition("counter").lt(static_cast<uint64_t>(0x8000000000000000ULL)), [](const nogdb::Record& r) {
+            return r.get("counter").toBigIntU() < 0x8000000000000000ULL;
+        });
+        check(nogdb::Condition("ratio").lt(0.0), [](const nogdb::Record& r) {
+            return !r.get("ratio").empty() && r.get("ratio").toReal() < 0.0;
+        });
+        check(nogdb::Condition("ratio").between(-1.5, 1.5, { false, true }), [](const nogdb::Record& r) {
+            return !r.get("ratio").empty() && r.get("ratio").toReal() > -1.5 && r.get("ratio").toReal() <= 1.5;
+        });
+        check(nogdb::Condition("weight").in(std::vector<uint16_t> { 1, 2, 499 }), [](const nogdb::Record& r) {
+            auto weight = r.get("weight").toSmallIntU();
+            return weight == 1 || weight == 2 || weight == 499;
+        });
+        check(nogdb::Condition("ratio").in(std::vector<double> { -5.0, 4.9 }), [](const nogdb::Record& r) {
+            return !r.get("ratio").empty() && (r.get("ratio").toReal() == -5.0 || r.get("ratio").toReal() == 4.9);
+        });
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    txn.rollback();
+
+    txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+    try {
+        txn.dropClass("measurements");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
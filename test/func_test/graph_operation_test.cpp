@@ -19,8 +19,15 @@
  *
  */
 
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <limits>
 #include <list>
+#include <map>
+#include <random>
 #include <set>
+#include <tuple>
 #include <vector>
 
 #include "func_test.h"
@@ -3027,3 +3034,610 @@ void test_bfs_traverse_multi_vertices_with_condition() {
 
     txn.commit();
 }
+
+void test_explain_traverse_and_shortest_path()
+{
+    auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+    nogdb::RecordDescriptor A, f;
+    try {
+        for (const auto& res : txn.find("folders").get()) {
+            if (res.record.get("name").toText() == "A") {
+                A = res.descriptor;
+            }
+        }
+        for (const auto& res : txn.find("files").get()) {
+            if (res.record.get("name").toText() == "f") {
+                f = res.descriptor;
+            }
+        }
+
+        auto traverse = txn.traverseOut(A).minDepth(1).maxDepth(3);
+        auto plan = traverse.explain();
+        assert(plan.actualRows == traverse.get().size());
+        assert(plan.stages.size() == 2);
+        assert(plan.stages[0].operation == "TRAVERSE");
+        assert(plan.stages[0].actualRows == plan.actualRows);
+        assert(plan.stages[0].rowsScanned > 0);
+        assert(plan.stages[0].indexEntries >= plan.actualRows);
+        assert(plan.stages[1].operation == "FETCH");
+        assert(plan.stages[1].recordsDecoded == plan.actualRows);
+        assert(plan.elapsedTime >= plan.stages[0].elapsedTime);
+        assert(!plan.toString().empty());
+
+        auto shortestPath = txn.shortestPath(A, f);
+        plan = shortestPath.explain();
+        assert(plan.actualRows == shortestPath.get().size());
+        assert(plan.stages.size() == 2);
+        assert(plan.stages[0].operation == "SHORTEST_PATH");
+        assert(plan.stages[0].detail.find("bidirectional") != std::string::npos);
+        assert(shortestPath.bidirectional(false).explain().stages[0].detail.find("bidirectional") == std::string::npos);
+        assert(plan.stages[1].recordsDecoded == plan.actualRows);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    txn.commit();
+}
+
+void test_find_edges_of_classes_on_supernode()
+{
+    // a vertex with many incident edges of several classes, where only a few are of the filtered class
+    auto edgeClasses = std::vector<std::string> { "hub_follows", "hub_likes", "hub_blocks", "hub_mutes" };
+    auto hub = nogdb::RecordDescriptor {};
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("hub_vertex", nogdb::ClassType::VERTEX);
+        txn.addProperty("hub_vertex", "name", nogdb::PropertyType::TEXT);
+        txn.addClass("hub_follows", nogdb::ClassType::EDGE);
+        txn.addClass("hub_likes", nogdb::ClassType::EDGE);
+        txn.addClass("hub_blocks", nogdb::ClassType::EDGE);
+        txn.addSubClassOf("hub_blocks", "hub_mutes");
+        txn.addProperty("hub_follows", "weight", nogdb::PropertyType::INTEGER);
+        hub = txn.addVertex("hub_vertex", nogdb::Record {}.set("name", "hub"));
+        for (auto i = 0; i < 300; ++i) {
+            auto other = txn.addVertex("hub_vertex", nogdb::Record {}.set("name", "v" + std::to_string(i)));
+            const auto& edgeClass = edgeClasses[(i % 7 == 0) ? 0 : (i % 5 == 0) ? 2 + i % 2 : 1];
+            auto record = (edgeClass == "hub_follows") ? nogdb::Record {}.set("weight", i) : nogdb::Record {};
+            if (i % 2 == 0) {
+                txn.addEdge(edgeClass, hub, other, record);
+            } else {
+                txn.addEdge(edgeClass, other, hub, record);
+            }
+        }
+        txn.addEdge("hub_follows", hub, hub, nogdb::Record {}.set("weight", -1));
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    auto getClassIds = [](const nogdb::ResultSet& resultSet) {
+        auto classIds = std::multiset<nogdb::ClassId> {};
+        for (const auto& res : resultSet) {
+            classIds.insert(res.descriptor.rid.first);
+        }
+        return classIds;
+    };
+    auto getEdgeIds = [](const nogdb::ResultSet& resultSet) {
+        auto edgeIds = std::set<nogdb::RecordId> {};
+        for (const auto& res : resultSet) {
+            edgeIds.insert(res.descriptor.rid);
+        }
+        return edgeIds;
+    };
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto followsId = txn.getClass("hub_follows").id;
+        auto blocksId = txn.getClass("hub_blocks").id;
+        auto mutesId = txn.getClass("hub_mutes").id;
+        auto isFollows = [&](const nogdb::Result& res) { return res.descriptor.rid.first == followsId; };
+        auto isBlocks = [&](const nogdb::Result& res) {
+            return res.descriptor.rid.first == blocksId || res.descriptor.rid.first == mutesId;
+        };
+        // each filter with the same criteria checked on every incident edge
+        auto filters = std::vector<std::pair<nogdb::GraphFilter, std::function<bool(const nogdb::Result&)>>> {
+            { nogdb::GraphFilter {}.only("hub_follows"), isFollows },
+            { nogdb::GraphFilter {}.only("hub_follows", "hub_mutes"),
+                [&](const nogdb::Result& res) { return isFollows(res) || res.descriptor.rid.first == mutesId; } },
+            { nogdb::GraphFilter {}.onlySubClassOf("hub_blocks"), isBlocks },
+            { nogdb::GraphFilter {}.only("hub_undefined"), [](const nogdb::Result&) { return false; } },
+            { nogdb::GraphFilter { nogdb::Condition("weight").ge(150) }.only("hub_follows"),
+                [&](const nogdb::Result& res) { return isFollows(res) && res.record.get("weight").toInt() >= 150; } },
+            { nogdb::GraphFilter {}.onlySubClassOf("hub_blocks").exclude("hub_mutes"),
+                [&](const nogdb::Result& res) { return res.descriptor.rid.first == blocksId; } } };
+        for (const auto& filter : filters) {
+            auto getExpected = [&](const nogdb::ResultSet& edges) {
+                auto edgeIds = std::set<nogdb::RecordId> {};
+                for (const auto& res : edges) {
+                    if (filter.second(res)) {
+                        edgeIds.insert(res.descriptor.rid);
+                    }
+                }
+                return edgeIds;
+            };
+            auto expectedOut = getExpected(txn.findOutEdge(hub).get());
+            auto expectedIn = getExpected(txn.findInEdge(hub).get());
+            auto expectedAll = getExpected(txn.findEdge(hub).get());
+            assert(getEdgeIds(txn.findOutEdge(hub).where(filter.first).get()) == expectedOut);
+            assert(txn.findOutEdge(hub).where(filter.first).count() == expectedOut.size());
+            assert(getEdgeIds(txn.findInEdge(hub).where(filter.first).get()) == expectedIn);
+            assert(getEdgeIds(txn.findEdge(hub).where(filter.first).get()) == expectedAll);
+            assert(txn.findEdge(hub).where(filter.first).getCursor().size() == expectedAll.size());
+        }
+
+        auto follows = txn.findOutEdge(hub).where(nogdb::GraphFilter {}.only("hub_follows")).get();
+        assert(follows.size() == 23);
+        assert(getClassIds(follows).count(followsId) == follows.size());
+        auto inFollows = txn.findInEdge(hub).where(nogdb::GraphFilter {}.only("hub_follows")).get();
+        assert(inFollows.size() == 22);
+        // a self loop is both an incoming and an outgoing edge but is found once
+        assert(txn.findEdge(hub).where(nogdb::GraphFilter {}.only("hub_follows")).count() == 44);
+        auto blocks = txn.findEdge(hub).where(nogdb::GraphFilter {}.onlySubClassOf("hub_blocks")).get();
+        auto blockClassIds = getClassIds(blocks);
+        assert(blocks.size() == 51);
+        assert(blockClassIds.count(blocksId) + blockClassIds.count(mutesId) == blocks.size());
+        assert(blockClassIds.count(blocksId) > 0 && blockClassIds.count(mutesId) > 0);
+        assert(txn.findEdge(hub).where(nogdb::GraphFilter {}.only("hub_undefined")).get().empty());
+
+        auto neighbours = txn.traverseOut(hub).whereE(nogdb::GraphFilter {}.only("hub_follows")).minDepth(1).maxDepth(1).get();
+        assert(neighbours.size() == 22);
+        neighbours = txn.traverse(hub).whereE(nogdb::GraphFilter {}.only("hub_mutes")).minDepth(1).maxDepth(1).get();
+        assert(neighbours.size() == blockClassIds.count(mutesId));
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropClass("hub_follows");
+        txn.dropClass("hub_likes");
+        txn.dropClass("hub_mutes");
+        txn.dropClass("hub_blocks");
+        txn.dropClass("hub_vertex");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
+
+void test_bidirectional_shortest_path()
+{
+    const auto vertexCount = 400;
+    auto vertices = std::vector<nogdb::RecordDescriptor> {};
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("sp_vertex", nogdb::ClassType::VERTEX);
+        txn.addProperty("sp_vertex", "group", nogdb::PropertyType::INTEGER);
+        txn.addClass("sp_edge", nogdb::ClassType::EDGE);
+        txn.addProperty("sp_edge", "cost", nogdb::PropertyType::INTEGER);
+        auto rng = std::mt19937 { 11 };
+        for (auto i = 0; i < vertexCount; ++i) {
+            vertices.emplace_back(txn.addVertex("sp_vertex", nogdb::Record {}.set("group", i % 7)));
+        }
+        // a sparse random graph, so that some pairs are far apart and some are not connected at all
+        auto pick = std::uniform_int_distribution<int> { 0, vertexCount - 1 };
+        for (auto i = 0; i < vertexCount * 2; ++i) {
+            auto cost = static_cast<int>(rng() % 10);
+            txn.addEdge("sp_edge", vertices[static_cast<size_t>(pick(rng))], vertices[static_cast<size_t>(pick(rng))],
+                nogdb::Record {}.set("cost", cost));
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    const auto edgeFilters = std::vector<nogdb::GraphFilter> {
+        nogdb::GraphFilter {}, nogdb::GraphFilter { nogdb::Condition("cost").lt(8) }.only("sp_edge") };
+    const auto vertexFilters = std::vector<nogdb::GraphFilter> {
+        nogdb::GraphFilter {}, nogdb::GraphFilter { !nogdb::Condition("group").eq(3) } };
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        // every step of a path follows an out-edge accepted by the filter to a vertex accepted by the filter
+        auto isPath = [&](const nogdb::ResultSet& path, const nogdb::GraphFilter& edgeFilter, bool isGroupFiltered) {
+            for (auto i = size_t { 1 }; i < path.size(); ++i) {
+                if (path[i].record.getDepth() != i || (isGroupFiltered && path[i].record.get("group").toInt() == 3)) {
+                    return false;
+                }
+                auto isLinked = false;
+                for (const auto& edge : txn.findOutEdge(path[i - 1].descriptor).where(edgeFilter).get()) {
+                    isLinked = isLinked || txn.fetchDst(edge.descriptor).descriptor == path[i].descriptor;
+                }
+                if (!isLinked) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        auto rng = std::mt19937 { 5 };
+        auto connectedCount = 0;
+        for (auto i = 0; i < 60; ++i) {
+            auto src = vertices[rng() % vertices.size()];
+            auto dst = vertices[rng() % vertices.size()];
+            for (const auto& edgeFilter : edgeFilters) {
+                for (auto j = size_t { 0 }; j < vertexFilters.size(); ++j) {
+                    const auto& vertexFilter = vertexFilters[j];
+                    auto expected = txn.shortestPath(src, dst).whereE(edgeFilter).whereV(vertexFilter)
+                                        .bidirectional(false).get();
+                    auto path = txn.shortestPath(src, dst).whereE(edgeFilter).whereV(vertexFilter).get();
+                    assert(path.size() == expected.size());
+                    assert(txn.shortestPath(src, dst).whereE(edgeFilter).whereV(vertexFilter).count() == path.size());
+                    if (!path.empty()) {
+                        assert(path.front().descriptor == src && path.back().descriptor == dst);
+                        assert(isPath(path, edgeFilter, j == 1));
+                        connectedCount += (path.size() > 3) ? 1 : 0;
+                    }
+                }
+            }
+        }
+        assert(connectedCount > 0);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropClass("sp_edge");
+        txn.dropClass("sp_vertex");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
+
+void test_shortest_path_dijkstra()
+{
+    auto a = nogdb::RecordDescriptor {}, b = a, c = a, d = a, e = a;
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("wp_vertex", nogdb::ClassType::VERTEX);
+        txn.addProperty("wp_vertex", "x", nogdb::PropertyType::REAL);
+        txn.addClass("wp_edge", nogdb::ClassType::EDGE);
+        txn.addProperty("wp_edge", "weight", nogdb::PropertyType::REAL);
+        txn.addProperty("wp_edge", "label", nogdb::PropertyType::TEXT);
+        a = txn.addVertex("wp_vertex", nogdb::Record {}.set("x", 0.0));
+        b = txn.addVertex("wp_vertex", nogdb::Record {}.set("x", 1.0));
+        c = txn.addVertex("wp_vertex", nogdb::Record {}.set("x", 2.0));
+        d = txn.addVertex("wp_vertex", nogdb::Record {}.set("x", 3.0));
+        e = txn.addVertex("wp_vertex", nogdb::Record {}.set("x", 3.0));
+        // a->d is the fewest edges, a->b->c->d the lightest, and a->e->d weighs only with a default weight
+        txn.addEdge("wp_edge", a, b, nogdb::Record {}.set("weight", 1.0));
+        txn.addEdge("wp_edge", b, c, nogdb::Record {}.set("weight", 1.0));
+        txn.addEdge("wp_edge", c, d, nogdb::Record {}.set("weight", 1.0));
+        txn.addEdge("wp_edge", a, d, nogdb::Record {}.set("weight", 5.0));
+        txn.addEdge("wp_edge", a, e, nogdb::Record {}.set("weight", 1.0));
+        txn.addEdge("wp_edge", e, d, nogdb::Record {}.set("label", "unweighted"));
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    // the distance along x never exceeds the remaining weight
+    auto distanceOnX = [](const nogdb::Record& vertex, const nogdb::Record& destination) {
+        return std::abs(destination.get("x").toReal() - vertex.get("x").toReal());
+    };
+    auto isPath = [](const nogdb::ResultSet& path, const std::vector<nogdb::RecordDescriptor>& expected) {
+        if (path.size() != expected.size()) {
+            return false;
+        }
+        for (auto i = size_t { 0 }; i < path.size(); ++i) {
+            if (path[i].descriptor != expected[i] || path[i].record.getDepth() != i) {
+                return false;
+            }
+        }
+        return true;
+    };
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        assert(isPath(txn.shortestPath(a, d).get(), { a, d }));
+        assert(isPath(txn.shortestPath(a, d).weight("weight").get(), { a, b, c, d }));
+        assert(txn.shortestPath(a, d).weight("weight").count() == 4);
+        assert(isPath(txn.shortestPath(a, d).weight("weight", 0.5).get(), { a, e, d }));
+        assert(isPath(txn.shortestPath(a, d).weight("weight").heuristic(distanceOnX).get(), { a, b, c, d }));
+        assert(isPath(txn.shortestPath(a, d).weight("weight", 0.5).heuristic(distanceOnX).get(), { a, e, d }));
+        assert(isPath(txn.shortestPath(a, d).weight("weight").whereV(nogdb::GraphFilter { !nogdb::Condition("x").eq(1.0) }).get(), { a, d }));
+        assert(isPath(txn.shortestPath(a, d).weight("weight").whereE(nogdb::GraphFilter { nogdb::Condition("weight").lt(5.0) }).get(), { a, b, c, d }));
+        assert(txn.shortestPath(a, d).weight("weight").whereV(nogdb::GraphFilter { !nogdb::Condition("x").eq(3.0) }).get().empty());
+        assert(txn.shortestPath(d, a).weight("weight").get().empty());
+        assert(isPath(txn.shortestPath(a, a).weight("weight").get(), { a }));
+
+        auto plan = txn.shortestPath(a, d).weight("weight").explain();
+        assert(plan.actualRows == 4);
+        assert(plan.stages[0].operation == "SHORTEST_PATH");
+        assert(plan.stages[0].detail.find("path weight=3") != std::string::npos);
+        assert(plan.stages[0].detail.find("dijkstra") != std::string::npos);
+        plan = txn.shortestPath(a, d).weight("weight", 0.5).heuristic(distanceOnX).explain();
+        assert(plan.stages[0].detail.find("path weight=1.5") != std::string::npos);
+        assert(plan.stages[0].detail.find("a*") != std::string::npos);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+    try {
+        txn.shortestPath(a, d).weight("label").get();
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        txn.rollback();
+        REQUIRE(ex, NOGDB_CTX_INVALID_PROPTYPE, "NOGDB_CTX_INVALID_PROPTYPE");
+    }
+
+    txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+    try {
+        txn.addEdge("wp_edge", b, d, nogdb::Record {}.set("weight", -1.0));
+        txn.shortestPath(a, d).weight("weight").get();
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        txn.rollback();
+        REQUIRE(ex, NOGDB_GRAPH_NEGATIVE_WEIGHT, "NOGDB_GRAPH_NEGATIVE_WEIGHT");
+    }
+    txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+    try {
+        txn.addEdge("wp_edge", b, d, nogdb::Record {}.set("weight", std::nan("")));
+        txn.shortestPath(a, d).weight("weight").get();
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        txn.rollback();
+        REQUIRE(ex, NOGDB_GRAPH_NEGATIVE_WEIGHT, "NOGDB_GRAPH_NEGATIVE_WEIGHT");
+    }
+    txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+    try {
+        txn.shortestPath(a, d).weight("weight", std::nan("")).get();
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        txn.rollback();
+        REQUIRE(ex, NOGDB_GRAPH_NEGATIVE_WEIGHT, "NOGDB_GRAPH_NEGATIVE_WEIGHT");
+    }
+
+    // the weights of the lightest paths on a random graph against Bellman-Ford over the same edges
+    const auto vertexCount = 200;
+    auto vertices = std::vector<nogdb::RecordDescriptor> {};
+    auto edges = std::vector<std::tuple<size_t, size_t, int>> {};
+    try {
+        txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        auto rng = std::mt19937 { 13 };
+        for (auto i = 0; i < vertexCount; ++i) {
+            vertices.emplace_back(txn.addVertex("wp_vertex", nogdb::Record {}.set("x", 0.0)));
+        }
+        for (auto i = 0; i < vertexCount * 3; ++i) {
+            auto src = rng() % vertices.size();
+            auto dst = rng() % vertices.size();
+            auto weight = static_cast<int>(rng() % 10);
+            edges.emplace_back(src, dst, weight);
+            txn.addEdge("wp_edge", vertices[src], vertices[dst], nogdb::Record {}.set("weight", static_cast<double>(weight)));
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    try {
+        txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto indexOf = std::map<nogdb::RecordDescriptor, size_t> {};
+        for (auto i = size_t { 0 }; i < vertices.size(); ++i) {
+            indexOf[vertices[i]] = i;
+        }
+        auto rng = std::mt19937 { 17 };
+        auto connectedCount = 0;
+        for (auto i = 0; i < 30; ++i) {
+            auto src = rng() % vertices.size();
+            auto dst = rng() % vertices.size();
+            const auto unreachable = std::numeric_limits<int>::max();
+            auto distances = std::vector<int>(vertices.size(), unreachable);
+            distances[src] = 0;
+            for (auto round = size_t { 0 }; round < vertices.size(); ++round) {
+                for (const auto& edge : edges) {
+                    if (distances[std::get<0>(edge)] != unreachable) {
+                        distances[std::get<1>(edge)] = std::min(distances[std::get<1>(edge)],
+                            distances[std::get<0>(edge)] + std::get<2>(edge));
+                    }
+                }
+            }
+            for (const auto& path : { txn.shortestPath(vertices[src], vertices[dst]).weight("weight").get(),
+                     txn.shortestPath(vertices[src], vertices[dst]).weight("weight")
+                         .heuristic([](const nogdb::Record&, const nogdb::Record&) { return 0.0; }).get() }) {
+                if (distances[dst] == unreachable) {
+                    assert(path.empty());
+                    continue;
+                }
+                assert(!path.empty() && path.front().descriptor == vertices[src] && path.back().descriptor == vertices[dst]);
+                // the lightest of the parallel edges between every two consecutive vertices
+                auto weight = 0;
+                for (auto j = size_t { 1 }; j < path.size(); ++j) {
+                    auto lightest = unreachable;
+                    for (const auto& edge : edges) {
+                        if (std::get<0>(edge) == indexOf[path[j - 1].descriptor] && std::get<1>(edge) == indexOf[path[j].descriptor]) {
+                            lightest = std::min(lightest, std::get<2>(edge));
+                        }
+                    }
+                    assert(lightest != unreachable);
+                    weight += lightest;
+                }
+                assert(weight == distances[dst]);
+                connectedCount += (path.size() > 3) ? 1 : 0;
+            }
+        }
+        assert(connectedCount > 0);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropClass("wp_edge");
+        txn.dropClass("wp_vertex");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
+
+void test_parallel_bfs_traverse()
+{
+    const auto vertexCount = 1000;
+    auto vertices = std::vector<nogdb::RecordDescriptor> {};
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("pt_vertex", nogdb::ClassType::VERTEX);
+        txn.addProperty("pt_vertex", "group", nogdb::PropertyType::INTEGER);
+        txn.addClass("pt_edge", nogdb::ClassType::EDGE);
+        txn.addProperty("pt_edge", "cost", nogdb::PropertyType::INTEGER);
+        txn.addClass("pt_other_edge", nogdb::ClassType::EDGE);
+        auto rng = std::mt19937 { 23 };
+        for (auto i = 0; i < vertexCount; ++i) {
+            vertices.emplace_back(txn.addVertex("pt_vertex", nogdb::Record {}.set("group", i % 5)));
+        }
+        for (auto i = 0; i < vertexCount * 4; ++i) {
+            auto src = vertices[rng() % vertices.size()];
+            auto dst = vertices[rng() % vertices.size()];
+            if (i % 4 == 0) {
+                txn.addEdge("pt_other_edge", src, dst);
+            } else {
+                txn.addEdge("pt_edge", src, dst, nogdb::Record {}.set("cost", static_cast<int>(rng() % 10)));
+            }
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    const auto edgeFilters = std::vector<nogdb::GraphFilter> {
+        nogdb::GraphFilter {}, nogdb::GraphFilter { nogdb::Condition("cost").lt(7) }.only("pt_edge") };
+    const auto vertexFilters = std::vector<nogdb::GraphFilter> {
+        nogdb::GraphFilter {}, nogdb::GraphFilter { !nogdb::Condition("group").eq(2) } };
+    const auto depths = std::vector<std::pair<unsigned int, unsigned int>> {
+        { 0, std::numeric_limits<unsigned int>::max() }, { 2, 3 }, { 0, 0 } };
+    auto isSame = [](const nogdb::ResultSet& lhs, const nogdb::ResultSet& rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (auto i = size_t { 0 }; i < lhs.size(); ++i) {
+            if (lhs[i].descriptor != rhs[i].descriptor || lhs[i].record.getDepth() != rhs[i].record.getDepth()) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto traverse = [&](const nogdb::Transaction& txn, int direction, const nogdb::RecordDescriptor& source) {
+        return (direction == 0) ? txn.traverseOut(source) : (direction == 1) ? txn.traverseIn(source) : txn.traverse(source);
+    };
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto wideCount = 0;
+        for (auto direction = 0; direction < 3; ++direction) {
+            for (const auto& edgeFilter : edgeFilters) {
+                for (const auto& vertexFilter : vertexFilters) {
+                    for (const auto& depth : depths) {
+                        auto builder = traverse(txn, direction, vertices[direction]).addSource(vertices[100 + direction])
+                                           .whereE(edgeFilter).whereV(vertexFilter).depth(depth.first, depth.second);
+                        auto expected = builder.get();
+                        assert(isSame(builder.parallel(4).get(), expected));
+                        assert(builder.parallel(0).count() == expected.size());
+                        wideCount += (expected.size() > 300) ? 1 : 0;
+                    }
+                }
+            }
+        }
+        assert(wideCount > 0);
+
+        auto plan = txn.traverse(vertices[0]).parallel(4).explain();
+        assert(plan.stages[0].operation == "TRAVERSE");
+        assert(plan.stages[0].detail.find("threads=4") != std::string::npos);
+        assert(plan.stages[0].rowsScanned == txn.traverse(vertices[0]).explain().stages[0].rowsScanned);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        // the writes of a read-write transaction are traversed on a single thread
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        auto vertex = txn.addVertex("pt_vertex", nogdb::Record {}.set("group", 1));
+        txn.addEdge("pt_edge", vertices[0], vertex, nogdb::Record {}.set("cost", 1));
+        auto expected = txn.traverseOut(vertices[0]).get();
+        assert(isSame(txn.traverseOut(vertices[0]).parallel(4).get(), expected));
+        assert(txn.traverseOut(vertices[0]).parallel(4).explain().stages[0].detail.find("threads") == std::string::npos);
+        txn.rollback();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropClass("pt_other_edge");
+        txn.dropClass("pt_edge");
+        txn.dropClass("pt_vertex");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
+
+void test_benchmark_parallel_traverse()
+{
+    const auto vertexCount = 5000;
+    auto vertices = std::vector<nogdb::RecordDescriptor> {};
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("pt_vertex", nogdb::ClassType::VERTEX);
+        txn.addProperty("pt_vertex", "group", nogdb::PropertyType::INTEGER);
+        txn.addClass("pt_edge", nogdb::ClassType::EDGE);
+        auto rng = std::mt19937 { 29 };
+        for (auto i = 0; i < vertexCount; ++i) {
+            vertices.emplace_back(txn.addVertex("pt_vertex", nogdb::Record {}.set("group", i % 10)));
+        }
+        for (auto i = 0; i < vertexCount * 5; ++i) {
+            txn.addEdge("pt_edge", vertices[rng() % vertices.size()], vertices[rng() % vertices.size()]);
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto expectedCount = size_t { 0 };
+        std::cout << "[";
+        for (auto nThreads : { 1U, 2U, 4U, 8U }) {
+            auto start = std::chrono::steady_clock::now();
+            auto count = txn.traverseOut(vertices[0])
+                             .whereV(nogdb::GraphFilter { nogdb::Condition("group").lt(9) })
+                             .depth(1, 10)
+                             .parallel(nThreads)
+                             .get()
+                             .size();
+            auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            expectedCount = (nThreads == 1) ? count : expectedCount;
+            assert(count == expectedCount);
+            std::cout << ((nThreads > 1) ? ", " : "") << nThreads << " threads: " << elapsed << "ms";
+        }
+        std::cout << " for " << expectedCount << " vertices] ";
+        assert(expectedCount > static_cast<size_t>(vertexCount / 2));
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropClass("pt_edge");
+        txn.dropClass("pt_vertex");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
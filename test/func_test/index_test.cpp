@@ -19,6 +19,9 @@
  *
  */
 
+#include <chrono>
+#include <cmath>
+
 #include "func_test.h"
 #include "setup_cleanup.h"
 
@@ -1822,10 +1825,2422 @@ void test_search_by_index_non_unique_cursor_multicondition()
 
 void test_search_by_index_extended_class_multicondition()
 {
-    // TODO
+    init_vertex_index_test();
+
+    // the properties are inherited from index_test, only index_test2 has indexes on them
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addSubClassOf("index_test", "index_test2");
+        txn.addSubClassOf("index_test", "index_test3");
+        txn.addIndex("index_test2", "index_int", false);
+        txn.addIndex("index_test2", "index_real", false);
+        for (const auto& className : { "index_test", "index_test2", "index_test3" }) {
+            for (auto i = 0; i < 20; ++i) {
+                auto record = nogdb::Record {}.set("index_bigint", int64_t { i });
+                if (i % 7 != 0) record.set("index_int", int32_t { i % 5 - 2 });
+                if (i % 6 != 0) record.set("index_real", (i % 4) - 1.5);
+                txn.addVertex(className, record);
+            }
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto getIds = [&txn](const std::string& className, const nogdb::MultiCondition& condition) {
+            auto ids = std::vector<int64_t> {};
+            for (const auto& res : txn.find(className).where(condition).get()) {
+                ids.emplace_back(res.record.get("index_bigint").toBigInt());
+            }
+            std::sort(ids.begin(), ids.end());
+            return ids;
+        };
+        auto range = nogdb::Condition("index_int").gt(int32_t { 0 }) && nogdb::Condition("index_int").lt(int32_t { 2 });
+        for (const auto& condition : std::vector<nogdb::MultiCondition> {
+                 range,
+                 nogdb::Condition("index_int").ge(int32_t { 0 }) && nogdb::Condition("index_real").lt(0.0),
+                 nogdb::Condition("index_int").eq(int32_t { 1 }) || nogdb::Condition("index_real").gt(1.0) }) {
+            auto ids = getIds("index_test3", condition);
+            assert(!ids.empty());
+            assert(getIds("index_test2", condition) == ids);
+            assert(txn.find("index_test2").where(condition).count() == ids.size());
+            assert(txn.find("index_test2").where(condition).explain().stages[0].operation == "INDEX_SCAN");
+            ASSERT_SIZE(txn.findSubClassOf("index_test").where(condition).get(), ids.size() * 3);
+        }
+        ASSERT_SIZE(txn.find("index_test2").where(range).get(), 4);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropClass("index_test2");
+        txn.dropClass("index_test3");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
 }
 
 void test_search_by_index_extended_class_cursor_multicondition()
 {
     // TODO
 }
+
+void test_search_by_index_partial_multicondition()
+{
+    init_vertex_index_test();
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addIndex("index_test", "index_int", false);
+        txn.addIndex("index_test", "index_bigint", false);
+        txn.addIndex("index_test", "index_text", true);
+        for (auto i = 0; i < 500; ++i) {
+            auto r = nogdb::Record {};
+            r.set("index_int", static_cast<int32_t>(i % 10))
+                .set("index_bigint", static_cast<int64_t>(i % 7) - 3)
+                .set("index_text", "name" + std::to_string(i));
+            if (i % 3 != 0) {
+                r.set("index_real", i * 0.5);
+            }
+            txn.addVertex("index_test", r);
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+    auto all = txn.find("index_test").get();
+    assert(all.size() == 500);
+    auto check = [&](const nogdb::MultiCondition& conditions, std::function<bool(const nogdb::Record&)> expected) {
+        auto expectedResult = std::vector<nogdb::RecordDescriptor> {};
+        for (const auto& result : all) {
+            if (expected(result.record)) {
+                expectedResult.emplace_back(result.descriptor);
+            }
+        }
+        auto res = txn.find("index_test").where(conditions).get();
+        ASSERT_SIZE(res, expectedResult.size());
+        for (size_t i = 0; i < res.size(); ++i) {
+            assert(res[i].descriptor == expectedResult[i]);
+        }
+        assert(txn.find("index_test").where(conditions).count() == expectedResult.size());
+        auto cursor = txn.find("index_test").where(conditions).getCursor();
+        assert(cursor.size() == expectedResult.size());
+    };
+    auto hasReal = [](const nogdb::Record& r, double value) {
+        return !r.get("index_real").empty() && r.get("index_real").toReal() > value;
+    };
+    try {
+        check(nogdb::Condition("index_int").eq(int32_t { 3 }) && nogdb::Condition("index_text").like("name1%"),
+            [](const nogdb::Record& r) {
+                return r.get("index_int").toInt() == 3 && r.get("index_text").toText().find("name1") == 0;
+            });
+        check(nogdb::Condition("index_int").eq(int32_t { 3 }) && nogdb::Condition("index_real").gt(100.0)
+                && nogdb::Condition("index_bigint").eq(int64_t { -2 }),
+            [&](const nogdb::Record& r) {
+                return r.get("index_int").toInt() == 3 && hasReal(r, 100.0) && r.get("index_bigint").toBigInt() == -2;
+            });
+        check(nogdb::Condition("index_text").eq("name42") && nogdb::Condition("index_real").gt(0.0),
+            [&](const nogdb::Record& r) {
+                return r.get("index_text").toText() == "name42" && hasReal(r, 0.0);
+            });
+        check((nogdb::Condition("index_int").eq(int32_t { 3 }) || nogdb::Condition("index_real").gt(240.0))
+                && nogdb::Condition("index_bigint").eq(int64_t { 1 }),
+            [&](const nogdb::Record& r) {
+                return (r.get("index_int").toInt() == 3 || hasReal(r, 240.0)) && r.get("index_bigint").toBigInt() == 1;
+            });
+        check(!(nogdb::Condition("index_int").eq(int32_t { 3 }) && nogdb::Condition("index_real").gt(100.0)),
+            [&](const nogdb::Record& r) {
+                return !(r.get("index_int").toInt() == 3 && hasReal(r, 100.0));
+            });
+        check(nogdb::Condition("index_int").eq(int32_t { 11 }) && nogdb::Condition("index_real").gt(0.0),
+            [](const nogdb::Record&) { return false; });
+
+        auto res = txn.find("index_test").indexed()
+            .where(nogdb::Condition("index_int").eq(int32_t { 7 }) && nogdb::Condition("index_real").gt(100.0)).get();
+        auto expectedCount = size_t { 0 };
+        for (const auto& result : all) {
+            expectedCount += (result.record.get("index_int").toInt() == 7 && hasReal(result.record, 100.0)) ? 1 : 0;
+        }
+        ASSERT_SIZE(res, expectedCount);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    txn.rollback();
+
+    try {
+        txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropIndex("index_test", "index_int");
+        txn.dropIndex("index_test", "index_bigint");
+        txn.dropIndex("index_test", "index_text");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_analyze_statistics()
+{
+    init_vertex_index_test();
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addIndex("index_test", "index_int", false);
+        for (auto i = 0; i < 1000; ++i) {
+            auto r = nogdb::Record {};
+            // value 0 is heavily skewed, the others are spread evenly in [1, 100]
+            r.set("index_int", static_cast<int32_t>((i % 2 == 0) ? 0 : (i / 2) % 100 + 1))
+                .set("index_text", "name" + std::to_string(i % 10));
+            if (i % 4 != 0) {
+                r.set("index_real", i * 0.5);
+            }
+            txn.addVertex("index_test", r);
+        }
+        auto stats = txn.getStatistics("index_test");
+        assert(stats.rowCount == 1000);
+        assert(stats.properties.empty());
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        auto stats = txn.analyze("index_test");
+        assert(stats.className == "index_test");
+        assert(stats.rowCount == 1000);
+        auto statsCount = size_t { 0 };
+        for (const auto& property : stats.properties) {
+            assert(property.rowCount == 1000);
+            auto histogramCount = uint64_t { 0 };
+            auto histogramDistinct = uint64_t { 0 };
+            for (const auto& bucket : property.histogram) {
+                histogramCount += bucket.count;
+                histogramDistinct += bucket.distinctCount;
+            }
+            assert(histogramCount + property.nullCount == property.rowCount);
+            assert(histogramDistinct == property.distinctCount);
+            if (property.propertyName == "index_int") {
+                ++statsCount;
+                assert(property.indexId != 0);
+                assert(property.type == nogdb::PropertyType::INTEGER);
+                assert(property.nullCount == 0);
+                assert(property.distinctCount == 101);
+                assert(!property.mostCommonValues.empty());
+                assert(property.mostCommonValues[0].first.toInt() == 0);
+                assert(property.mostCommonValues[0].second == 500);
+                assert(property.histogram.front().lowerBound.toInt() == 0);
+                assert(property.histogram.back().upperBound.toInt() == 100);
+            } else if (property.propertyName == "index_text") {
+                ++statsCount;
+                assert(property.indexId == 0);
+                assert(property.distinctCount == 10);
+                assert(property.mostCommonValues.empty());
+                assert(property.histogram.front().lowerBound.toText() == "name0");
+                assert(property.histogram.back().upperBound.toText() == "name9");
+            } else if (property.propertyName == "index_real") {
+                ++statsCount;
+                assert(property.nullCount == 250);
+                assert(property.distinctCount == 750);
+            } else if (property.propertyName == "index_bigint") {
+                ++statsCount;
+                assert(property.nullCount == 1000);
+                assert(property.distinctCount == 0);
+                assert(property.histogram.empty());
+            }
+        }
+        assert(statsCount == 4);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addVertex("index_test", nogdb::Record {}.set("index_int", int32_t { 1 }));
+        auto stats = txn.getStatistics("index_test");
+        assert(stats.rowCount == 1001);
+        for (const auto& property : stats.properties) {
+            assert(property.rowCount == 1000);
+        }
+        txn.dropProperty("index_test", "index_real");
+        stats = txn.getStatistics("index_test");
+        for (const auto& property : stats.properties) {
+            assert(property.propertyName != "index_real");
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto stats = txn.getStatistics("index_test");
+        assert(stats.rowCount == 1001);
+        assert(stats.properties.size() > 0);
+        auto res = txn.find("index_test")
+            .where(nogdb::Condition("index_int").eq(int32_t { 0 }) && nogdb::Condition("index_text").eq("name2")).get();
+        ASSERT_SIZE(res, 100);
+        txn.analyze("index_test");
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_TXN_INVALID_MODE, "NOGDB_TXN_INVALID_MODE");
+    }
+
+    // a class with more values than the sample gets exact null counts and estimated distinct counts
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("index_sample_test", nogdb::ClassType::VERTEX);
+        txn.addProperty("index_sample_test", "value", nogdb::PropertyType::INTEGER);
+        for (auto i = 0; i < 40000; ++i) {
+            auto record = nogdb::Record {};
+            if (i % 8 != 0) {
+                record.set("value", static_cast<int32_t>(i % 1000));
+            }
+            txn.addVertex("index_sample_test", record);
+        }
+        auto stats = txn.analyze("index_sample_test");
+        assert(stats.rowCount == 40000 && stats.properties.size() == 1);
+        const auto& property = stats.properties[0];
+        assert(property.nullCount == 5000);
+        assert(property.distinctCount >= 800 && property.distinctCount <= 1000);
+        auto histogramCount = uint64_t { 0 };
+        auto histogramDistinct = uint64_t { 0 };
+        for (const auto& bucket : property.histogram) {
+            histogramCount += bucket.count;
+            histogramDistinct += bucket.distinctCount;
+        }
+        assert(histogramCount + property.nullCount == property.rowCount);
+        assert(histogramDistinct == property.distinctCount);
+        txn.dropClass("index_sample_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    // NaN values are ordered above all numbers instead of being equal to each of them
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("index_nan_test", nogdb::ClassType::VERTEX);
+        txn.addProperty("index_nan_test", "value", nogdb::PropertyType::REAL);
+        for (auto i = 0; i < 2000; ++i) {
+            auto value = (i % 4 == 0) ? std::nan("") : static_cast<double>(i % 500);
+            txn.addVertex("index_nan_test", nogdb::Record {}.set("value", value));
+        }
+        auto stats = txn.analyze("index_nan_test");
+        assert(stats.rowCount == 2000 && stats.properties.size() == 1);
+        const auto& property = stats.properties[0];
+        assert(property.nullCount == 0);
+        assert(property.distinctCount == 376);
+        assert(property.histogram.size() > 1);
+        assert(property.histogram.front().lowerBound.toReal() == 1.0);
+        assert(std::isnan(property.histogram.back().upperBound.toReal()));
+        assert(!property.mostCommonValues.empty());
+        assert(std::isnan(property.mostCommonValues[0].first.toReal()));
+        assert(property.mostCommonValues[0].second == 500);
+        auto histogramCount = uint64_t { 0 };
+        for (const auto& bucket : property.histogram) {
+            histogramCount += bucket.count;
+        }
+        assert(histogramCount == property.rowCount);
+        txn.dropClass("index_nan_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropIndex("index_test", "index_int");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        txn.getStatistics("index_test");
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_NOEXST_CLASS, "NOGDB_CTX_NOEXST_CLASS");
+    }
+}
+
+void test_explain_find_plan()
+{
+    init_vertex_index_test();
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addIndex("index_test", "index_int", false);
+        for (auto i = 0; i < 200; ++i) {
+            txn.addVertex("index_test", nogdb::Record {}
+                .set("index_int", static_cast<int32_t>(i % 20))
+                .set("index_text", "name" + std::to_string(i))
+                .set("index_real", i * 0.5));
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto indexId = txn.getIndex("index_test", "index_int").id;
+
+        auto find = txn.find("index_test").where(nogdb::Condition("index_int").eq(int32_t { 3 }));
+        auto plan = find.explain();
+        assert(plan.actualRows == 10);
+        assert(plan.actualRows == find.get().size());
+        assert(plan.stages.size() == 2);
+        assert(plan.stages[0].operation == "INDEX_SCAN");
+        assert(plan.stages[0].className == "index_test");
+        assert(plan.stages[0].indexIds.size() == 1 && plan.stages[0].indexIds[0] == indexId);
+        assert(plan.stages[0].estimatedRows == 10);
+        assert(plan.stages[0].indexEntries == 10);
+        assert(plan.stages[1].operation == "FETCH");
+        assert(plan.stages[1].recordsDecoded == 10);
+        assert(plan.stages[1].actualRows == 10);
+
+        plan = txn.find("index_test").where(nogdb::Condition("index_text").eq("name42")).explain();
+        assert(plan.actualRows == 1);
+        assert(plan.stages.size() == 1);
+        assert(plan.stages[0].operation == "FULL_SCAN");
+        assert(plan.stages[0].indexIds.empty());
+        assert(plan.stages[0].estimatedRows == 200);
+        assert(plan.stages[0].rowsScanned == 200);
+        assert(plan.stages[0].recordsDecoded == 200);
+
+        plan = txn.find("index_test").where(nogdb::Condition("index_real").lt(10.0)).explain();
+        assert(plan.actualRows == 20);
+        assert(plan.stages[0].operation == "COLUMN_SCAN");
+        assert(plan.stages[0].rowsScanned == 200);
+        assert(plan.stages[0].recordsDecoded == 20);
+
+        plan = txn.find("index_test")
+            .where(nogdb::Condition("index_int").eq(int32_t { 3 }) && nogdb::Condition("index_real").gt(50.0))
+            .explain();
+        assert(plan.actualRows == 5);
+        assert(plan.stages.size() == 2);
+        assert(plan.stages[0].operation == "INDEX_SCAN");
+        assert(plan.stages[0].indexIds.size() == 1 && plan.stages[0].indexIds[0] == indexId);
+        assert(plan.stages[0].actualRows == 10);
+        assert(plan.stages[1].operation == "FILTER");
+        assert(plan.stages[1].recordsDecoded == 10);
+        assert(plan.stages[1].actualRows == 5);
+
+        plan = txn.find("index_test").where([](const nogdb::Record& r) {
+            return r.get("index_int").toInt() == 3;
+        }).explain();
+        assert(plan.actualRows == 10);
+        assert(plan.stages[0].operation == "FUNCTION_SCAN");
+        assert(plan.stages[0].recordsDecoded == 200);
+
+        plan = txn.find("index_test").where(nogdb::Condition("index_text").eq("name42")).indexed().explain();
+        assert(plan.actualRows == 0);
+        assert(plan.stages.empty());
+        assert(!plan.toString().empty());
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropIndex("index_test", "index_int");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_search_by_index_range_against_scan()
+{
+    init_vertex_index_test();
+
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    const auto inf = std::numeric_limits<double>::infinity();
+    const auto denorm = std::numeric_limits<double>::denorm_min();
+    const auto tinyints = std::vector<int8_t> { -128, -5, -1, 0, 1, 5, 127 };
+    const auto ints = std::vector<int32_t> { INT32_MIN, -100, -1, 0, 0, 1, 7, 100, INT32_MAX };
+    const auto bigints = std::vector<int64_t> { INT64_MIN, -(int64_t { 1 } << 40), -1, 0, 1, int64_t { 1 } << 40, INT64_MAX };
+    const auto uints = std::vector<uint32_t> { 0, 1, 5, 100, UINT32_MAX };
+    const auto ubigints = std::vector<uint64_t> { 0, 1, uint64_t { 1 } << 63, UINT64_MAX };
+    const auto tinyintsU = std::vector<uint8_t> { 0, 1, 128, 255 };
+    const auto reals = std::vector<double> { -inf, -2.5, -1.0, -denorm, -0.0, 0.0, denorm, 0.5, 1.0, 2.5, inf, nan, -nan };
+    const auto texts = std::vector<std::string> { "a", "ab", "b", "ba", "B", "", "c", "zz" };
+    auto addRecords = [&](nogdb::Transaction& txn, const std::string& className) {
+        for (auto i = 0; i < 64; ++i) {
+            auto record = nogdb::Record {}.set("id", int64_t { i });
+            auto isNull = [i](int offset) { return (i + offset) % 11 == 0; };
+            if (!isNull(1)) record.set("index_tinyint", tinyints[i % tinyints.size()]);
+            if (!isNull(2)) record.set("index_int", ints[i % ints.size()]);
+            if (!isNull(3)) record.set("index_bigint", bigints[i % bigints.size()]);
+            if (!isNull(4)) record.set("index_int_u", uints[i % uints.size()]);
+            if (!isNull(5)) record.set("index_bigint_u", ubigints[i % ubigints.size()]);
+            if (!isNull(6)) record.set("index_tinyint_u", tinyintsU[i % tinyintsU.size()]);
+            if (!isNull(7)) record.set("index_real", reals[i % reals.size()]);
+            if (!isNull(8)) record.set("index_text", texts[i % texts.size()]);
+            if (!isNull(9)) record.set("index_smallint", static_cast<int16_t>(i - 32));
+            if (!isNull(10)) record.set("index_smallint_u", static_cast<uint16_t>(i * 1000));
+            txn.addVertex(className, record);
+        }
+    };
+    auto testAll = [&](nogdb::Transaction& txn, bool isUpdatedOnly) {
+        indexRangeScanTester(txn, "index_test", "index_scan_test", "index_int",
+            std::vector<int32_t> { INT32_MIN, -101, -1, 0, 1, 50, INT32_MAX });
+        indexRangeScanTester(txn, "index_test", "index_scan_test", "index_real",
+            std::vector<double> { -inf, -1.0, -denorm, -0.0, 0.0, 0.75, inf, nan });
+        indexRangeScanTester(txn, "index_test", "index_scan_test", "index_text",
+            std::vector<std::string> { "", "a", "aa", "b", "B", "bb", "zzz" });
+        indexRangeScanTester(txn, "index_test", "index_scan_test", "index_text",
+            std::vector<std::string> { "a", "b" }, true);
+        if (isUpdatedOnly) {
+            return;
+        }
+        indexRangeScanTester(txn, "index_test", "index_scan_test", "index_tinyint",
+            std::vector<int8_t> { -128, -6, -5, -1, 0, 1, 3, 127 });
+        indexRangeScanTester(txn, "index_test", "index_scan_test", "index_bigint",
+            std::vector<int64_t> { INT64_MIN, -(int64_t { 1 } << 41), -1, 0, 2, INT64_MAX });
+        indexRangeScanTester(txn, "index_test", "index_scan_test", "index_smallint",
+            std::vector<int16_t> { -40, -32, -1, 0, 1, 31, 40 });
+        indexRangeScanTester(txn, "index_test", "index_scan_test", "index_int_u",
+            std::vector<uint32_t> { 0, 1, 6, 100, UINT32_MAX });
+        indexRangeScanTester(txn, "index_test", "index_scan_test", "index_bigint_u",
+            std::vector<uint64_t> { 0, 2, uint64_t { 1 } << 63, UINT64_MAX });
+        indexRangeScanTester(txn, "index_test", "index_scan_test", "index_tinyint_u",
+            std::vector<uint8_t> { 0, 127, 128, 255 });
+        indexRangeScanTester(txn, "index_test", "index_scan_test", "index_smallint_u",
+            std::vector<uint16_t> { 0, 999, 1000, 32000, 65535 });
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("index_scan_test", nogdb::ClassType::VERTEX);
+        for (const auto& property : txn.getProperties("index_test")) {
+            txn.addProperty("index_scan_test", property.name, property.type);
+        }
+        txn.addProperty("index_test", "id", nogdb::PropertyType::BIGINT);
+        txn.addProperty("index_scan_test", "id", nogdb::PropertyType::BIGINT);
+        // half of the indexes are built from existing records, the others are maintained on insert
+        txn.addIndex("index_test", "index_int", false);
+        txn.addIndex("index_test", "index_real", false);
+        txn.addIndex("index_test", "index_text", false);
+        txn.addIndex("index_test", "index_smallint", true);
+        txn.addIndex("index_test", "index_tinyint_u", false);
+        addRecords(txn, "index_test");
+        addRecords(txn, "index_scan_test");
+        txn.addIndex("index_test", "index_tinyint", false);
+        txn.addIndex("index_test", "index_bigint", false);
+        txn.addIndex("index_test", "index_int_u", false);
+        txn.addIndex("index_test", "index_bigint_u", false);
+        txn.addIndex("index_test", "index_smallint_u", true);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto plan = txn.find("index_test").where(nogdb::Condition("index_real").between(-1.0, 1.0)).explain();
+        assert(plan.stages[0].operation == "INDEX_SCAN");
+        plan = txn.find("index_test").where(!nogdb::Condition("index_text").ge("b")).explain();
+        assert(plan.stages[0].operation == "INDEX_SCAN");
+        plan = txn.find("index_test").where(nogdb::Condition("index_real").lt(nan)).explain();
+        assert(plan.stages[0].operation != "INDEX_SCAN");
+        plan = txn.find("index_test").where(nogdb::Condition("index_text").ignoreCase().lt("b")).explain();
+        assert(plan.stages[0].operation != "INDEX_SCAN");
+        testAll(txn, false);
+
+        // a negated node holds for the records without one of its properties, which its index complements miss
+        auto getIds = [&txn](const std::string& className, const nogdb::MultiCondition& condition) {
+            auto ids = std::vector<int64_t> {};
+            for (const auto& res : txn.find(className).where(condition).get()) {
+                ids.emplace_back(res.record.get("id").toBigInt());
+            }
+            std::sort(ids.begin(), ids.end());
+            return ids;
+        };
+        auto positive = nogdb::Condition("index_int").gt(int32_t { 0 });
+        auto negative = nogdb::Condition("index_real").lt(0.0);
+        auto text = nogdb::Condition("index_text").ge("b");
+        for (const auto& condition : std::vector<nogdb::MultiCondition> {
+                 !(positive && negative), !(positive || negative), !(positive && negative) && text,
+                 !(!(positive && negative)), (!(positive || text)) || negative, !(positive && !(negative || text)) }) {
+            auto ids = getIds("index_scan_test", condition);
+            assert(!ids.empty());
+            assert(getIds("index_test", condition) == ids);
+        }
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    // index entries of removed and updated records, including NaN and negative zero keys, must go away
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        for (const auto& className : { "index_test", "index_scan_test" }) {
+            for (const auto& res : txn.find(className).get()) {
+                auto id = res.record.get("id").toBigInt();
+                if (id % 5 == 0) {
+                    txn.remove(res.descriptor);
+                } else if (id % 3 == 0) {
+                    auto record = res.record;
+                    txn.update(res.descriptor, record
+                        .set("index_real", reals[(id + 1) % reals.size()])
+                        .set("index_int", ints[(id + 1) % ints.size()])
+                        .set("index_text", texts[(id + 1) % texts.size()]));
+                }
+            }
+        }
+        testAll(txn, true);
+        indexRangeScanTester(txn, "index_test", "index_scan_test", "index_tinyint",
+            std::vector<int8_t> { -128, -1, 0, 5 });
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        for (const auto& propertyName : { "index_int", "index_real", "index_text", "index_smallint", "index_tinyint_u",
+                 "index_tinyint", "index_bigint", "index_int_u", "index_bigint_u", "index_smallint_u" }) {
+            txn.dropIndex("index_test", propertyName);
+        }
+        txn.dropClass("index_scan_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_benchmark_index_range_query()
+{
+    init_vertex_index_test();
+
+    const auto recordCount = 10000;
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("index_scan_test", nogdb::ClassType::VERTEX);
+        txn.addProperty("index_scan_test", "index_int", nogdb::PropertyType::INTEGER);
+        txn.addIndex("index_test", "index_int", false);
+        for (auto i = 0; i < recordCount; ++i) {
+            auto record = nogdb::Record {}.set("index_int", static_cast<int32_t>((i * 7919) % recordCount));
+            txn.addVertex("index_test", record);
+            txn.addVertex("index_scan_test", record);
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto measure = [&](const std::string& className, const nogdb::Condition& condition, size_t& count) {
+            auto start = std::chrono::steady_clock::now();
+            count = txn.find(className).where(condition).get().size();
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        };
+        std::cout << "[";
+        for (const auto& percent : { 0.1, 1.0, 10.0, 50.0 }) {
+            auto width = static_cast<int32_t>(recordCount * percent / 100);
+            auto condition = nogdb::Condition("index_int").between(int32_t { 1000 }, 1000 + width, { true, false });
+            auto indexCount = size_t {}, scanCount = size_t {};
+            auto indexTime = measure("index_test", condition, indexCount);
+            auto scanTime = measure("index_scan_test", condition, scanCount);
+            assert(indexCount == static_cast<size_t>(width));
+            assert(indexCount == scanCount);
+            auto start = std::chrono::steady_clock::now();
+            assert(txn.find("index_test").where(condition).count() == indexCount);
+            auto countTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            start = std::chrono::steady_clock::now();
+            auto cursor = txn.find("index_test").where(condition).getCursor();
+            for (auto i = 0; i < 10 && cursor.next(); ++i) {
+                assert(cursor->record.getInt("index_int") >= 1000);
+            }
+            auto cursorTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            std::cout << ((percent > 0.1) ? ", " : "") << percent << "%: index " << indexTime << "ms / scan "
+                      << scanTime << "ms / count " << countTime << "ms / first page " << cursorTime << "ms";
+        }
+        std::cout << "] ";
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropIndex("index_test", "index_int");
+        txn.dropClass("index_scan_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_composite_index()
+{
+    init_vertex_index_test();
+
+    const auto texts = std::vector<std::string> { "a", "ab", "", "b", std::string("a\0b", 3), "c" };
+    const auto reals = std::vector<double> { -2.5, -0.0, 0.0, 1.0, std::numeric_limits<double>::quiet_NaN() };
+    auto addRecords = [&](nogdb::Transaction& txn, const std::string& className, int begin, int end) {
+        for (auto i = begin; i < end; ++i) {
+            auto record = nogdb::Record {}.set("id", int64_t { i });
+            if (i % 13 != 0) record.set("index_int", static_cast<int32_t>(i % 7 - 3));
+            if (i % 11 != 0) record.set("index_text", texts[i % texts.size()]);
+            if (i % 9 != 0) record.set("index_real", reals[i % reals.size()]);
+            txn.addVertex(className, record);
+        }
+    };
+    auto getIds = [](nogdb::Transaction& txn, const std::string& className, const nogdb::MultiCondition& condition,
+                      bool isIndexed) {
+        auto ids = std::vector<int64_t> {};
+        auto find = txn.find(className);
+        auto result = (isIndexed) ? find.indexed().where(condition).get() : find.where(condition).get();
+        for (const auto& res : result) {
+            ids.emplace_back(res.record.get("id").toBigInt());
+        }
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    };
+    auto testAll = [&](nogdb::Transaction& txn) {
+        auto intIndexId = txn.getIndex("index_test", { "index_int", "index_text" }).id;
+        auto conditions = std::vector<nogdb::MultiCondition> {};
+        for (const auto& value : { int32_t { -3 }, int32_t { 0 }, int32_t { 3 } }) {
+            auto intEq = nogdb::Condition("index_int").eq(value);
+            for (const auto& text : texts) {
+                conditions.emplace_back(intEq && nogdb::Condition("index_text").eq(text));
+                conditions.emplace_back(intEq && nogdb::Condition("index_text").gt(text));
+                conditions.emplace_back(intEq && nogdb::Condition("index_text").le(text));
+                conditions.emplace_back(nogdb::Condition("index_text").eq(text) && nogdb::Condition("index_real").ge(0.0));
+                conditions.emplace_back(nogdb::Condition("index_text").eq(text) && nogdb::Condition("index_real").lt(0.0));
+            }
+            conditions.emplace_back(intEq && nogdb::Condition("index_text").between("a", "b", { false, true }));
+            conditions.emplace_back(nogdb::Condition("index_int").gt(value) && nogdb::Condition("index_real").ge(-1.0));
+        }
+        for (const auto& condition : conditions) {
+            auto indexedIds = getIds(txn, "index_test", condition, false);
+            auto scannedIds = getIds(txn, "index_scan_test", condition, false);
+            assert(indexedIds == scannedIds);
+            assert(txn.find("index_test").where(condition).count() == scannedIds.size());
+            auto plan = txn.find("index_test").where(condition).explain();
+            if (plan.stages.size() == 2 && plan.stages[1].operation == "FETCH") {
+                assert(plan.stages[0].indexIds.size() == 1);
+                assert(getIds(txn, "index_test", condition, true) == scannedIds);
+            }
+        }
+        auto plan = txn.find("index_test")
+            .where(nogdb::Condition("index_int").eq(int32_t { 1 }) && nogdb::Condition("index_text").lt("b"))
+            .explain();
+        assert(plan.stages.size() == 2 && plan.stages[1].operation == "FETCH");
+        assert(plan.stages[0].indexIds.size() == 1 && plan.stages[0].indexIds[0] == intIndexId);
+        // a range on the first column cannot be followed by the second one
+        plan = txn.find("index_test")
+            .where(nogdb::Condition("index_int").ge(int32_t { 1 }) && nogdb::Condition("index_text").eq("a"))
+            .explain();
+        assert(plan.stages.back().operation == "FILTER");
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("index_scan_test", nogdb::ClassType::VERTEX);
+        for (const auto& property : txn.getProperties("index_test")) {
+            txn.addProperty("index_scan_test", property.name, property.type);
+        }
+        txn.addProperty("index_test", "id", nogdb::PropertyType::BIGINT);
+        txn.addProperty("index_scan_test", "id", nogdb::PropertyType::BIGINT);
+        addRecords(txn, "index_test", 0, 100);
+        addRecords(txn, "index_scan_test", 0, 100);
+        // one index is built from existing records and the other is maintained on insert
+        auto index = txn.addIndex("index_test", { "index_int", "index_text" });
+        assert(index.propertyIds.size() == 2 && !index.unique);
+        assert(index.propertyId == txn.getProperty("index_test", "index_int").id);
+        assert(index == txn.getIndex("index_test", { "index_int", "index_text" }));
+        txn.addIndex("index_test", std::vector<std::string> { "index_text", "index_real" });
+        addRecords(txn, "index_test", 100, 200);
+        addRecords(txn, "index_scan_test", 100, 200);
+        assert(txn.getIndexes(txn.getClass("index_test")).size() == 2);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        try {
+            txn.addIndex("index_test", { "index_int", "index_text" });
+            assert(false);
+        } catch (const nogdb::Error& ex) {
+            REQUIRE(ex, NOGDB_CTX_DUPLICATE_INDEX, "NOGDB_CTX_DUPLICATE_INDEX");
+        }
+        try {
+            txn.addIndex("index_test", { "index_int", "index_blob" });
+            assert(false);
+        } catch (const nogdb::Error& ex) {
+            REQUIRE(ex, NOGDB_CTX_INVALID_PROPTYPE_INDEX, "NOGDB_CTX_INVALID_PROPTYPE_INDEX");
+        }
+        try {
+            txn.addIndex("index_test", { "index_int", "index_int" });
+            assert(false);
+        } catch (const nogdb::Error& ex) {
+            REQUIRE(ex, NOGDB_CTX_DUPLICATE_PROPERTY, "NOGDB_CTX_DUPLICATE_PROPERTY");
+        }
+        try {
+            txn.getIndex("index_test", { "index_text", "index_int" });
+            assert(false);
+        } catch (const nogdb::Error& ex) {
+            REQUIRE(ex, NOGDB_CTX_NOEXST_INDEX, "NOGDB_CTX_NOEXST_INDEX");
+        }
+        try {
+            txn.dropProperty("index_test", "index_real");
+            assert(false);
+        } catch (const nogdb::Error& ex) {
+            REQUIRE(ex, NOGDB_CTX_IN_USED_PROPERTY, "NOGDB_CTX_IN_USED_PROPERTY");
+        }
+        testAll(txn);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        for (const auto& className : { "index_test", "index_scan_test" }) {
+            for (const auto& res : txn.find(className).get()) {
+                auto id = res.record.get("id").toBigInt();
+                if (id % 5 == 0) {
+                    txn.remove(res.descriptor);
+                } else if (id % 3 == 0) {
+                    txn.update(res.descriptor, nogdb::Record {}
+                        .set("id", id)
+                        .set("index_int", static_cast<int32_t>(id % 5 - 2))
+                        .set("index_text", texts[(id + 1) % texts.size()]));
+                }
+            }
+        }
+        testAll(txn);
+        assert(txn.find("index_test").count() == txn.find("index_scan_test").get().size());
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    // tuples with missing values never conflict in a unique index
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addIndex("index_test", { "index_smallint", "index_smallint_u" }, true);
+        auto record = nogdb::Record {}.set("index_smallint", int16_t { 1 });
+        txn.addVertex("index_test", record);
+        txn.addVertex("index_test", record);
+        txn.addVertex("index_test", record.set("index_smallint_u", uint16_t { 2 }));
+        txn.addVertex("index_test", record.set("index_smallint_u", uint16_t { 3 }));
+        try {
+            txn.addVertex("index_test", record);
+            assert(false);
+        } catch (const nogdb::FatalError&) {
+            // a unique constraint violation rolls the transaction back
+        }
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        auto record = nogdb::Record {}.set("index_smallint", int16_t { 1 }).set("index_smallint_u", uint16_t { 2 });
+        txn.addVertex("index_test", record);
+        txn.addVertex("index_test", record);
+        txn.addIndex("index_test", { "index_smallint", "index_smallint_u" }, true);
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_INVALID_INDEX_CONSTRAINT, "NOGDB_CTX_INVALID_INDEX_CONSTRAINT");
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropIndex("index_test", { "index_int", "index_text" });
+        txn.dropIndex("index_test", { "index_text", "index_real" });
+        assert(txn.getIndexes(txn.getClass("index_test")).empty());
+        txn.dropClass("index_scan_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_search_by_index_lazy_cursor()
+{
+    init_vertex_index_test();
+
+    const auto recordCount = 1000;
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addIndex("index_test", "index_int", false);
+        txn.addIndex("index_test", "index_text", true);
+        for (auto i = 0; i < recordCount; ++i) {
+            txn.addVertex("index_test", nogdb::Record {}
+                .set("index_int", static_cast<int32_t>((i * 7919) % (recordCount / 4)) - 100)
+                .set("index_text", "text" + std::to_string((i * 7919) % recordCount)));
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto condition = nogdb::Condition("index_int").ge(int32_t { -50 });
+        auto cursor = txn.find("index_test").where(condition).getCursor();
+        assert(!cursor.empty());
+        auto values = std::vector<int32_t> {};
+        while (cursor.next()) {
+            values.emplace_back(cursor->record.getInt("index_int"));
+        }
+        assert(values.size() == txn.find("index_test").where(condition).count());
+        assert(values.size() == static_cast<size_t>(recordCount / 4 - 50) * 4);
+        assert(std::is_sorted(values.cbegin(), values.cend()));
+        assert(values.front() == -50);
+        assert(cursor.size() == values.size());
+
+        cursor = txn.find("index_test").where(nogdb::Condition("index_int").lt(int32_t { 0 })).getCursor();
+        assert(cursor.to(5));
+        assert(cursor->record.getInt("index_int") == -99);
+        cursor.last();
+        assert(cursor->record.getInt("index_int") == -1);
+        assert(cursor.previous());
+        assert(cursor->record.getInt("index_int") == -1);
+        assert(cursor.size() == 400);
+
+        cursor = txn.find("index_test").where(nogdb::Condition("index_text").gt(std::string { "text5" })).getCursor();
+        auto texts = std::vector<std::string> {};
+        while (cursor.next()) {
+            texts.emplace_back(cursor->record.getText("index_text"));
+        }
+        assert(std::is_sorted(texts.cbegin(), texts.cend()));
+        assert(std::adjacent_find(texts.cbegin(), texts.cend()) == texts.cend());
+        assert(texts.size() == txn.find("index_test").where(nogdb::Condition("index_text").gt(std::string { "text5" })).count());
+        assert(texts.front() == "text50");
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        // records updated and removed behind the cursor are neither repeated nor skipped
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        auto cursor = txn.find("index_test").where(nogdb::Condition("index_int").lt(int32_t { 0 })).getCursor();
+        auto visited = std::set<nogdb::RecordId> {};
+        while (cursor.next()) {
+            assert(visited.insert(cursor->descriptor.rid).second);
+            if (visited.size() % 2 == 0) {
+                txn.remove(cursor->descriptor);
+            } else {
+                auto record = cursor->record;
+                txn.update(cursor->descriptor, record.set("index_int", int32_t { -1000 }));
+            }
+        }
+        assert(visited.size() == 400);
+        assert(txn.find("index_test").where(nogdb::Condition("index_int").lt(int32_t { 0 })).count() == 200);
+        assert(txn.find("index_test").where(nogdb::Condition("index_int").eq(int32_t { -1000 })).count() == 200);
+        txn.rollback();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropIndex("index_test", "index_int");
+        txn.dropIndex("index_test", "index_text");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_create_index_with_many_existing_records()
+{
+    init_vertex_index_test();
+
+    const auto recordCount = 20000;
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        for (auto i = 0; i < recordCount; ++i) {
+            auto value = (i * 7919) % recordCount;
+            txn.addVertex("index_test", nogdb::Record {}
+                .set("index_int", static_cast<int32_t>(value % 1000) - 500)
+                .set("index_real", (value % 3000) / -8.0)
+                .set("index_text", "text" + std::to_string(value)));
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    const auto conditions = std::vector<nogdb::Condition> {
+        nogdb::Condition("index_int").eq(int32_t { -500 }),
+        nogdb::Condition("index_int").between(int32_t { -10 }, int32_t { 10 }),
+        nogdb::Condition("index_real").lt(-370.0),
+        nogdb::Condition("index_text").ge(std::string { "text9" }),
+        nogdb::Condition("index_text").eq(std::string { "text12345" })
+    };
+    auto scanResults = std::vector<std::vector<nogdb::RecordDescriptor>> {};
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        for (const auto& condition : conditions) {
+            auto descriptors = std::vector<nogdb::RecordDescriptor> {};
+            for (const auto& result : txn.find("index_test").where(condition).get()) {
+                descriptors.emplace_back(result.descriptor);
+            }
+            assert(!descriptors.empty());
+            scanResults.emplace_back(descriptors);
+        }
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        auto start = std::chrono::steady_clock::now();
+        txn.addIndex("index_test", "index_int", false);
+        txn.addIndex("index_test", "index_real", false);
+        txn.addIndex("index_test", "index_text", true);
+        txn.addIndex("index_test", { "index_int", "index_real" }, false);
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "[" << recordCount << " records: " << elapsed << "ms] ";
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        for (auto i = 0U; i < conditions.size(); ++i) {
+            assert(rdescCompare("index_test", txn.find("index_test").indexed().where(conditions[i]).get(), scanResults[i]));
+        }
+        auto multiCondition = nogdb::Condition("index_int").eq(int32_t { 0 })
+            && nogdb::Condition("index_real").gt(-200.0);
+        auto byIndex = txn.find("index_test").indexed().where(multiCondition).get();
+        assert(byIndex.size() == txn.find("index_test").where(multiCondition).count());
+        assert(!byIndex.empty());
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropIndex("index_test", "index_int");
+        txn.dropIndex("index_test", "index_real");
+        txn.dropIndex("index_test", "index_text");
+        txn.dropIndex("index_test", { "index_int", "index_real" });
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_covering_index()
+{
+    init_vertex_index_test();
+
+    const auto texts = std::vector<std::string> { "a", "ab", "", "b", "c" };
+    auto addRecords = [&](nogdb::Transaction& txn, int begin, int end) {
+        for (auto i = begin; i < end; ++i) {
+            auto record = nogdb::Record {}.set("index_bigint", int64_t { i });
+            if (i % 13 != 0) record.set("index_int", static_cast<int32_t>(i % 7 - 3));
+            if (i % 11 != 0) record.set("index_text", texts[i % texts.size()]);
+            if (i % 9 != 0) record.set("index_real", (i % 2 == 0) ? -0.0 : i / 4.0);
+            txn.addVertex("index_test", record);
+        }
+    };
+    const auto projection = std::vector<std::string> { "index_int", "index_text", "index_real" };
+    // the covered results must be the fetched records reduced to the projected properties
+    auto assertCovered = [&](nogdb::Transaction& txn, const nogdb::Condition& condition) {
+        auto plan = txn.find("index_test").where(condition).select(projection).explain();
+        assert(plan.stages.size() == 1 && plan.stages[0].operation == "COVERING_INDEX_SCAN");
+        assert(plan.stages[0].recordsDecoded == 0);
+        auto covered = txn.find("index_test").where(condition).select(projection).get();
+        auto fetched = txn.find("index_test").where(condition).get();
+        std::sort(fetched.begin(), fetched.end(), [](const nogdb::Result& lhs, const nogdb::Result& rhs) {
+            return lhs.descriptor < rhs.descriptor;
+        });
+        assert(covered.size() == fetched.size());
+        for (auto i = 0U; i < covered.size(); ++i) {
+            const auto& record = covered[i].record;
+            const auto& expected = fetched[i].record;
+            assert(covered[i].descriptor == fetched[i].descriptor);
+            assert(record.getRecordId() == expected.getRecordId());
+            assert(record.getClassName() == "index_test");
+            assert(record.get("index_bigint").empty());
+            assert(record.get("index_int").empty() == expected.get("index_int").empty());
+            if (!expected.get("index_int").empty()) {
+                assert(record.getInt("index_int") == expected.getInt("index_int"));
+            }
+            assert(record.getText("index_text") == expected.getText("index_text"));
+            assert(record.get("index_real").empty() == expected.get("index_real").empty());
+            if (!expected.get("index_real").empty()) {
+                assert(record.getReal("index_real") == expected.getReal("index_real"));
+                assert(std::signbit(record.getReal("index_real")) == std::signbit(expected.getReal("index_real")));
+            }
+        }
+        assert(!covered.empty());
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        addRecords(txn, 0, 100);
+        // one half of the records is indexed when the index is built and the other one on insert
+        auto index = txn.addIndex("index_test", { "index_int" }, false, { "index_text", "index_real" });
+        assert(index.propertyIds.size() == 1);
+        assert(index.includedPropertyIds.size() == 2);
+        assert(index.includedPropertyIds[1] == txn.getProperty("index_test", "index_real").id);
+        assert(txn.getIndex("index_test", { "index_int" }) == index);
+        assert(txn.getIndex("index_test", { "index_int" }).includedPropertyIds == index.includedPropertyIds);
+        addRecords(txn, 100, 200);
+        for (const auto& result : txn.find("index_test").where(nogdb::Condition("index_bigint").lt(int64_t { 20 })).get()) {
+            auto record = result.record;
+            record.set("index_text", "updated").unset("index_real");
+            txn.update(result.descriptor, record);
+        }
+        for (const auto& result : txn.find("index_test").where(nogdb::Condition("index_bigint").ge(int64_t { 190 })).get()) {
+            txn.remove(result.descriptor);
+        }
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        for (const auto& value : { int32_t { -3 }, int32_t { 0 }, int32_t { 3 } }) {
+            assertCovered(txn, nogdb::Condition("index_int").eq(value));
+            assertCovered(txn, nogdb::Condition("index_int").le(value));
+            assertCovered(txn, nogdb::Condition("index_int").between(value - 1, value + 1));
+        }
+        auto plan = txn.find("index_test").where(nogdb::Condition("index_int").eq(int32_t { 1 }))
+            .select({ "index_int" }).explain();
+        assert(plan.stages[0].operation == "COVERING_INDEX_SCAN");
+        // a property which is neither a key nor an included column needs the records
+        auto condition = nogdb::Condition("index_int").eq(int32_t { 1 });
+        plan = txn.find("index_test").where(condition).select({ "index_int", "index_bigint" }).explain();
+        assert(plan.stages[0].operation != "COVERING_INDEX_SCAN");
+        auto results = txn.find("index_test").where(condition).select({ "index_int", "index_bigint" }).get();
+        assert(results.size() == txn.find("index_test").where(condition).count());
+        for (const auto& result : results) {
+            assert(result.record.getInt("index_int") == 1);
+            assert(!result.record.get("index_bigint").empty());
+            assert(result.record.get("index_text").empty());
+        }
+        // a condition outside of the index key needs the records
+        plan = txn.find("index_test")
+            .where(condition && nogdb::Condition("index_text").eq(std::string { "a" }))
+            .select(projection)
+            .explain();
+        assert(plan.stages[0].operation != "COVERING_INDEX_SCAN");
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        try {
+            txn.dropProperty("index_test", "index_real");
+            assert(false);
+        } catch (const nogdb::Error& ex) {
+            REQUIRE(ex, NOGDB_CTX_IN_USED_PROPERTY, "NOGDB_CTX_IN_USED_PROPERTY");
+        }
+        try {
+            txn.addIndex("index_test", { "index_text" }, false, { "index_text" });
+            assert(false);
+        } catch (const nogdb::Error& ex) {
+            REQUIRE(ex, NOGDB_CTX_DUPLICATE_PROPERTY, "NOGDB_CTX_DUPLICATE_PROPERTY");
+        }
+        txn.dropIndex("index_test", { "index_int" });
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    // texts longer than the key size limit are read from their records in place of their keys
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        const auto prefix = std::string(200, 'n');
+        const auto longTexts = std::vector<std::string> {
+            prefix + std::string(600, 'a'), prefix + std::string(400, 'b'), std::string(600, 'm'), prefix };
+        auto addLongTexts = [&](int begin, int end) {
+            for (auto i = begin; i < end; ++i) {
+                txn.addVertex("index_test", nogdb::Record {}
+                    .set("index_text", longTexts[i % longTexts.size()])
+                    .set("index_int", static_cast<int32_t>(i)));
+            }
+        };
+        addLongTexts(0, 8);
+        txn.addIndex("index_test", { "index_text" }, false, { "index_int" });
+        addLongTexts(8, 16);
+        for (const auto& condition : { nogdb::Condition("index_text").eq(longTexts[0]),
+                 nogdb::Condition("index_text").ge(longTexts[1]),
+                 nogdb::Condition("index_text").lt(longTexts[0]),
+                 nogdb::Condition("index_text").gt(std::string(500, 'b')) }) {
+            auto plan = txn.find("index_test").where(condition).select({ "index_text", "index_int" }).explain();
+            assert(plan.stages[0].operation == "COVERING_INDEX_SCAN");
+            auto covered = txn.find("index_test").where(condition).select({ "index_text", "index_int" }).get();
+            auto fetched = txn.find("index_test").where(condition).get();
+            std::sort(fetched.begin(), fetched.end(), [](const nogdb::Result& lhs, const nogdb::Result& rhs) {
+                return lhs.descriptor < rhs.descriptor;
+            });
+            assert(!covered.empty() && covered.size() == fetched.size());
+            for (auto i = 0U; i < covered.size(); ++i) {
+                assert(covered[i].descriptor == fetched[i].descriptor);
+                assert(covered[i].record.getText("index_text") == fetched[i].record.getText("index_text"));
+                auto value = covered[i].record.get("index_int");
+                assert(value.empty() ? fetched[i].record.get("index_int").empty()
+                                     : value.toInt() == fetched[i].record.getInt("index_int"));
+            }
+        }
+        txn.dropIndex("index_test", { "index_text" });
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_search_by_index_long_text()
+{
+    init_vertex_index_test();
+
+    // texts of several KB sharing prefixes longer than the part of a text which is kept in its index key
+    const auto prefix = std::string(200, 'k');
+    const auto texts = std::vector<std::string> {
+        "a", "zz", std::string(127, 'k'), std::string(128, 'k'), prefix,
+        prefix + "a" + std::string(4000, 'x'), prefix + "a" + std::string(6000, 'x'),
+        prefix + "b" + std::string(3000, 'y'), prefix + std::string(5000, 'x'),
+        std::string(127, 'k') + "l" + std::string(4000, 'z'), std::string(300, 'm') + std::string(8000, 'n') };
+    auto addRecords = [&](nogdb::Transaction& txn, const std::string& className) {
+        for (auto i = 0; i < 44; ++i) {
+            auto record = nogdb::Record {}.set("id", int64_t { i });
+            if (i % 13 != 0) {
+                record.set("index_text", texts[i % texts.size()]);
+            }
+            txn.addVertex(className, record);
+        }
+    };
+    auto testAll = [&](nogdb::Transaction& txn) {
+        indexRangeScanTester(txn, "index_test", "index_scan_test", "index_text",
+            std::vector<std::string> { "a", std::string(128, 'k'), prefix, texts[5], prefix + "a" + std::string(5000, 'x'),
+                texts[7], prefix + "c", texts[10] + "o" });
+        for (const auto& text : texts) {
+            auto condition = nogdb::Condition("index_text").eq(text);
+            auto expected = indexRangeIds(txn, "index_scan_test", condition);
+            auto cursor = txn.find("index_test").where(condition).getCursor();
+            auto ids = std::vector<int64_t> {};
+            while (cursor.next()) {
+                assert(cursor->record.get("index_text").toText() == text);
+                ids.emplace_back(cursor->record.get("id").toBigInt());
+            }
+            std::sort(ids.begin(), ids.end());
+            assert(ids == expected);
+        }
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("index_scan_test", nogdb::ClassType::VERTEX);
+        txn.addProperty("index_scan_test", "index_text", nogdb::PropertyType::TEXT);
+        txn.addProperty("index_test", "id", nogdb::PropertyType::BIGINT);
+        txn.addProperty("index_scan_test", "id", nogdb::PropertyType::BIGINT);
+        txn.addIndex("index_test", "index_text", false);
+        addRecords(txn, "index_test");
+        addRecords(txn, "index_scan_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto plan = txn.find("index_test").where(nogdb::Condition("index_text").eq(texts[6])).explain();
+        assert(plan.stages[0].operation == "INDEX_SCAN");
+        testAll(txn);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    // entries of long texts are removed and rewritten with their records, and built from existing records
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        for (const auto& className : { "index_test", "index_scan_test" }) {
+            for (const auto& res : txn.find(className).get()) {
+                auto id = res.record.get("id").toBigInt();
+                if (id % 5 == 0) {
+                    txn.remove(res.descriptor);
+                } else if (id % 3 == 0) {
+                    auto record = res.record;
+                    txn.update(res.descriptor, record.set("index_text", texts[(id + 5) % texts.size()]));
+                }
+            }
+        }
+        testAll(txn);
+        txn.dropIndex("index_test", "index_text");
+        txn.addIndex("index_test", "index_text", false);
+        testAll(txn);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    // long texts sharing their prefixes are still distinct values of a unique index
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("index_unique_test", nogdb::ClassType::VERTEX);
+        txn.addProperty("index_unique_test", "index_text", nogdb::PropertyType::TEXT);
+        for (auto i = 5U; i < 9U; ++i) {
+            txn.addVertex("index_unique_test", nogdb::Record {}.set("index_text", texts[i]));
+        }
+        txn.addIndex("index_unique_test", "index_text", true);
+        assert(txn.find("index_unique_test").where(nogdb::Condition("index_text").eq(texts[6])).count() == 1);
+        txn.dropIndex("index_unique_test", "index_text");
+        txn.addVertex("index_unique_test", nogdb::Record {}.set("index_text", texts[6]));
+        txn.addIndex("index_unique_test", "index_text", true);
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_INVALID_INDEX_CONSTRAINT, "NOGDB_CTX_INVALID_INDEX_CONSTRAINT");
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropIndex("index_test", "index_text");
+        txn.dropClass("index_scan_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_composite_index_long_text()
+{
+    init_vertex_index_test();
+
+    // texts longer than the key size limit in the columns of composite indexes, some sharing long prefixes
+    const auto prefix = std::string(200, 'k');
+    const auto texts = std::vector<std::string> { "a", std::string(128, 'k'), prefix,
+        prefix + "a" + std::string(600, 'x'), prefix + "b" + std::string(600, 'y'), prefix + std::string(900, 'x'),
+        std::string(600, 'm') };
+    auto addRecords = [&](nogdb::Transaction& txn, const std::string& className) {
+        for (auto i = 0; i < 60; ++i) {
+            auto record = nogdb::Record {}.set("id", int64_t { i }).set("index_int", static_cast<int32_t>(i % 3));
+            if (i % 11 != 0) {
+                record.set("index_text", texts[i % texts.size()]);
+            }
+            txn.addVertex(className, record);
+        }
+    };
+    auto getIds = [](nogdb::Transaction& txn, const std::string& className, const nogdb::MultiCondition& condition) {
+        auto ids = std::vector<int64_t> {};
+        for (const auto& res : txn.find(className).where(condition).get()) {
+            ids.emplace_back(res.record.get("id").toBigInt());
+        }
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    };
+    auto testAll = [&](nogdb::Transaction& txn) {
+        auto conditions = std::vector<nogdb::MultiCondition> {};
+        for (const auto& value : { int32_t { 0 }, int32_t { 2 } }) {
+            auto intEq = nogdb::Condition("index_int").eq(value);
+            for (const auto& text : texts) {
+                conditions.emplace_back(intEq && nogdb::Condition("index_text").eq(text));
+                conditions.emplace_back(intEq && nogdb::Condition("index_text").gt(text));
+                conditions.emplace_back(intEq && nogdb::Condition("index_text").le(text));
+                conditions.emplace_back(nogdb::Condition("index_text").eq(text) && nogdb::Condition("index_int").ge(value));
+            }
+            conditions.emplace_back(intEq && nogdb::Condition("index_text").between(texts[3], texts[5], { false, true }));
+        }
+        for (const auto& condition : conditions) {
+            auto scannedIds = getIds(txn, "index_scan_test", condition);
+            assert(getIds(txn, "index_test", condition) == scannedIds);
+            assert(txn.find("index_test").where(condition).count() == scannedIds.size());
+        }
+        for (const auto& res : txn.find("index_test").where(nogdb::Condition("index_text").eq(texts[5])).get()) {
+            assert(res.record.get("index_text").toText() == texts[5]);
+        }
+        auto plan = txn.find("index_test")
+            .where(nogdb::Condition("index_int").eq(int32_t { 1 }) && nogdb::Condition("index_text").eq(texts[3]))
+            .explain();
+        assert(plan.stages[0].operation == "INDEX_SCAN");
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("index_scan_test", nogdb::ClassType::VERTEX);
+        txn.addProperty("index_scan_test", "index_int", nogdb::PropertyType::INTEGER);
+        txn.addProperty("index_scan_test", "index_text", nogdb::PropertyType::TEXT);
+        txn.addProperty("index_test", "id", nogdb::PropertyType::BIGINT);
+        txn.addProperty("index_scan_test", "id", nogdb::PropertyType::BIGINT);
+        // one index is maintained on insert and the other is built from existing records
+        txn.addIndex("index_test", { "index_int", "index_text" });
+        addRecords(txn, "index_test");
+        addRecords(txn, "index_scan_test");
+        txn.addIndex("index_test", std::vector<std::string> { "index_text", "index_int" });
+        testAll(txn);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        for (const auto& className : { "index_test", "index_scan_test" }) {
+            for (const auto& res : txn.find(className).get()) {
+                auto id = res.record.get("id").toBigInt();
+                if (id % 5 == 0) {
+                    txn.remove(res.descriptor);
+                } else if (id % 4 == 0) {
+                    auto record = res.record;
+                    txn.update(res.descriptor, record.set("index_text", texts[(id + 3) % texts.size()]));
+                }
+            }
+        }
+        testAll(txn);
+        txn.dropIndex("index_test", { "index_int", "index_text" });
+        txn.dropIndex("index_test", std::vector<std::string> { "index_text", "index_int" });
+        txn.dropClass("index_scan_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_text_index()
+{
+    init_vertex_index_test();
+
+    const auto words = std::vector<std::string> { "alpha", "beta", "gamma", "delta", "alphabet", "betamax", "abc" };
+    auto getText = [&](int i) {
+        return words[i % words.size()] + "-" + words[(i / words.size()) % words.size()] + "-" + std::to_string(i % 4);
+    };
+    auto addRecords = [&](nogdb::Transaction& txn, const std::string& className) {
+        for (auto i = 0; i < 60; ++i) {
+            auto record = nogdb::Record {}.set("id", int64_t { i });
+            if (i % 11 != 0) {
+                record.set("index_text", getText(i));
+            }
+            txn.addVertex(className, record);
+        }
+    };
+    const auto conditions = std::vector<nogdb::Condition> {
+        nogdb::Condition("index_text").contain("alpha"), nogdb::Condition("index_text").contain("ta-ga"),
+        nogdb::Condition("index_text").contain("phabet-beta"), nogdb::Condition("index_text").contain("zzz"),
+        nogdb::Condition("index_text").beginWith("beta"), nogdb::Condition("index_text").beginWith("ab"),
+        nogdb::Condition("index_text").endWith("lta-3"), nogdb::Condition("index_text").like("%mma-al%"),
+        nogdb::Condition("index_text").like("bet_-%-1"), nogdb::Condition("index_text").like("%a"),
+        !nogdb::Condition("index_text").contain("alpha"), nogdb::Condition("index_text").ignoreCase().contain("ALPHA") };
+    auto testAll = [&](nogdb::Transaction& txn) {
+        for (const auto& condition : conditions) {
+            auto expected = indexRangeIds(txn, "index_scan_test", condition);
+            assert(indexRangeIds(txn, "index_test", condition) == expected);
+            assert(txn.find("index_test").where(condition).count() == expected.size());
+            auto cursor = txn.find("index_test").where(condition).getCursor();
+            auto ids = std::vector<int64_t> {};
+            while (cursor.next()) {
+                ids.emplace_back(cursor->record.get("id").toBigInt());
+            }
+            std::sort(ids.begin(), ids.end());
+            assert(ids == expected);
+            // text patterns are also looked up as conjuncts of multiple conditions
+            auto multiCondition = condition && nogdb::Condition("id").ge(int64_t { 20 });
+            assert(indexRangeIds(txn, "index_test", multiCondition)
+                == indexRangeIds(txn, "index_scan_test", multiCondition));
+        }
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("index_scan_test", nogdb::ClassType::VERTEX);
+        txn.addProperty("index_scan_test", "index_text", nogdb::PropertyType::TEXT);
+        txn.addProperty("index_test", "id", nogdb::PropertyType::BIGINT);
+        txn.addProperty("index_scan_test", "id", nogdb::PropertyType::BIGINT);
+        txn.addTextIndex("index_test", "index_text");
+        addRecords(txn, "index_test");
+        addRecords(txn, "index_scan_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto index = txn.getTextIndex("index_test", "index_text");
+        assert(index.classId == txn.getClass("index_test").id);
+        assert(index.propertyId == txn.getProperty("index_test", "index_text").id);
+        auto plan = txn.find("index_test").where(nogdb::Condition("index_text").contain("alpha")).explain();
+        assert(plan.stages[0].operation == "INDEX_SCAN");
+        // patterns shorter than an n-gram cannot be looked up
+        plan = txn.find("index_test").where(nogdb::Condition("index_text").contain("al")).explain();
+        assert(plan.stages[0].operation != "INDEX_SCAN");
+        testAll(txn);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    // posting lists follow updated and removed records, and are built from existing records
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        for (const auto& className : { "index_test", "index_scan_test" }) {
+            for (const auto& res : txn.find(className).get()) {
+                auto id = res.record.get("id").toBigInt();
+                if (id % 5 == 0) {
+                    txn.remove(res.descriptor);
+                } else if (id % 3 == 0) {
+                    auto record = res.record;
+                    txn.update(res.descriptor, record.set("index_text", getText(static_cast<int>(id) + 7)));
+                }
+            }
+        }
+        testAll(txn);
+        txn.dropTextIndex("index_test", "index_text");
+        txn.addTextIndex("index_test", "index_text");
+        testAll(txn);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addTextIndex("index_test", "index_text");
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_DUPLICATE_INDEX, "NOGDB_CTX_DUPLICATE_INDEX");
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addTextIndex("index_test", "index_int");
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_INVALID_PROPTYPE_INDEX, "NOGDB_CTX_INVALID_PROPTYPE_INDEX");
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropProperty("index_test", "index_text");
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_IN_USED_PROPERTY, "NOGDB_CTX_IN_USED_PROPERTY");
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropTextIndex("index_test", "index_text");
+        txn.dropClass("index_scan_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        txn.getTextIndex("index_test", "index_text");
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_NOEXST_INDEX, "NOGDB_CTX_NOEXST_INDEX");
+    }
+    destroy_vertex_index_test();
+}
+
+void test_search_by_index_in_list()
+{
+    init_vertex_index_test();
+
+    const auto prefix = std::string(200, 'k');
+    auto addRecords = [&](nogdb::Transaction& txn, const std::string& className) {
+        for (auto i = 0; i < 300; ++i) {
+            txn.addVertex(className, nogdb::Record {}
+                .set("id", int64_t { i })
+                .set("index_int", int32_t (i % 10))
+                .set("index_real", (i % 37 == 0) ? std::nan("") : i * 0.5)
+                .set("index_text", (i % 7 == 0) ? prefix + std::to_string(i % 3) : "t" + std::to_string(i % 50)));
+        }
+    };
+    auto denseIds = std::vector<int64_t> {};
+    for (auto i = int64_t { 100 }; i < 200; ++i) {
+        denseIds.emplace_back(i);
+    }
+    // sparse and dense lists with duplicates and values which are not in the index, of every kind of key
+    const auto conditions = std::vector<nogdb::Condition> {
+        nogdb::Condition("id").in(int64_t { 5 }, int64_t { 250 }, int64_t { 5 }, int64_t { 1000 }, int64_t { -3 }),
+        nogdb::Condition("id").in(denseIds),
+        nogdb::Condition("index_int").in(int32_t { 2 }, int32_t { 3 }, int32_t { 2 }),
+        nogdb::Condition("index_real").in(1.0, 2.5, 1.0, 149.5, 7.25),
+        nogdb::Condition("index_text").in(std::vector<std::string> { "t7", "t42", "nope", "t7", prefix + "0", prefix + "1", prefix + "9" }),
+        nogdb::Condition("index_text").in(std::string { "t3" })
+    };
+    auto getCursorIds = [](nogdb::Transaction& txn, const nogdb::Condition& condition) {
+        auto cursor = txn.find("index_test").where(condition).getCursor();
+        auto ids = std::vector<int64_t> {};
+        while (cursor.next()) {
+            ids.emplace_back(cursor->record.get("id").toBigInt());
+        }
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    };
+    auto testAll = [&](nogdb::Transaction& txn) {
+        for (const auto& condition : conditions) {
+            assert(txn.find("index_test").where(condition).explain().stages[0].operation == "INDEX_SCAN");
+            for (const auto& cond : { condition, !condition }) {
+                auto expected = indexRangeIds(txn, "index_scan_test", cond);
+                assert(indexRangeIds(txn, "index_test", cond) == expected);
+                assert(txn.find("index_test").where(cond).count() == expected.size());
+                assert(getCursorIds(txn, cond) == expected);
+            }
+            // negations of lists below other nodes are looked up as the complements of their keys
+            for (const auto& multiCondition : { condition && nogdb::Condition("id").ge(int64_t { 20 }),
+                     !(condition || nogdb::Condition("id").lt(int64_t { 20 })) }) {
+                assert(indexRangeIds(txn, "index_test", multiCondition)
+                    == indexRangeIds(txn, "index_scan_test", multiCondition));
+                assert(txn.find("index_test").where(multiCondition).count()
+                    == txn.find("index_scan_test").where(multiCondition).count());
+            }
+        }
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("index_scan_test", nogdb::ClassType::VERTEX);
+        txn.addProperty("index_test", "id", nogdb::PropertyType::BIGINT);
+        txn.addProperty("index_scan_test", "id", nogdb::PropertyType::BIGINT);
+        txn.addProperty("index_scan_test", "index_int", nogdb::PropertyType::INTEGER);
+        txn.addProperty("index_scan_test", "index_real", nogdb::PropertyType::REAL);
+        txn.addProperty("index_scan_test", "index_text", nogdb::PropertyType::TEXT);
+        txn.addIndex("index_test", "id", true);
+        txn.addIndex("index_test", "index_int", false);
+        txn.addIndex("index_test", "index_real", false);
+        txn.addIndex("index_test", "index_text", false);
+        addRecords(txn, "index_test");
+        addRecords(txn, "index_scan_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        testAll(txn);
+        auto plan = txn.find("index_test").where(conditions[0]).explain();
+        assert(plan.actualRows == 2);
+        assert(plan.stages[0].indexIds.size() == 1 && plan.stages[0].indexIds[0] == txn.getIndex("index_test", "id").id);
+        assert(plan.stages[0].estimatedRows == 2);
+        assert(txn.find("index_test").where(conditions[1]).explain().actualRows == 100);
+        // a negated list is not looked up on its own, nor is a list of NaN
+        assert(txn.find("index_test").where(!conditions[0]).explain().stages[0].indexIds.empty());
+        assert(txn.find("index_test").where(nogdb::Condition("index_real").in(std::nan(""))).explain()
+            .stages[0].indexIds.empty());
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        for (const auto& className : { "index_test", "index_scan_test" }) {
+            for (const auto& res : txn.find(className).where(nogdb::Condition("id").in(denseIds)).get()) {
+                auto id = res.record.get("id").toBigInt();
+                if (id % 3 == 0) {
+                    txn.remove(res.descriptor);
+                } else {
+                    auto record = res.record;
+                    txn.update(res.descriptor, record.set("index_int", int32_t { 2 }).set("index_text", "t7"));
+                }
+            }
+        }
+        testAll(txn);
+        txn.dropIndex("index_test", "id");
+        txn.dropIndex("index_test", "index_int");
+        txn.dropIndex("index_test", "index_real");
+        txn.dropIndex("index_test", "index_text");
+        txn.dropClass("index_scan_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_collated_index()
+{
+    init_vertex_index_test();
+
+    const auto longText = std::string(150, 'x');
+    const auto texts = std::vector<std::string> {
+        "apple", "Apple", "APPLE", "apricot", "Banana", "banana split", "b", "B", "cherry", "CHERRY pie", "_under",
+        "[bracket", "zeta", "\xc3\x89" "cole", "\xc3\xa9" "cole",
+        longText + "Tail", longText + "tail", "X" + longText.substr(1) + "TAIL"
+    };
+    auto addRecords = [&](nogdb::Transaction& txn, const std::string& className) {
+        for (auto i = 0; i < 60; ++i) {
+            txn.addVertex(className, nogdb::Record {}
+                .set("id", int64_t { i })
+                .set("index_text", texts[static_cast<size_t>(i) % texts.size()]));
+        }
+    };
+    // equality, ranges across the case of the alphabet, lists and prefixes of short and long texts
+    const auto conditions = std::vector<nogdb::Condition> {
+        nogdb::Condition("index_text").ignoreCase().eq("aPPle"),
+        nogdb::Condition("index_text").ignoreCase().eq(longText + "TAIL"),
+        nogdb::Condition("index_text").ignoreCase().gt("b"),
+        nogdb::Condition("index_text").ignoreCase().between("AP", "c", { true, false }),
+        nogdb::Condition("index_text").ignoreCase().le("_z"),
+        nogdb::Condition("index_text").ignoreCase().in(std::vector<std::string> { "B", "cherry", "nope", "APPLE" }),
+        nogdb::Condition("index_text").ignoreCase().beginWith("AP"),
+        nogdb::Condition("index_text").ignoreCase().beginWith("cHeRrY "),
+        nogdb::Condition("index_text").ignoreCase().beginWith(longText.substr(0, 140)),
+        nogdb::Condition("index_text").ignoreCase().beginWith(longText + "t")
+    };
+    auto testAll = [&](nogdb::Transaction& txn) {
+        for (const auto& condition : conditions) {
+            assert(txn.find("index_test").where(condition).explain().stages[0].operation == "INDEX_SCAN");
+            auto expected = indexRangeIds(txn, "index_scan_test", condition);
+            assert(!expected.empty());
+            assert(indexRangeIds(txn, "index_test", condition) == expected);
+            assert(txn.find("index_test").where(condition).count() == expected.size());
+            assert(indexRangeIds(txn, "index_test", condition && nogdb::Condition("id").lt(int64_t { 30 }))
+                == indexRangeIds(txn, "index_scan_test", condition && nogdb::Condition("id").lt(int64_t { 30 })));
+        }
+        // case-sensitive conditions cannot be looked up in a case-folding index
+        auto caseSensitive = nogdb::Condition("index_text").eq("apple");
+        assert(txn.find("index_test").where(caseSensitive).explain().stages[0].operation != "INDEX_SCAN");
+        assert(indexRangeIds(txn, "index_test", caseSensitive) == indexRangeIds(txn, "index_scan_test", caseSensitive));
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("index_scan_test", nogdb::ClassType::VERTEX);
+        txn.addProperty("index_test", "id", nogdb::PropertyType::BIGINT);
+        txn.addProperty("index_scan_test", "id", nogdb::PropertyType::BIGINT);
+        txn.addProperty("index_scan_test", "index_text", nogdb::PropertyType::TEXT);
+        addRecords(txn, "index_test");
+        addRecords(txn, "index_scan_test");
+        auto index = txn.addIndex("index_test", "index_text", false, nogdb::IndexCollation::ASCII_CASE_FOLD);
+        assert(index.collation == nogdb::IndexCollation::ASCII_CASE_FOLD);
+        assert(txn.getIndex("index_test", "index_text") == index);
+        testAll(txn);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        assert(txn.getIndex("index_test", "index_text").collation == nogdb::IndexCollation::ASCII_CASE_FOLD);
+        testAll(txn);
+        for (const auto& className : { "index_test", "index_scan_test" }) {
+            for (const auto& res : txn.find(className).where(nogdb::Condition("id").lt(int64_t { 20 })).get()) {
+                auto id = res.record.get("id").toBigInt();
+                if (id % 2 == 0) {
+                    txn.remove(res.descriptor);
+                } else {
+                    auto record = res.record;
+                    txn.update(res.descriptor, record.set("index_text", "ApRiCoT"));
+                }
+            }
+        }
+        testAll(txn);
+        txn.dropIndex("index_test", "index_text");
+
+        // a unicode case-folding index serves ascii values of ignoreCase conditions only
+        txn.addIndex("index_test", "index_text", false, nogdb::IndexCollation::UNICODE_CASE_FOLD);
+        assert(txn.getIndex("index_test", "index_text").collation == nogdb::IndexCollation::UNICODE_CASE_FOLD);
+        testAll(txn);
+        auto condition = nogdb::Condition("index_text").ignoreCase().eq("\xc3\x89" "COLE");
+        assert(txn.find("index_test").where(condition).explain().stages[0].operation != "INDEX_SCAN");
+        assert(indexRangeIds(txn, "index_test", condition) == indexRangeIds(txn, "index_scan_test", condition));
+        txn.dropIndex("index_test", "index_text");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    // texts which differ only by case are duplicates in a unique case-folding index
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addIndex("index_test", "index_text", true, nogdb::IndexCollation::ASCII_CASE_FOLD);
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_INVALID_INDEX_CONSTRAINT, "NOGDB_CTX_INVALID_INDEX_CONSTRAINT");
+    }
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("index_unique_test", nogdb::ClassType::VERTEX);
+        txn.addProperty("index_unique_test", "index_text", nogdb::PropertyType::TEXT);
+        txn.addVertex("index_unique_test", nogdb::Record {}.set("index_text", "Unique"));
+        txn.addIndex("index_unique_test", "index_text", true, nogdb::IndexCollation::UNICODE_CASE_FOLD);
+        try {
+            txn.addVertex("index_unique_test", nogdb::Record {}.set("index_text", "uNIQUE"));
+            assert(false);
+        } catch (const nogdb::FatalError&) {
+            // a unique constraint violation rolls the transaction back
+        }
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addIndex("index_test", "id", false, nogdb::IndexCollation::ASCII_CASE_FOLD);
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_INVALID_PROPTYPE_INDEX, "NOGDB_CTX_INVALID_PROPTYPE_INDEX");
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropProperty("index_test", "id");
+        txn.dropClass("index_scan_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_search_by_index_prefix()
+{
+    init_vertex_index_test();
+
+    const auto longText = std::string(140, 'l');
+    auto addRecords = [&](nogdb::Transaction& txn, const std::string& className) {
+        const auto words = std::vector<std::string> { "car", "Cart", "carbon", "cab", "dog", "do", "CAR", "ca%t",
+            "\xff\xff" "a", "\xff\xff", "\xfe\xff" "b", longText + "a1", longText + "B2", longText.substr(0, 128) };
+        for (auto i = 0; i < 120; ++i) {
+            auto word = words[static_cast<size_t>(i) % words.size()];
+            txn.addVertex(className, nogdb::Record {}
+                .set("id", int64_t { i })
+                .set("index_text", (i % 3 == 0) ? word : word + std::to_string(i % 5)));
+        }
+    };
+    const auto conditions = std::vector<nogdb::Condition> {
+        nogdb::Condition("index_text").beginWith("car"),
+        nogdb::Condition("index_text").beginWith("ca"),
+        nogdb::Condition("index_text").beginWith("\xff\xff"),
+        nogdb::Condition("index_text").beginWith("\xfe"),
+        nogdb::Condition("index_text").beginWith(longText.substr(0, 100)),
+        nogdb::Condition("index_text").beginWith(longText + "a"),
+        nogdb::Condition("index_text").like("car%"),
+        nogdb::Condition("index_text").like("ca_%"),
+        nogdb::Condition("index_text").like("car%1"),
+        nogdb::Condition("index_text").like("do"),
+        nogdb::Condition("index_text").like(longText + "%2")
+    };
+    auto getCursorTexts = [](nogdb::Transaction& txn, const nogdb::Condition& condition) {
+        auto cursor = txn.find("index_test").where(condition).getCursor();
+        auto texts = std::vector<std::string> {};
+        while (cursor.next()) {
+            texts.emplace_back(cursor->record.get("index_text").toText());
+        }
+        return texts;
+    };
+    auto testAll = [&](nogdb::Transaction& txn) {
+        for (const auto& condition : conditions) {
+            assert(txn.find("index_test").where(condition).explain().stages[0].operation == "INDEX_SCAN");
+            auto expected = indexRangeIds(txn, "index_scan_test", condition);
+            assert(!expected.empty());
+            assert(indexRangeIds(txn, "index_test", condition) == expected);
+            assert(txn.find("index_test").where(condition).count() == expected.size());
+            // a cursor walks the matches in the order of their keys
+            auto texts = getCursorTexts(txn, condition);
+            assert(texts.size() == expected.size());
+            assert(std::is_sorted(texts.cbegin(), texts.cend(), [](const std::string& lhs, const std::string& rhs) {
+                return lhs.substr(0, 128) < rhs.substr(0, 128);
+            }));
+            auto multiCondition = condition && nogdb::Condition("id").lt(int64_t { 60 });
+            assert(indexRangeIds(txn, "index_test", multiCondition) == indexRangeIds(txn, "index_scan_test", multiCondition));
+        }
+        // patterns without a literal prefix, negated or case-insensitive prefixes are not looked up in a binary index
+        for (const auto& condition : { nogdb::Condition("index_text").like("%ar"), !nogdb::Condition("index_text").beginWith("car"),
+                 nogdb::Condition("index_text").ignoreCase().beginWith("car") }) {
+            assert(txn.find("index_test").where(condition).explain().stages[0].operation != "INDEX_SCAN");
+            assert(indexRangeIds(txn, "index_test", condition) == indexRangeIds(txn, "index_scan_test", condition));
+        }
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("index_scan_test", nogdb::ClassType::VERTEX);
+        txn.addProperty("index_test", "id", nogdb::PropertyType::BIGINT);
+        txn.addProperty("index_scan_test", "id", nogdb::PropertyType::BIGINT);
+        txn.addProperty("index_scan_test", "index_text", nogdb::PropertyType::TEXT);
+        txn.addIndex("index_test", "index_text", false);
+        addRecords(txn, "index_test");
+        addRecords(txn, "index_scan_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        testAll(txn);
+        auto plan = txn.find("index_test").where(conditions[0]).explain();
+        assert(plan.stages[0].indexIds.size() == 1 && plan.stages[0].indexIds[0] == txn.getIndex("index_test", "index_text").id);
+        assert(plan.stages[0].estimatedRows == plan.actualRows);
+        for (const auto& className : { "index_test", "index_scan_test" }) {
+            for (const auto& res : txn.find(className).where(nogdb::Condition("id").lt(int64_t { 40 })).get()) {
+                if (res.record.get("id").toBigInt() % 2 == 0) {
+                    txn.remove(res.descriptor);
+                } else {
+                    auto record = res.record;
+                    txn.update(res.descriptor, record.set("index_text", "carrot"));
+                }
+            }
+        }
+        testAll(txn);
+        txn.dropIndex("index_test", "index_text");
+
+        // case-insensitive prefixes are looked up in a case-folding index
+        txn.addIndex("index_test", "index_text", false, nogdb::IndexCollation::ASCII_CASE_FOLD);
+        for (const auto& condition : { nogdb::Condition("index_text").ignoreCase().beginWith("CAR"),
+                 nogdb::Condition("index_text").ignoreCase().like("cA_t%"), nogdb::Condition("index_text").ignoreCase().like("C%n%") }) {
+            assert(txn.find("index_test").where(condition).explain().stages[0].operation == "INDEX_SCAN");
+            auto expected = indexRangeIds(txn, "index_scan_test", condition);
+            assert(!expected.empty());
+            assert(indexRangeIds(txn, "index_test", condition) == expected);
+            assert(getCursorTexts(txn, condition).size() == expected.size());
+        }
+        assert(txn.find("index_test").where(nogdb::Condition("index_text").beginWith("car")).explain()
+            .stages[0].operation != "INDEX_SCAN");
+        txn.dropIndex("index_test", "index_text");
+        txn.dropProperty("index_test", "id");
+        txn.dropClass("index_scan_test");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_upsert_by_unique_index()
+{
+    init_vertex_index_test();
+
+    auto getIds = [](nogdb::Transaction& txn, const nogdb::Condition& condition) {
+        auto ids = std::vector<int64_t> {};
+        for (const auto& res : txn.find("index_test").where(condition).get()) {
+            ids.emplace_back(res.record.get("index_bigint").toBigInt());
+        }
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    };
+    auto getMultiIds = [](nogdb::Transaction& txn, const nogdb::MultiCondition& condition) {
+        auto ids = std::vector<int64_t> {};
+        for (const auto& res : txn.find("index_test").where(condition).get()) {
+            ids.emplace_back(res.record.get("index_bigint").toBigInt());
+        }
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addIndex("index_test", "index_bigint", true);
+        txn.addIndex("index_test", "index_text", false);
+        txn.addIndex("index_test", "index_int", false);
+        txn.addIndex("index_test", { "index_int", "index_real" });
+        txn.addTextIndex("index_test", "index_text");
+        for (auto i = 0; i < 10; ++i) {
+            txn.upsertVertex("index_test", "index_bigint", nogdb::Record {}
+                .set("index_bigint", int64_t { i }).set("index_text", "text" + std::to_string(i))
+                .set("index_int", i % 3).set("index_real", 0.5 * i));
+        }
+        assert(txn.find("index_test").count() == 10);
+
+        // the same key updates the vertex in place with only the entries of its changed properties rewritten
+        auto vertex = txn.getOrCreateVertex("index_test", "index_bigint", nogdb::Record {}.set("index_bigint", int64_t { 4 }));
+        auto updated = txn.upsertVertex("index_test", "index_bigint", nogdb::Record {}
+            .set("index_bigint", int64_t { 4 }).set("index_text", "changed").set("index_int", 1).set("index_real", 2.0));
+        assert(updated == vertex);
+        assert(txn.find("index_test").count() == 10);
+        assert(txn.fetchRecord(vertex).get("index_text").toText() == "changed");
+        assert(getIds(txn, nogdb::Condition("index_text").eq("changed")) == std::vector<int64_t> { 4 });
+        assert(getIds(txn, nogdb::Condition("index_text").eq("text4")).empty());
+        assert(getIds(txn, nogdb::Condition("index_text").contain("hange")) == std::vector<int64_t> { 4 });
+        assert(getIds(txn, nogdb::Condition("index_text").contain("ext4")).empty());
+        assert((getIds(txn, nogdb::Condition("index_int").eq(1)) == std::vector<int64_t> { 1, 4, 7 }));
+        assert(getMultiIds(txn, nogdb::Condition("index_int").eq(1) && nogdb::Condition("index_real").eq(2.0))
+            == std::vector<int64_t> { 4 });
+        assert(getIds(txn, nogdb::Condition("index_bigint").eq(int64_t { 4 })) == std::vector<int64_t> { 4 });
+
+        // properties which are not in the record are emptied as with update
+        txn.upsertVertex("index_test", "index_bigint", nogdb::Record {}.set("index_bigint", int64_t { 4 }).set("index_int", 1));
+        assert(txn.fetchRecord(vertex).get("index_text").empty());
+        assert(getIds(txn, nogdb::Condition("index_text").eq("changed")).empty());
+        assert(getMultiIds(txn, nogdb::Condition("index_int").eq(1) && nogdb::Condition("index_real").eq(2.0)).empty());
+        assert((getIds(txn, nogdb::Condition("index_int").eq(1)) == std::vector<int64_t> { 1, 4, 7 }));
+
+        // an existing vertex is returned as it is, and a missing one is created
+        auto existing = txn.getOrCreateVertex("index_test", "index_bigint",
+            nogdb::Record {}.set("index_bigint", int64_t { 7 }).set("index_text", "ignored"));
+        assert(txn.fetchRecord(existing).get("index_text").toText() == "text7");
+        auto created = txn.getOrCreateVertex("index_test", "index_bigint",
+            nogdb::Record {}.set("index_bigint", int64_t { 10 }).set("index_text", "text10"));
+        assert(txn.find("index_test").count() == 11);
+        assert(txn.getOrCreateVertex("index_test", "index_bigint", nogdb::Record {}.set("index_bigint", int64_t { 10 }))
+            == created);
+        assert(getIds(txn, nogdb::Condition("index_text").eq("text10")) == std::vector<int64_t> { 10 });
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.upsertVertex("index_test", "index_text", nogdb::Record {}.set("index_text", "text1"));
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_NOEXST_INDEX, "NOGDB_CTX_NOEXST_INDEX");
+    }
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.getOrCreateVertex("index_test", "index_real", nogdb::Record {}.set("index_real", 1.0));
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_NOEXST_INDEX, "NOGDB_CTX_NOEXST_INDEX");
+    }
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.upsertVertex("index_test", "index_bigint", nogdb::Record {}.set("index_text", "text1"));
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_NOEXST_PROPERTY, "NOGDB_CTX_NOEXST_PROPERTY");
+    }
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.getOrCreateVertex("index_test", "index_undefined", nogdb::Record {}.set("index_bigint", int64_t { 1 }));
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_NOEXST_PROPERTY, "NOGDB_CTX_NOEXST_PROPERTY");
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropIndex("index_test", "index_bigint");
+        txn.dropIndex("index_test", "index_text");
+        txn.dropIndex("index_test", "index_int");
+        txn.dropIndex("index_test", { "index_int", "index_real" });
+        txn.dropTextIndex("index_test", "index_text");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_partial_index()
+{
+    init_vertex_index_test();
+
+    auto active = nogdb::Condition("index_text").eq("active");
+    auto getIds = [](nogdb::Transaction& txn, const nogdb::MultiCondition& condition) {
+        auto ids = std::vector<int64_t> {};
+        for (const auto& res : txn.find("index_test").where(condition).get()) {
+            ids.emplace_back(res.record.get("index_bigint").toBigInt());
+        }
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    };
+    auto getDescriptor = [](nogdb::Transaction& txn, int64_t id) {
+        return txn.find("index_test").where(nogdb::Condition("index_bigint").eq(id)).get().front().descriptor;
+    };
+    auto addRecords = [](nogdb::Transaction& txn, int64_t begin, int64_t end) {
+        for (auto i = begin; i < end; ++i) {
+            txn.addVertex("index_test", nogdb::Record {}
+                .set("index_bigint", i)
+                .set("index_int", int32_t (i % 10))
+                .set("index_text", (i % 4 == 0) ? "active" : "inactive"));
+        }
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        // the first half is indexed when the index is built and the second half when it is inserted
+        addRecords(txn, 0, 100);
+        txn.addIndex("index_test", "index_int", false, active);
+        addRecords(txn, 100, 200);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto indexId = txn.getIndex("index_test", "index_int").id;
+        auto expectedIds = std::vector<int64_t> {};
+        for (auto i = int64_t { 12 }; i < 200; i += 20) {
+            expectedIds.emplace_back(i);
+        }
+        auto condition = nogdb::Condition("index_int").eq(int32_t { 2 }) && active;
+        assert(getIds(txn, condition) == expectedIds);
+        auto plan = txn.find("index_test").where(condition).explain();
+        assert(plan.actualRows == 10);
+        assert(plan.stages[0].operation == "INDEX_SCAN");
+        assert(plan.stages[0].indexIds.size() == 1 && plan.stages[0].indexIds[0] == indexId);
+        // only the active records are kept in the index
+        assert(plan.stages[0].actualRows == 10);
+
+        // the predicate is not implied, so that the index cannot be used
+        ASSERT_SIZE(txn.find("index_test").where(nogdb::Condition("index_int").eq(int32_t { 2 })).get(), 20);
+        plan = txn.find("index_test").where(nogdb::Condition("index_int").eq(int32_t { 2 })).explain();
+        assert(plan.actualRows == 20);
+        assert(plan.stages[0].indexIds.empty());
+        ASSERT_SIZE(txn.find("index_test").where(nogdb::Condition("index_int").eq(int32_t { 2 })).indexed().get(), 0);
+        plan = txn.find("index_test")
+            .where(nogdb::Condition("index_int").eq(int32_t { 2 }) && nogdb::Condition("index_text").eq("inactive"))
+            .explain();
+        assert(plan.actualRows == 10);
+        assert(plan.stages[0].indexIds.empty());
+        ASSERT_SIZE(txn.find("index_test").where(nogdb::Condition("index_int").eq(int32_t { 2 }) || active).get(), 60);
+        ASSERT_SIZE(txn.find("index_test")
+            .where(nogdb::Condition("index_int").eq(int32_t { 2 }) && (active || nogdb::Condition("index_real").null()))
+            .get(), 20);
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        // records leave and enter the index as the properties of the predicate are updated
+        txn.update(getDescriptor(txn, 12), nogdb::Record {}
+            .set("index_bigint", int64_t { 12 }).set("index_int", int32_t { 2 }).set("index_text", "inactive"));
+        txn.update(getDescriptor(txn, 1), nogdb::Record {}
+            .set("index_bigint", int64_t { 1 }).set("index_int", int32_t { 2 }).set("index_text", "active"));
+        txn.remove(getDescriptor(txn, 32));
+        auto expectedIds = std::vector<int64_t> { 1 };
+        for (auto i = int64_t { 52 }; i < 200; i += 20) {
+            expectedIds.emplace_back(i);
+        }
+        assert(getIds(txn, nogdb::Condition("index_int").eq(int32_t { 2 }) && active) == expectedIds);
+        assert(getIds(txn, nogdb::Condition("index_int").eq(int32_t { 2 }) && active) ==
+            getIds(txn, active && nogdb::Condition("index_bigint").ge(int64_t { 0 }) && nogdb::Condition("index_int").eq(int32_t { 2 })));
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+    try {
+        txn.dropProperty("index_test", "index_text");
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_IN_USED_PROPERTY, "NOGDB_CTX_IN_USED_PROPERTY");
+    }
+    try {
+        txn.addIndex("index_test", "index_real", false, active || nogdb::Condition("index_int").eq(int32_t { 1 }));
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_INVALID_COMPARATOR, "NOGDB_CTX_INVALID_COMPARATOR");
+    }
+    try {
+        txn.addIndex("index_test", "index_real", false, nogdb::Condition("index_missing").eq(1));
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_NOEXST_PROPERTY, "NOGDB_CTX_NOEXST_PROPERTY");
+    }
+    try {
+        // the predicate has to be comparable with the type of its property
+        txn.addIndex("index_test", "index_real", false, nogdb::Condition("index_int").contain("x"));
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_INVALID_COMPARATOR, "NOGDB_CTX_INVALID_COMPARATOR");
+    }
+    try {
+        txn.addIndex("index_test", "index_real", false, nogdb::Condition("index_real").ge(int32_t { 1 }));
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_INVALID_COMPARATOR, "NOGDB_CTX_INVALID_COMPARATOR");
+    }
+    try {
+        txn.addIndex("index_test", "index_real", false, nogdb::Condition("index_real").between(int32_t { 1 }, int32_t { 2 }));
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_INVALID_COMPARATOR, "NOGDB_CTX_INVALID_COMPARATOR");
+    }
+
+    try {
+        // a unique partial index only constrains the records which satisfy its predicate
+        txn.dropIndex("index_test", "index_int");
+        auto vip = nogdb::Condition("index_text").eq("vip");
+        txn.addIndex("index_test", "index_int", true, vip && !nogdb::Condition("index_real").null());
+        txn.addVertex("index_test", nogdb::Record {}
+            .set("index_bigint", int64_t { 1000 }).set("index_int", int32_t { 5 }).set("index_text", "vip")
+            .set("index_real", 1.0));
+        txn.addVertex("index_test", nogdb::Record {}
+            .set("index_bigint", int64_t { 1001 }).set("index_int", int32_t { 5 }).set("index_text", "vip"));
+        auto rdesc = txn.upsertVertex("index_test", "index_int", nogdb::Record {}
+            .set("index_bigint", int64_t { 1002 }).set("index_int", int32_t { 5 }).set("index_text", "vip")
+            .set("index_real", 2.0));
+        assert(rdesc == getDescriptor(txn, 1002));
+        ASSERT_SIZE(txn.find("index_test").where(nogdb::Condition("index_bigint").eq(int64_t { 1000 })).get(), 0);
+        auto condition = nogdb::Condition("index_int").eq(int32_t { 5 }) && vip && !nogdb::Condition("index_real").null();
+        assert(getIds(txn, condition) == std::vector<int64_t> { 1002 });
+        assert(txn.find("index_test").where(condition).explain().stages[0].operation == "INDEX_SCAN");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+    try {
+        txn.upsertVertex("index_test", "index_int", nogdb::Record {}
+            .set("index_bigint", int64_t { 1003 }).set("index_int", int32_t { 5 }).set("index_text", "vip"));
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_NOEXST_INDEX, "NOGDB_CTX_NOEXST_INDEX");
+    }
+    try {
+        txn.addVertex("index_test", nogdb::Record {}
+            .set("index_bigint", int64_t { 1003 }).set("index_int", int32_t { 5 }).set("index_text", "vip")
+            .set("index_real", 3.0));
+        assert(false);
+    } catch (const nogdb::FatalError&) {
+        // a unique constraint violation rolls the transaction back
+    }
+
+    try {
+        txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.dropIndex("index_test", "index_int");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+    destroy_vertex_index_test();
+}
+
+void test_polymorphic_index()
+{
+    auto subClassNames = std::vector<std::string> { "poly_sub_a", "poly_sub_b", "poly_sub_c" };
+    auto addRecords = [&subClassNames](nogdb::Transaction& txn, int32_t begin, int32_t end) {
+        // every class of the hierarchy gets the same values
+        for (auto i = begin; i < end; ++i) {
+            auto record = nogdb::Record {}.set("poly_int", i % 10).set("poly_text", "name" + std::to_string(i % 5));
+            txn.addVertex("poly_base", record);
+            for (const auto& className : subClassNames) {
+                txn.addVertex(className, record);
+            }
+            txn.addVertex("poly_sub_aa", nogdb::Record {}.set("poly_int", i % 10).set("poly_extra", i));
+        }
+    };
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        txn.addClass("poly_base", nogdb::ClassType::VERTEX);
+        txn.addProperty("poly_base", "poly_int", nogdb::PropertyType::INTEGER);
+        txn.addProperty("poly_base", "poly_text", nogdb::PropertyType::TEXT);
+        for (const auto& className : subClassNames) {
+            txn.addSubClassOf("poly_base", className);
+        }
+        txn.addSubClassOf("poly_sub_a", "poly_sub_aa");
+        txn.addProperty("poly_sub_aa", "poly_extra", nogdb::PropertyType::INTEGER);
+        txn.addVertex("poly_sub_b", nogdb::Record {}.set("poly_text", "no value"));
+        // the first half is indexed when the index is built and the second half when it is inserted
+        addRecords(txn, 0, 50);
+        txn.addPolymorphicIndex("poly_base", "poly_int");
+        txn.addPolymorphicIndex("poly_base", "poly_text");
+        addRecords(txn, 50, 100);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_ONLY);
+        auto indexId = txn.getPolymorphicIndex("poly_base", "poly_int").id;
+        auto condition = nogdb::Condition("poly_int").eq(int32_t { 3 });
+        auto res = txn.findSubClassOf("poly_base").where(condition).get();
+        ASSERT_SIZE(res, 50);
+        for (const auto& r : res) {
+            assert(r.record.get("poly_int").toInt() == 3);
+        }
+        assert(txn.findSubClassOf("poly_base").where(condition).count() == 50);
+        assert(txn.findSubClassOf("poly_base").where(condition).getCursor().size() == 50);
+        ASSERT_SIZE(txn.findSubClassOf("poly_sub_a").where(condition).get(), 20);
+        ASSERT_SIZE(txn.find("poly_base").where(condition).get(), 10);
+        auto plan = txn.findSubClassOf("poly_base").where(condition).explain();
+        assert(plan.actualRows == 50);
+        assert(plan.stages.size() == 2);
+        assert(plan.stages[0].operation == "POLYMORPHIC_INDEX_SCAN");
+        assert(plan.stages[0].indexIds.size() == 1 && plan.stages[0].indexIds[0] == indexId);
+        assert(plan.stages[0].estimatedRows == 50);
+        // only the index of the queried class is used
+        assert(txn.findSubClassOf("poly_sub_a").where(condition).explain().stages[0].operation != "POLYMORPHIC_INDEX_SCAN");
+
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(nogdb::Condition("poly_int").between(2, 4)).get(), 150);
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(nogdb::Condition("poly_int").gt(7)).get(), 100);
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(nogdb::Condition("poly_text").eq("name2")).get(), 80);
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(nogdb::Condition("poly_text").lt("name2")).get(), 160);
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(!nogdb::Condition("poly_text").eq("name2")).get(), 321);
+        // the other conjuncts, even on properties of a subclass, are checked against the records
+        auto multiCondition = nogdb::Condition("poly_int").eq(int32_t { 3 }) && nogdb::Condition("poly_extra").ge(50);
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(multiCondition).get(), 5);
+        assert(txn.findSubClassOf("poly_base").where(multiCondition).count() == 5);
+        multiCondition = nogdb::Condition("poly_int").eq(int32_t { 3 }) && nogdb::Condition("poly_text").eq("name3");
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(multiCondition).get(), 40);
+        plan = txn.findSubClassOf("poly_base").where(multiCondition).explain();
+        assert(plan.stages[0].operation == "POLYMORPHIC_INDEX_SCAN");
+        assert(plan.stages[0].indexIds[0] == indexId);
+        multiCondition = nogdb::Condition("poly_int").eq(int32_t { 3 }) || nogdb::Condition("poly_int").eq(int32_t { 4 });
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(multiCondition).get(), 100);
+        assert(txn.findSubClassOf("poly_base").where(multiCondition).explain().stages[0].operation
+            != "POLYMORPHIC_INDEX_SCAN");
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    try {
+        auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+        // the entries of the records of the subclasses are maintained with their records
+        auto condition = nogdb::Condition("poly_int").eq(int32_t { 3 });
+        auto res = txn.find("poly_sub_b").where(condition).get();
+        txn.update(res[0].descriptor, nogdb::Record {}.set("poly_int", int32_t { 30 }).set("poly_text", "name3"));
+        txn.remove(res[1].descriptor);
+        txn.removeAll("poly_sub_c");
+        txn.dropClass("poly_sub_aa");
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(condition).get(), 28);
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(nogdb::Condition("poly_int").eq(int32_t { 30 })).get(), 1);
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(nogdb::Condition("poly_text").eq("name3")).get(), 59);
+
+        // long texts sharing the prefix of their keys are told apart by their records in every class
+        auto prefix = std::string(128, 'p');
+        txn.addVertex("poly_sub_a", nogdb::Record {}.set("poly_text", prefix + "a"));
+        txn.addVertex("poly_sub_b", nogdb::Record {}.set("poly_text", prefix + "a"));
+        txn.addVertex("poly_sub_b", nogdb::Record {}.set("poly_text", prefix + "b"));
+        txn.addVertex("poly_base", nogdb::Record {}.set("poly_text", prefix));
+        auto longCondition = nogdb::Condition("poly_text").eq(prefix + "a");
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(longCondition).get(), 2);
+        assert(txn.findSubClassOf("poly_base").where(longCondition).count() == 2);
+        auto plan = txn.findSubClassOf("poly_base").where(longCondition).explain();
+        assert(plan.actualRows == 2);
+        assert(plan.stages[0].operation == "POLYMORPHIC_INDEX_SCAN");
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(nogdb::Condition("poly_text").eq(prefix)).get(), 1);
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(nogdb::Condition("poly_text").ge(prefix + "a")).get(), 3);
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(nogdb::Condition("poly_text").gt(prefix + "a")).get(), 1);
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+
+    auto txn = ctx->beginTxn(nogdb::TxnMode::READ_WRITE);
+    try {
+        txn.addPolymorphicIndex("poly_base", "poly_int");
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_DUPLICATE_INDEX, "NOGDB_CTX_DUPLICATE_INDEX");
+    }
+    try {
+        txn.dropProperty("poly_base", "poly_int");
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_IN_USED_PROPERTY, "NOGDB_CTX_IN_USED_PROPERTY");
+    }
+    try {
+        txn.dropClass("poly_base");
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_IN_USED_PROPERTY, "NOGDB_CTX_IN_USED_PROPERTY");
+    }
+    try {
+        txn.getPolymorphicIndex("poly_sub_a", "poly_int");
+        assert(false);
+    } catch (const nogdb::Error& ex) {
+        REQUIRE(ex, NOGDB_CTX_NOEXST_INDEX, "NOGDB_CTX_NOEXST_INDEX");
+    }
+
+    try {
+        txn.dropPolymorphicIndex("poly_base", "poly_int");
+        txn.dropPolymorphicIndex("poly_base", "poly_text");
+        ASSERT_SIZE(txn.findSubClassOf("poly_base").where(nogdb::Condition("poly_int").eq(int32_t { 3 })).get(), 28);
+        for (const auto& className : subClassNames) {
+            txn.dropClass(className);
+        }
+        txn.dropClass("poly_base");
+        txn.commit();
+    } catch (const nogdb::Error& ex) {
+        std::cout << "\nError: " << ex.what() << std::endl;
+        assert(false);
+    }
+}
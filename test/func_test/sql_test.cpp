@@ -1785,3 +1785,179 @@ void test_sql_drop_index()
     txn.dropClass("V");
     txn.commit();
 }
+
+void test_sql_composite_index()
+{
+    auto txn = ctx->beginTxn(TxnMode::READ_WRITE);
+    txn.addClass("V", ClassType::VERTEX);
+    txn.addProperty("V", "p", PropertyType::TEXT);
+    txn.addProperty("V", "q", PropertyType::INTEGER);
+
+    try {
+        SQL::Result result = SQL::execute(txn, "CREATE INDEX V (q, p) UNIQUE");
+        assert(result.type() == result.NO_RESULT);
+        auto index = txn.getIndex("V", { "q", "p" });
+        assert(index.unique == true);
+        assert(index.propertyIds.size() == 2);
+        assert(index.propertyIds[0] == txn.getProperty("V", "q").id);
+        auto indexes = txn.getIndexes(txn.getClass("V"));
+        assert(indexes.size() == 1);
+
+        result = SQL::execute(txn, "DROP INDEX V (q, p)");
+        assert(result.type() == result.NO_RESULT);
+        try {
+            index = txn.getIndex("V", { "q", "p" });
+            assert(false);
+        } catch (const Error& ex) {
+            REQUIRE(ex, NOGDB_CTX_NOEXST_INDEX, "NOGDB_CTX_NOEXST_INDEX");
+        }
+        assert(txn.getIndexes(txn.getClass("V")).empty());
+    } catch (const Error& e) {
+        cout << "\nError: " << e.what() << endl;
+        assert(false);
+    }
+
+    txn.dropProperty("V", "p");
+    txn.dropProperty("V", "q");
+    txn.dropClass("V");
+    txn.commit();
+}
+
+void test_sql_covering_index()
+{
+    auto txn = ctx->beginTxn(TxnMode::READ_WRITE);
+    txn.addClass("V", ClassType::VERTEX);
+    txn.addProperty("V", "p", PropertyType::TEXT);
+    txn.addProperty("V", "q", PropertyType::INTEGER);
+    txn.addProperty("V", "r", PropertyType::INTEGER);
+
+    try {
+        txn.addVertex("V", Record().set("p", "v1").set("q", 1).set("r", 10));
+        txn.addVertex("V", Record().set("p", "v2").set("q", 2).set("r", 20));
+        txn.addVertex("V", Record().set("p", "v3").set("q", 2));
+
+        SQL::Result result = SQL::execute(txn, "CREATE INDEX V.q INCLUDE (p)");
+        assert(result.type() == result.NO_RESULT);
+        auto index = txn.getIndex("V", { "q" });
+        assert(index.includedPropertyIds.size() == 1);
+        assert(index.includedPropertyIds[0] == txn.getProperty("V", "p").id);
+
+        result = SQL::execute(txn, "EXPLAIN SELECT q, p FROM V WHERE q = 2");
+        assert(result.type() == result.QUERY_PLAN);
+        auto plan = result.get<QueryPlan>();
+        assert(plan.stages.size() == 1 && plan.stages[0].operation == "COVERING_INDEX_SCAN");
+        assert(plan.stages[0].indexIds.size() == 1 && plan.stages[0].indexIds[0] == index.id);
+
+        result = SQL::execute(txn, "SELECT q, p FROM V WHERE q = 2");
+        assert(result.type() == result.RESULT_SET);
+        auto res = result.get<ResultSet>();
+        assert(res.size() == 2);
+        assert(res[0].record.getInt("q") == 2 && res[0].record.getText("p") == "v2");
+        assert(res[1].record.getInt("q") == 2 && res[1].record.getText("p") == "v3");
+        assert(res[0].record.get("r").empty());
+
+        result = SQL::execute(txn, "SELECT p FROM V WHERE q >= 1 SKIP 1 LIMIT 1");
+        res = result.get<ResultSet>();
+        assert(res.size() == 1 && res[0].record.getText("p") == "v2");
+
+        // the projection is not covered by the index so the records are fetched
+        result = SQL::execute(txn, "SELECT p, r FROM V WHERE q = 2");
+        res = result.get<ResultSet>();
+        assert(res.size() == 2);
+        assert(res[0].record.getInt("r") == 20 && res[1].record.get("r").empty());
+
+        result = SQL::execute(txn, "DROP INDEX V (q)");
+        assert(result.type() == result.NO_RESULT);
+        assert(txn.getIndexes(txn.getClass("V")).empty());
+
+        result = SQL::execute(txn, "CREATE INDEX V (q, r) UNIQUE INCLUDE (p)");
+        assert(result.type() == result.NO_RESULT);
+        assert(txn.getIndex("V", { "q", "r" }).includedPropertyIds.size() == 1);
+        result = SQL::execute(txn, "SELECT p, r FROM V WHERE q = 1 AND r = 10");
+        res = result.get<ResultSet>();
+        assert(res.size() == 1 && res[0].record.getText("p") == "v1" && res[0].record.getInt("r") == 10);
+        txn.dropIndex("V", { "q", "r" });
+    } catch (const Error& e) {
+        cout << "\nError: " << e.what() << endl;
+        assert(false);
+    }
+
+    txn.dropProperty("V", "p");
+    txn.dropProperty("V", "q");
+    txn.dropProperty("V", "r");
+    txn.dropClass("V");
+    txn.commit();
+}
+
+void test_sql_explain()
+{
+    auto txn = ctx->beginTxn(TxnMode::READ_WRITE);
+    txn.addClass("V", ClassType::VERTEX);
+    txn.addProperty("V", "p", PropertyType::TEXT);
+    txn.addProperty("V", "q", PropertyType::INTEGER);
+    txn.addClass("E", ClassType::EDGE);
+    txn.addIndex("V", "p");
+
+    try {
+        auto v1 = txn.addVertex("V", Record().set("p", "v1").set("q", 1));
+        auto v2 = txn.addVertex("V", Record().set("p", "v2").set("q", 2));
+        txn.addVertex("V", Record().set("p", "v3").set("q", 3));
+        txn.addEdge("E", v1, v2);
+
+        SQL::Result result = SQL::execute(txn, "EXPLAIN SELECT * FROM V WHERE p = 'v2'");
+        assert(result.type() == result.QUERY_PLAN);
+        auto plan = result.get<QueryPlan>();
+        assert(plan.actualRows == 1);
+        assert(plan.stages.size() == 2);
+        assert(plan.stages[0].operation == "INDEX_SCAN");
+        assert(plan.stages[0].indexIds.size() == 1 && plan.stages[0].indexIds[0] == txn.getIndex("V", "p").id);
+
+        result = SQL::execute(txn, "EXPLAIN SELECT * FROM V WHERE p IN ['v3', 'v1', 'v3', 'v4']");
+        assert(result.type() == result.QUERY_PLAN);
+        plan = result.get<QueryPlan>();
+        assert(plan.actualRows == 2);
+        assert(plan.stages[0].operation == "INDEX_SCAN");
+
+        result = SQL::execute(txn, "EXPLAIN SELECT * FROM V WHERE q > 1");
+        assert(result.type() == result.QUERY_PLAN);
+        plan = result.get<QueryPlan>();
+        assert(plan.actualRows == 2);
+        assert(plan.stages[0].operation == "COLUMN_SCAN");
+        assert(plan.stages[0].rowsScanned == 3);
+
+        result = SQL::execute(txn, "EXPLAIN SELECT * FROM (SELECT * FROM V WHERE q > 1) WHERE p = 'v3'");
+        assert(result.type() == result.QUERY_PLAN);
+        plan = result.get<QueryPlan>();
+        assert(plan.actualRows == 1);
+        assert(plan.stages[0].operation == "SELECT");
+
+        result = SQL::execute(txn, "EXPLAIN TRAVERSE out() FROM " + to_string(v1));
+        assert(result.type() == result.QUERY_PLAN);
+        plan = result.get<QueryPlan>();
+        assert(plan.actualRows == txn.traverseOut(v1).depth(0, UINT_MAX).get().size());
+        assert(plan.stages[0].operation == "TRAVERSE");
+
+    } catch (const Error& e) {
+        cout << "\nError: " << e.what() << endl;
+        assert(false);
+    }
+
+    try {
+        SQL::execute(txn, "EXPLAIN SELECT * FROM X");
+        assert(false);
+    } catch (const Error& e) {
+        REQUIRE(e, NOGDB_CTX_NOEXST_CLASS, "NOGDB_CTX_NOEXST_CLASS");
+    }
+
+    try {
+        SQL::execute(txn, "EXPLAIN DROP CLASS V");
+        assert(false);
+    } catch (const Error& e) {
+        REQUIRE(e, NOGDB_SQL_SYNTAX_ERROR, "NOGDB_SQL_SYNTAX_ERROR");
+    }
+
+    txn.dropIndex("V", "p");
+    txn.dropClass("V");
+    txn.dropClass("E");
+    txn.commit();
+}
@@ -0,0 +1,133 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../src/index_sorter.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+using nogdb::PositionId;
+using nogdb::index::IndexEntrySorter;
+
+namespace {
+
+template <typename K>
+std::vector<std::tuple<K, PositionId, bool>> drain(IndexEntrySorter<K>& sorter)
+{
+    auto result = std::vector<std::tuple<K, PositionId, bool>> {};
+    sorter.forEach([&](const K& key, const PositionId& positionId, bool isSameKey) {
+        result.emplace_back(key, positionId, isSameKey);
+    });
+    return result;
+}
+
+template <typename K>
+void expectIndexOrder(const std::vector<std::tuple<K, PositionId, bool>>& entries)
+{
+    for (auto i = size_t { 1 }; i < entries.size(); ++i) {
+        auto& previous = entries[i - 1];
+        auto& current = entries[i];
+        ASSERT_FALSE(std::get<0>(current) < std::get<0>(previous));
+        ASSERT_EQ(std::get<2>(current), std::get<0>(current) == std::get<0>(previous));
+        if (std::get<2>(current)) {
+            ASSERT_LT(std::memcmp(&std::get<1>(previous), &std::get<1>(current), sizeof(PositionId)), 0);
+        }
+    }
+}
+
+}
+
+TEST(IndexEntrySorterTest, sort_in_memory)
+{
+    IndexEntrySorter<uint64_t> sorter { 1024 * 1024 };
+    sorter.add(3, 1);
+    sorter.add(1, 2);
+    sorter.add(3, 0x100);
+    sorter.add(3, 2);
+    sorter.add(2, 5);
+    auto entries = drain(sorter);
+    ASSERT_EQ(sorter.getNumRuns(), 0UL);
+    ASSERT_EQ(entries.size(), 5UL);
+    expectIndexOrder(entries);
+    // duplicates follow the byte order of the position ids rather than their numeric order
+    EXPECT_EQ(entries[2], std::make_tuple(uint64_t { 3 }, PositionId { 0x100 }, false));
+    EXPECT_EQ(entries[3], std::make_tuple(uint64_t { 3 }, PositionId { 1 }, true));
+    EXPECT_EQ(entries[4], std::make_tuple(uint64_t { 3 }, PositionId { 2 }, true));
+}
+
+TEST(IndexEntrySorterTest, merge_spilled_numeric_runs)
+{
+    auto rng = std::mt19937 { 42 };
+    auto pick = std::uniform_int_distribution<uint64_t> { 0, 999 };
+    IndexEntrySorter<uint64_t> sorter { 100 * sizeof(std::pair<uint64_t, PositionId>) };
+    for (auto i = PositionId { 0 }; i < 10000; ++i) {
+        sorter.add(pick(rng), i);
+    }
+    auto entries = drain(sorter);
+    EXPECT_GE(sorter.getNumRuns(), 100UL);
+    ASSERT_EQ(entries.size(), 10000UL);
+    expectIndexOrder(entries);
+}
+
+TEST(IndexEntrySorterTest, merge_spilled_string_runs)
+{
+    auto rng = std::mt19937 { 42 };
+    auto pick = std::uniform_int_distribution<int> { 0, 255 };
+    IndexEntrySorter<std::string> sorter { 4096 };
+    auto keys = std::vector<std::string> {};
+    for (auto i = PositionId { 0 }; i < 5000; ++i) {
+        auto key = std::string(static_cast<size_t>(pick(rng) % 4 + 1), '\0');
+        for (auto& c : key) {
+            c = static_cast<char>(pick(rng) % 8 + 0x7c);
+        }
+        sorter.add(key, i);
+        keys.emplace_back(key);
+    }
+    auto entries = drain(sorter);
+    EXPECT_GT(sorter.getNumRuns(), 1UL);
+    ASSERT_EQ(entries.size(), keys.size());
+    expectIndexOrder(entries);
+    std::sort(keys.begin(), keys.end());
+    for (auto i = size_t { 0 }; i < keys.size(); ++i) {
+        ASSERT_EQ(std::get<0>(entries[i]), keys[i]);
+    }
+}
+
+TEST(IndexEntrySorterTest, merge_spilled_string_values)
+{
+    IndexEntrySorter<std::string, std::string> sorter { 256 };
+    for (auto i = 0; i < 300; ++i) {
+        // the values of a covering index start with the position id followed by the included values
+        auto positionId = static_cast<PositionId>(299 - i);
+        auto value = std::string(reinterpret_cast<const char*>(&positionId), sizeof(PositionId));
+        value.append(static_cast<size_t>(i % 3), '\xff');
+        sorter.add(std::string(1, static_cast<char>('a' + i % 5)), value);
+    }
+    auto entries = std::vector<std::pair<std::string, std::string>> {};
+    sorter.forEach([&](const std::string& key, const std::string& value, bool isSameKey) {
+        EXPECT_EQ(isSameKey, !entries.empty() && entries.back().first == key);
+        entries.emplace_back(key, value);
+    });
+    EXPECT_GT(sorter.getNumRuns(), 1UL);
+    ASSERT_EQ(entries.size(), 300UL);
+    EXPECT_TRUE(std::is_sorted(entries.cbegin(), entries.cend()));
+    EXPECT_EQ(entries.front().first, "a");
+    EXPECT_EQ(entries.back().first, "e");
+}
@@ -664,4 +664,30 @@ TEST_F(LMDBBasicOperations, put_get_del_decimal_numeric_dup)
     ASSERT_TRUE(res.empty);
 
     afterEach();
-}
\ No newline at end of file
+}
+
+TEST_F(LMDBBasicOperations, append_numeric_blob_dup)
+{
+    beforeEach();
+
+    auto dbi = txn->openDBi("LMDBBasicOperations::append_numeric_blob_dup", true, false);
+    auto value = [](uint32_t v) { return Blob(sizeof(uint32_t)).append(&v, sizeof(uint32_t)); };
+    dbi.append(1UL, value(100));
+    dbi.append(1UL, value(200), true);
+    dbi.append(2UL, value(100));
+    EXPECT_THROW(dbi.append(2UL, value(300)), nogdb::Error);
+    EXPECT_THROW(dbi.append(1UL, value(300)), nogdb::Error);
+    EXPECT_THROW(dbi.append(2UL, value(50), true), nogdb::Error);
+
+    auto cursor = txn->openCursor(dbi);
+    auto res = cursor.find(1UL);
+    ASSERT_FALSE(res.empty());
+    EXPECT_EQ(res.val.data.numeric<uint32_t>(), 100U);
+    EXPECT_EQ(cursor.count(), 2UL);
+    res = cursor.getNextNoDup();
+    ASSERT_FALSE(res.empty());
+    EXPECT_EQ(res.key.data.numeric<uint64_t>(), 2UL);
+    EXPECT_EQ(cursor.count(), 1UL);
+
+    afterEach();
+}
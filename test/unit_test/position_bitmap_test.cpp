@@ -0,0 +1,129 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../src/position_bitmap.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+
+using nogdb::PositionId;
+using nogdb::index::PositionBitmap;
+
+namespace {
+
+std::set<PositionId> randomPositionIds(std::mt19937& rng, size_t count, PositionId maxPositionId)
+{
+    auto pick = std::uniform_int_distribution<PositionId> { 0, maxPositionId };
+    auto positionIds = std::set<PositionId> {};
+    while (positionIds.size() < count) {
+        positionIds.insert(pick(rng));
+    }
+    return positionIds;
+}
+
+PositionBitmap toBitmap(const std::set<PositionId>& positionIds, bool isShuffled, std::mt19937& rng)
+{
+    auto values = std::vector<PositionId>(positionIds.cbegin(), positionIds.cend());
+    if (isShuffled) {
+        std::shuffle(values.begin(), values.end(), rng);
+    }
+    auto bitmap = PositionBitmap {};
+    for (auto value : values) {
+        bitmap.add(value);
+    }
+    return bitmap;
+}
+
+std::vector<PositionId> drain(const PositionBitmap& bitmap)
+{
+    auto result = std::vector<PositionId> {};
+    bitmap.forEach([&](PositionId positionId) { result.emplace_back(positionId); });
+    return result;
+}
+
+}
+
+TEST(PositionBitmapTest, add_and_iterate_in_order)
+{
+    auto rng = std::mt19937 { 42 };
+    // sparse chunks, a chunk which turns into a bitmap and ids spread over many chunks
+    for (const auto& shape : std::vector<std::pair<size_t, PositionId>> { { 100, 1000 }, { 9000, 0xffff }, { 5000, 0xfffffff } }) {
+        auto positionIds = randomPositionIds(rng, shape.first, shape.second);
+        auto bitmap = toBitmap(positionIds, true, rng);
+        bitmap.add(*positionIds.begin());
+        EXPECT_EQ(bitmap.size(), positionIds.size());
+        EXPECT_EQ(drain(bitmap), std::vector<PositionId>(positionIds.cbegin(), positionIds.cend()));
+        for (auto positionId : positionIds) {
+            ASSERT_TRUE(bitmap.contains(positionId));
+        }
+        EXPECT_FALSE(bitmap.contains(shape.second + 1));
+    }
+    EXPECT_TRUE(PositionBitmap {}.empty());
+    EXPECT_EQ(PositionBitmap {}.size(), 0UL);
+}
+
+TEST(PositionBitmapTest, intersect_and_unite)
+{
+    auto rng = std::mt19937 { 7 };
+    // pairs of array and bitmap chunks, and skewed arrays which are galloped through
+    auto shapes = std::vector<std::pair<size_t, size_t>> { { 200, 300 }, { 20000, 30000 }, { 300, 30000 }, { 10, 3000 }, { 0, 50 } };
+    for (const auto& shape : shapes) {
+        auto lhs = randomPositionIds(rng, shape.first, 0x2ffff);
+        auto rhs = randomPositionIds(rng, shape.second, 0x2ffff);
+        auto expectedIntersection = std::vector<PositionId> {};
+        std::set_intersection(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(), std::back_inserter(expectedIntersection));
+        auto expectedUnion = std::vector<PositionId> {};
+        std::set_union(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(), std::back_inserter(expectedUnion));
+
+        auto lhsBitmap = toBitmap(lhs, false, rng);
+        auto rhsBitmap = toBitmap(rhs, false, rng);
+        auto intersection = lhsBitmap & rhsBitmap;
+        EXPECT_EQ(drain(intersection), expectedIntersection);
+        EXPECT_EQ(intersection.size(), expectedIntersection.size());
+        EXPECT_EQ(drain(rhsBitmap & lhsBitmap), expectedIntersection);
+        auto united = lhsBitmap | rhsBitmap;
+        EXPECT_EQ(drain(united), expectedUnion);
+        EXPECT_EQ(united.size(), expectedUnion.size());
+        EXPECT_EQ(drain(rhsBitmap | lhsBitmap), expectedUnion);
+    }
+}
+
+TEST(PositionBitmapTest, dense_intersection_becomes_sparse)
+{
+    auto evens = PositionBitmap {};
+    auto multiplesOfThree = PositionBitmap {};
+    for (auto positionId = PositionId { 0 }; positionId < 0x10000; ++positionId) {
+        if (positionId % 2 == 0) {
+            evens.add(positionId);
+        }
+        if (positionId % 3 == 0) {
+            multiplesOfThree.add(positionId);
+        }
+    }
+    auto intersection = evens & multiplesOfThree;
+    EXPECT_EQ(intersection.size(), 10923UL);
+    auto sparse = PositionBitmap {};
+    sparse.add(6);
+    sparse.add(9);
+    sparse.add(0x10000);
+    EXPECT_EQ(drain(intersection & sparse), std::vector<PositionId> { 6 });
+    EXPECT_EQ((evens | sparse).size(), 0x8000UL + 2);
+}
@@ -0,0 +1,225 @@
+/*
+ *  Copyright (C) 2019, NogDB <https://nogdb.org>
+ *  <nogdb at throughwave dot co dot th>
+ *
+ *  This file is part of libnogdb, the NogDB core library in C++.
+ *
+ *  libnogdb is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../src/utils.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <regex>
+
+using namespace nogdb::utils::string;
+
+namespace {
+
+bool regexLike(const std::string& text, std::string pattern, bool ignoreCase)
+{
+    auto escaped = std::string {};
+    for (auto c : pattern) {
+        if (c == '%') {
+            escaped += "(.*)";
+        } else if (c == '_') {
+            escaped += "(.)";
+        } else {
+            if (!std::isalnum(static_cast<unsigned char>(c))) {
+                escaped += '\\';
+            }
+            escaped += c;
+        }
+    }
+    auto flags = std::regex::ECMAScript;
+    if (ignoreCase) {
+        flags |= std::regex::icase;
+    }
+    return std::regex_match(text, std::regex(escaped, flags));
+}
+
+std::string randomText(std::mt19937& rng, size_t length, const std::string& alphabet)
+{
+    auto result = std::string {};
+    auto pick = std::uniform_int_distribution<size_t> { 0, alphabet.size() - 1 };
+    for (size_t i = 0; i < length; ++i) {
+        result += alphabet[pick(rng)];
+    }
+    return result;
+}
+
+}
+
+TEST(StringMatcher, find_substring)
+{
+    auto text = std::string { "the quick brown fox jumps over the lazy dog, the QUICK BROWN FOX jumps again" };
+    EXPECT_EQ(find(text.data(), text.size(), "fox", 3), text.find("fox"));
+    EXPECT_EQ(find(text.data(), text.size(), "again", 5), text.find("again"));
+    EXPECT_EQ(find(text.data(), text.size(), "t", 1), 0UL);
+    EXPECT_EQ(find(text.data(), text.size(), "", 0), 0UL);
+    EXPECT_EQ(find(text.data(), text.size(), "cat", 3), std::string::npos);
+    EXPECT_EQ(find(text.data(), text.size(), "QUICK", 5), text.find("QUICK"));
+    EXPECT_EQ(find(text.data(), text.size(), "QUICK", 5, true), text.find("quick"));
+    EXPECT_EQ(find(text.data(), text.size(), "Lazy Dog", 8, true), text.find("lazy dog"));
+    EXPECT_EQ(find(text.data(), 3, "the quick", 9), std::string::npos);
+}
+
+TEST(StringMatcher, find_agrees_with_std_string)
+{
+    auto rng = std::mt19937 { 20190101 };
+    for (auto i = 0; i < 2000; ++i) {
+        auto text = randomText(rng, rng() % 200, "abcAB");
+        auto pattern = randomText(rng, 1 + rng() % 6, "abc");
+        EXPECT_EQ(find(text.data(), text.size(), pattern.data(), pattern.size()), text.find(pattern));
+        auto lowerText = text;
+        std::transform(lowerText.begin(), lowerText.end(), lowerText.begin(), ::tolower);
+        EXPECT_EQ(find(text.data(), text.size(), pattern.data(), pattern.size(), true), lowerText.find(pattern));
+    }
+}
+
+TEST(StringMatcher, begin_end_contain)
+{
+    EXPECT_TRUE(beginWith("Hermione", "Her"));
+    EXPECT_FALSE(beginWith("Hermione", "her"));
+    EXPECT_TRUE(beginWith("Hermione", "her", true));
+    EXPECT_FALSE(beginWith("He", "Her"));
+    EXPECT_TRUE(endWith("Hermione", "one"));
+    EXPECT_TRUE(endWith("Hermione", "ONE", true));
+    EXPECT_FALSE(endWith("Hermione", "ONE"));
+    EXPECT_FALSE(endWith("ne", "one"));
+    EXPECT_TRUE(contains("Hermione", "mio"));
+    EXPECT_TRUE(contains("Hermione", "MIO", true));
+    EXPECT_FALSE(contains("Hermione", "MIO"));
+}
+
+TEST(StringMatcher, fold_case)
+{
+    EXPECT_EQ(foldCase("Hermione GRANGER 42"), "hermione granger 42");
+    EXPECT_EQ(foldCase("\xc3\x89" "cole"), "\xc3\x89" "cole");
+    EXPECT_EQ(foldCaseUnicode("Hermione GRANGER 42"), "hermione granger 42");
+    // latin-1, latin extended-a, greek with its final sigma, cyrillic, armenian and fullwidth letters
+    EXPECT_EQ(foldCaseUnicode("\xc3\x89" "COLE \xc3\x9f \xc5\x81\xc3\x93" "D\xc5\xb9"), "\xc3\xa9" "cole \xc3\x9f \xc5\x82\xc3\xb3" "d\xc5\xba");
+    EXPECT_EQ(foldCaseUnicode("\xce\xa3\xce\x9f\xce\xa6\xce\x99\xce\x91 \xcf\x82"), "\xcf\x83\xce\xbf\xcf\x86\xce\xb9\xce\xb1 \xcf\x83");
+    EXPECT_EQ(foldCaseUnicode("\xd0\x9c\xd0\x9e\xd0\xa1\xd0\x9a\xd0\x92\xd0\x90 \xd0\x81"), "\xd0\xbc\xd0\xbe\xd1\x81\xd0\xba\xd0\xb2\xd0\xb0 \xd1\x91");
+    EXPECT_EQ(foldCaseUnicode("\xd4\xb1 \xef\xbc\xa1"), "\xd5\xa1 \xef\xbd\x81");
+    // the kelvin sign is not folded into an ascii k, and invalid bytes are kept
+    EXPECT_EQ(foldCaseUnicode("\xe2\x84\xaa"), "\xe2\x84\xaa");
+    EXPECT_EQ(foldCaseUnicode("A\xc3"), "a\xc3");
+    EXPECT_EQ(foldCaseUnicode("\xff\x41\xc0\x81"), "\xff" "a\xc0\x81");
+    EXPECT_TRUE(isAscii("Hermione"));
+    EXPECT_FALSE(isAscii("\xc3\x89" "cole"));
+}
+
+TEST(StringMatcher, like_patterns)
+{
+    EXPECT_TRUE(like("Hermione", "Herm%e%"));
+    EXPECT_TRUE(like("Potter", "pO%ter", true));
+    EXPECT_FALSE(like("Potter", "pO%ter"));
+    EXPECT_TRUE(like("Weasley", "%sl%"));
+    EXPECT_FALSE(like("Weasley", "%ly%"));
+    EXPECT_TRUE(like("Hermes", "herm__", true));
+    EXPECT_FALSE(like("Hermione", "herm__", true));
+    EXPECT_TRUE(like("", "%"));
+    EXPECT_TRUE(like("", ""));
+    EXPECT_FALSE(like("a", ""));
+    EXPECT_TRUE(like("abc", "a%%c"));
+    EXPECT_TRUE(like("a.c", "a.c"));
+    EXPECT_FALSE(like("abc", "a.c"));
+    EXPECT_TRUE(like("aXbYc", "%a_b_c%"));
+    EXPECT_FALSE(like("abab", "%aba%bab"));
+    EXPECT_EQ(likePrefix("Herm%e_"), "Herm");
+    EXPECT_EQ(likePrefix("_abc"), "");
+    EXPECT_EQ(likePrefix("abc"), "abc");
+}
+
+TEST(StringMatcher, like_agrees_with_regex)
+{
+    auto rng = std::mt19937 { 20190102 };
+    for (auto i = 0; i < 3000; ++i) {
+        auto text = randomText(rng, rng() % 24, "abAB");
+        auto pattern = randomText(rng, rng() % 8, "ab%_A");
+        auto ignoreCase = (i % 2) == 1;
+        EXPECT_EQ(like(text, pattern, ignoreCase), regexLike(text, pattern, ignoreCase))
+            << "text=" << text << " pattern=" << pattern << " ignoreCase=" << ignoreCase;
+    }
+}
+
+// microbenchmarks (run with --gtest_also_run_disabled_tests)
+TEST(StringMatcher, DISABLED_benchmark_like_vs_regex)
+{
+    auto rng = std::mt19937 { 42 };
+    auto texts = std::vector<std::string> {};
+    for (auto i = 0; i < 20000; ++i) {
+        texts.emplace_back(randomText(rng, 16 + rng() % 240, "abcdefghijklmnopqrstuvwxyz "));
+    }
+    auto patterns = std::vector<std::string> { "abc%", "%xyz", "%hello%world%", "a_c%de_%", "%q__k%" };
+    for (const auto& pattern : patterns) {
+        auto translated = pattern;
+        replaceAll(translated, "%", "(.*)");
+        replaceAll(translated, "_", "(.)");
+        auto regexMatches = size_t { 0 }, nativeMatches = size_t { 0 };
+        auto regexTime = 0.0, nativeTime = 0.0;
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            for (const auto& text : texts) {
+                regexMatches += std::regex_match(text, std::regex(translated)) ? 1 : 0;
+            }
+            regexTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        }
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            for (const auto& text : texts) {
+                nativeMatches += like(text, pattern) ? 1 : 0;
+            }
+            nativeTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        }
+        EXPECT_EQ(regexMatches, nativeMatches);
+        std::cout << "LIKE '" << pattern << "': std::regex " << regexTime << " ms, native " << nativeTime
+                  << " ms (" << (nativeTime > 0 ? regexTime / nativeTime : 0.0) << "x)" << std::endl;
+    }
+}
+
+TEST(StringMatcher, DISABLED_benchmark_find_vs_std_string)
+{
+    auto rng = std::mt19937 { 43 };
+    auto text = randomText(rng, 1 << 20, "abcdefghijklmnopqrstuvwxyz");
+    auto needle = std::string { "needle" };
+    text.replace(text.size() - needle.size(), needle.size(), needle);
+    auto iterations = 50;
+    auto stdTime = 0.0, nativeTime = 0.0, nativeIgnoreCaseTime = 0.0;
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (auto i = 0; i < iterations; ++i) {
+            EXPECT_NE(text.find(needle), std::string::npos);
+        }
+        stdTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (auto i = 0; i < iterations; ++i) {
+            EXPECT_TRUE(contains(text, needle));
+        }
+        nativeTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (auto i = 0; i < iterations; ++i) {
+            EXPECT_TRUE(contains(text, "NEEDLE", true));
+        }
+        nativeIgnoreCaseTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+    std::cout << "CONTAIN over 1MiB: std::string::find " << stdTime << " ms, native " << nativeTime
+              << " ms, native ignore-case " << nativeIgnoreCaseTime << " ms" << std::endl;
+}